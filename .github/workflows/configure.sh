@@ -2,6 +2,7 @@
 
 maker=$1
 device=$2
+trace=${3:-no}
 
 if [ "${maker}" = "cmake" ]; then
     rm -rf build
@@ -53,7 +54,8 @@ elif [ "${maker}" = "cmake" ]; then
     cmake -Dcolor=no \
           -DCMAKE_INSTALL_PREFIX=${top}/install \
           -Dblas_int=${blas_int} \
-          -Dgpu_backend=${gpu_backend} .. \
+          -Dgpu_backend=${gpu_backend} \
+          -Duse_trace=${trace} .. \
           || exit 12
 fi
 
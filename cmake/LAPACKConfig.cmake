@@ -70,6 +70,38 @@ else()
     message( "${red}   XBLAS not found.${plain}" )
 endif()
 
+#-------------------------------------------------------------------------------
+# Check for vendor APIs to set the number of threads,
+# used by the tester's --threads scaling sweep.
+message( STATUS "Checking for MKL or OpenBLAS threading API" )
+
+foreach (vendor IN ITEMS "mkl" "openblas")
+    try_run(
+        run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+        SOURCES
+            "${CMAKE_CURRENT_SOURCE_DIR}/config/${vendor}_version.cc"
+        LINK_LIBRARIES
+            ${LAPACK_LIBRARIES} ${blaspp_libraries}
+        CMAKE_FLAGS
+            "-DINCLUDE_DIRECTORIES=${blaspp_cblas_include}"
+        COMPILE_DEFINITIONS
+            ${blaspp_defines}
+        COMPILE_OUTPUT_VARIABLE
+            compile_output
+        RUN_OUTPUT_VARIABLE
+            run_output
+    )
+    debug_try_run( "${vendor}_version.cc" "${compile_result}" "${compile_output}"
+                                          "${run_result}" "${run_output}" )
+
+    string( TOUPPER "${vendor}" VENDOR )
+    if (compile_result AND "${run_output}" MATCHES "${VENDOR}_VERSION=")
+        message( "${blue}   Found ${VENDOR}${plain}" )
+        list( APPEND lapackpp_defs_ "-DLAPACK_HAVE_${VENDOR}" )
+        break()
+    endif()
+endforeach()
+
 #-------------------------------------------------------------------------------
 # Find LAPACKE, either in the BLAS/LAPACK library or in -llapacke.
 # Check for pstrf (Cholesky with pivoting).
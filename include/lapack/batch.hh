@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_HH
+#define LAPACK_BATCH_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Batched routines on the host. Each matrix or system in a batch is
+// handled independently, and the batch is spread over OpenMP threads.
+//
+// The pointer-array versions follow blas::batch: each scalar argument is
+// a vector of either length 1, applying to all matrices in the batch, or
+// length batch, giving a value per matrix. Arrays of matrix, pivot, and
+// tau pointers must have length batch.
+//
+// The strided versions take a single size for all matrices, with
+// matrix i starting at A + i*stride_A. Their arguments are checked once
+// for the whole batch.
+//
+// On return, info has length batch, with info[ i ] as returned by the
+// non-batched routine for matrix i.
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<scalar_t*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<int64_t*> const& ipiv_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<scalar_t*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<scalar_t*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<scalar_t*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    scalar_t* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void potrs_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t stride_A,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+// Interleaved batches of tiny matrices. Matrices are grouped in chunks of
+// W = interleaved_width; within a chunk, element (i, j) of all W matrices
+// is stored contiguously, so the kernels vectorize across the batch rather
+// than within a matrix. For a batch of m-by-n matrices, element (i, j) of
+// matrix b is at
+//
+//     A[ (b / W)*m*n*W + (i + j*m)*W + (b % W) ].
+//
+// Pivots are stored the same way, as n-by-1 matrices. The last chunk is
+// padded to W matrices; pack_interleaved sets padding to the identity.
+// Use interleaved_size to get the array length.
+
+constexpr int64_t interleaved_width = 16;
+
+/// @return length of an array holding a batch of m-by-n matrices
+/// in interleaved layout, including padding.
+inline int64_t interleaved_size( int64_t m, int64_t n, size_t batch )
+{
+    int64_t W = interleaved_width;
+    int64_t chunks = (int64_t( batch ) + W - 1) / W;
+    return chunks * m * n * W;
+}
+
+template <typename scalar_t>
+void pack_interleaved(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda, int64_t stride_A,
+    scalar_t* Ai,
+    size_t batch );
+
+template <typename scalar_t>
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    scalar_t const* Ai,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    size_t batch );
+
+template <typename scalar_t>
+void getrf_interleaved(
+    int64_t n,
+    scalar_t* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t const* ipiv,
+    scalar_t* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template <typename scalar_t>
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A,
+    scalar_t* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_HH
@@ -13,6 +13,16 @@
     #include <cusolverDn.h>
 #endif
 
+// Without a GPU library, device routines are synchronous host calls,
+// with "device" memory in host memory. They run in the calling thread
+// and finish before returning; the queue is not used, so there is
+// nothing for blas::Queue::sync to wait for.
+#if ! (defined(LAPACK_HAVE_CUBLAS) \
+       || defined(LAPACK_HAVE_ROCBLAS) \
+       || defined(LAPACK_HAVE_SYCL))
+    #define LAPACK_DEVICE_ROUTINES_ON_HOST
+#endif
+
 namespace lapack {
 
 // Since we pass pointers to these integers, their types have to match
@@ -9,6 +9,7 @@
 #include "lapack.hh"
 #include "blas/flops.hh"
 
+#include <algorithm>
 #include <complex>
 
 namespace lapack {
@@ -315,6 +316,141 @@ inline double fadds_lanhe(lapack::Norm norm, double n)
     }
 }
 
+//------------------------------------------------------------ gbtrf
+// Counts the worst case, where partial pivoting widens U to kl + ku
+// superdiagonals. Ignores end effects in the last kl columns.
+inline double fmuls_gbtrf(double m, double n, double kl, double ku)
+    { return (m < n ? m : n) * kl*(kl + ku + 1); }
+
+inline double fadds_gbtrf(double m, double n, double kl, double ku)
+    { return (m < n ? m : n) * kl*(kl + ku); }
+
+//------------------------------------------------------------ gbtrs
+inline double fmuls_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku + 1); }
+
+inline double fadds_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku); }
+
+//------------------------------------------------------------ gttrf
+inline double fmuls_gttrf(double n)
+    { return 2*(n - 1); }
+
+inline double fadds_gttrf(double n)
+    { return n - 1; }
+
+//------------------------------------------------------------ gttrs
+inline double fmuls_gttrs(double n, double nrhs)
+    { return nrhs*(4*n - 4); }
+
+inline double fadds_gttrs(double n, double nrhs)
+    { return nrhs*(3*n - 4); }
+
+//------------------------------------------------------------ eigenvalue, SVD
+// The tridiagonal, bidiagonal, and Hessenberg eigenvalue and SVD phases
+// below are iterative, so these are models of their O(n^3) cost with
+// vectors, split evenly between multiplies and adds, for reporting Gflop/s.
+// Their O(n^2) eigenvalue-only cost is omitted.
+// Costs are from Golub & Van Loan, Matrix Computations, 4th ed.
+
+//------------------------------------------------------------ steqr
+// Implicit QL/QR accumulating rotations into n-by-n Z,
+// about 6n^3 flops (sec. 8.3).
+inline double fmuls_steqr(double n)
+    { return 3*n*n*n; }
+
+inline double fadds_steqr(double n)
+    { return 3*n*n*n; }
+
+//------------------------------------------------------------ stedc
+// Divide and conquer without deflation, about 4/3 n^3 flops (sec. 8.4),
+// for both the tridiagonal eigenvectors and bdsdc's singular vectors.
+inline double fmuls_stedc(double n)
+    { return 2/3.*n*n*n; }
+
+inline double fadds_stedc(double n)
+    { return 2/3.*n*n*n; }
+
+//------------------------------------------------------------ hbtrd
+// Band to tridiagonal, about 6 n^2 kd flops, plus 3 n^3 to update Q.
+inline double fmuls_hbtrd(lapack::Job vect, double n, double kd)
+{
+    return (vect == lapack::Job::NoVec)
+        ? 3*n*n*kd
+        : 3*n*n*kd + 1.5*n*n*n;
+}
+
+inline double fadds_hbtrd(lapack::Job vect, double n, double kd)
+    { return fmuls_hbtrd(vect, n, kd); }
+
+//------------------------------------------------------------ hseqr
+// Hessenberg QR, excluding gehrd and unghr: about 10 n^3 flops total
+// for eigenvalues and 25 n^3 for the Schur form and vectors (sec. 7.5.6).
+inline double fmuls_hseqr(lapack::Job compz, double n)
+{
+    return (compz == lapack::Job::NoVec)
+        ? 5*n*n*n - 0.5*(fmuls_gehrd(n) + fadds_gehrd(n))
+        : 12.5*n*n*n - 0.5*(fmuls_gehrd(n) + fadds_gehrd(n)
+                          + fmuls_ungqr(n, n, n) + fadds_ungqr(n, n, n));
+}
+
+inline double fadds_hseqr(lapack::Job compz, double n)
+    { return fmuls_hseqr(compz, n); }
+
+//------------------------------------------------------------ trevc
+// Eigenvectors of a triangular matrix for one side (left or right),
+// n^3/3 flops, and back transformation by the Schur vectors, n^3.
+inline double fmuls_trevc(double n)
+    { return 2/3.*n*n*n; }
+
+inline double fadds_trevc(double n)
+    { return 2/3.*n*n*n; }
+
+//------------------------------------------------------------ gesvd
+// Golub-Reinsch SVD, or R-SVD (QR first) when m >= 1.6 n as LAPACK does,
+// from fig. 8.6.1 of Golub & Van Loan. The Golub-Reinsch cost with full U
+// is printed there as 4m^2 n - 8mn^2, which is negative for m = n;
+// 4m^2 n + 8mn^2 is used, which equals the cost with thin U when m = n.
+// Thin U is jobu = SomeVec or OverwriteVec; full U is jobu = AllVec.
+// For m < n, this counts the SVD of A^H, swapping the roles of U and V.
+inline double fmuls_gesvd(lapack::Job jobu, lapack::Job jobvt,
+                          double m, double n)
+{
+    if (m < n)
+        return fmuls_gesvd(jobvt, jobu, n, m);
+
+    bool wantu = (jobu  != lapack::Job::NoVec);
+    bool fullu = (jobu  == lapack::Job::AllVec);
+    bool wantv = (jobvt != lapack::Job::NoVec);
+    double n3  = n*n*n;
+    double mn2 = m*n*n;
+    double m2n = m*m*n;
+    double flops;
+    if (m >= 1.6*n) {
+        // R-SVD
+        if (! wantu)
+            flops = (wantv ? 2*mn2 + 11*n3 : 2*mn2 + 2*n3);
+        else if (fullu)
+            flops = (wantv ? 4*m2n + 22*n3 : 4*m2n + 13*n3);
+        else
+            flops = (wantv ? 6*mn2 + 20*n3 : 6*mn2 + 11*n3);
+    }
+    else {
+        // Golub-Reinsch
+        if (! wantu)
+            flops = (wantv ? 4*mn2 + 8*n3 : 4*mn2 - 4/3.*n3);
+        else if (fullu)
+            flops = (wantv ? 4*m2n + 8*mn2 + 9*n3 : 4*m2n + 8*mn2);
+        else
+            flops = (wantv ? 14*mn2 + 8*n3 : 14*mn2 - 2*n3);
+    }
+    return 0.5*flops;
+}
+
+inline double fadds_gesvd(lapack::Job jobu, lapack::Job jobvt,
+                          double m, double n)
+    { return fmuls_gesvd(jobu, jobvt, m, n); }
+
 //==============================================================================
 // template class. Example:
 // gbyte< float >::gemv( m, n ) yields bytes transferred for sgemv.
@@ -324,6 +460,18 @@ template< typename T >
 class Gbyte:
     public blas::Gbyte<T>
 {
+public:
+    // Factorizations in place read and write A at least once.
+    // These are lower bounds, ignoring blocking and pivoting traffic.
+
+    static double getrf(double m, double n)
+        { return 1e-9 * (2*m*n * sizeof(T)); }
+
+    static double potrf(double n)
+        { return 1e-9 * (n*(n + 1) * sizeof(T)); }  // 2 * n(n+1)/2
+
+    static double geqrf(double m, double n)
+        { return 1e-9 * (2*m*n * sizeof(T)); }
 };
 
 //==============================================================================
@@ -515,6 +663,238 @@ public:
 
     static double lansy(lapack::Norm norm, double n)
         { return lanhe(norm, n); }
+
+    // band and tridiagonal LU
+    static double gbsv(double n, double kl, double ku, double nrhs)
+        { return gbtrf(n, n, kl, ku) + gbtrs(n, kl, ku, nrhs); }
+
+    static double gbtrf(double m, double n, double kl, double ku)
+        { return 1e-9 * (mul_ops*fmuls_gbtrf(m, n, kl, ku) + add_ops*fadds_gbtrf(m, n, kl, ku)); }
+
+    static double gbtrs(double n, double kl, double ku, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_gbtrs(n, kl, ku, nrhs) + add_ops*fadds_gbtrs(n, kl, ku, nrhs)); }
+
+    static double gtsv(double n, double nrhs)
+        { return gttrf(n) + gttrs(n, nrhs); }
+
+    static double gttrf(double n)
+        { return 1e-9 * (mul_ops*fmuls_gttrf(n) + add_ops*fadds_gttrf(n)); }
+
+    static double gttrs(double n, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_gttrs(n, nrhs) + add_ops*fadds_gttrs(n, nrhs)); }
+
+    // least squares, assuming full rank
+    static double getsls(double m, double n, double nrhs)
+        { return gels(m, n, nrhs); }
+
+    static double gelsy(double m, double n, double nrhs)
+    {
+        // QR with column pivoting, plus, for m < n, tzrzf and ormrz.
+        blas::Side left = blas::Side::Left;
+        double k = std::min(m, n);
+        double flops = geqrf(m, n) + unmqr(left, m, nrhs, k)
+                     + blas::Gflop<T>::trsm(left, k, nrhs);
+        if (n > m)
+            flops += gerqf(m, n) - gerqf(m, m) + unmrq(left, n, nrhs, m);
+        return flops;
+    }
+
+    static double gelss(double m, double n, double nrhs)
+    {
+        // SVD with V, U^H B, and V (Sigma^+ U^H B).
+        double k = std::min(m, n);
+        return gesvd(lapack::Job::NoVec, lapack::Job::OverwriteVec, m, n)
+             + unmqr(blas::Side::Left, m, nrhs, k)
+             + blas::Gflop<T>::gemm(n, nrhs, k);
+    }
+
+    static double gelsd(double m, double n, double nrhs)
+    {
+        // Bidiagonal reduction, and applying its Q and P to B.
+        // Omits lalsd's bidiagonal solve, and counts the direct path
+        // even when LAPACK first reduces by QR or LQ.
+        blas::Side left = blas::Side::Left;
+        double k = std::min(m, n);
+        return gebrd(m, n) + unmqr(left, m, nrhs, k) + unmlq(left, n, nrhs, k);
+    }
+
+    // symmetric eigenvalues
+    static double heev(lapack::Job jobz, double n)
+    {
+        if (jobz == lapack::Job::NoVec)
+            return hetrd(n);
+        return hetrd(n) + ungqr(n, n, n)
+             + 1e-9 * (mul_ops*fmuls_steqr(n) + add_ops*fadds_steqr(n));
+    }
+
+    static double heevd(lapack::Job jobz, double n)
+    {
+        if (jobz == lapack::Job::NoVec)
+            return hetrd(n);
+        return hetrd(n) + unmqr(blas::Side::Left, n, n, n)
+             + 1e-9 * (mul_ops*fmuls_stedc(n) + add_ops*fadds_stedc(n));
+    }
+
+    // nfound is the number of eigenvalues found.
+    static double heevr(lapack::Job jobz, double n, double nfound)
+    {
+        if (jobz == lapack::Job::NoVec)
+            return hetrd(n);
+        return hetrd(n) + unmqr(blas::Side::Left, n, nfound, n);
+    }
+
+    static double heevx(lapack::Job jobz, double n, double nfound)
+        { return heevr(jobz, n, nfound); }
+
+    static double hbev(lapack::Job jobz, double n, double kd)
+    {
+        double flops = 1e-9 * (mul_ops*fmuls_hbtrd(jobz, n, kd) + add_ops*fadds_hbtrd(jobz, n, kd));
+        if (jobz != lapack::Job::NoVec)
+            flops += 1e-9 * (mul_ops*fmuls_steqr(n) + add_ops*fadds_steqr(n));
+        return flops;
+    }
+
+    static double hbevd(lapack::Job jobz, double n, double kd)
+    {
+        double flops = 1e-9 * (mul_ops*fmuls_hbtrd(jobz, n, kd) + add_ops*fadds_hbtrd(jobz, n, kd));
+        if (jobz != lapack::Job::NoVec)
+            flops += 1e-9 * (mul_ops*fmuls_stedc(n) + add_ops*fadds_stedc(n))
+                  +  blas::Gflop<T>::gemm(n, n, n);
+        return flops;
+    }
+
+    static double hbevx(lapack::Job jobz, double n, double kd, double nfound)
+    {
+        double flops = 1e-9 * (mul_ops*fmuls_hbtrd(jobz, n, kd) + add_ops*fadds_hbtrd(jobz, n, kd));
+        if (jobz != lapack::Job::NoVec)
+            flops += blas::Gflop<T>::gemm(n, nfound, n);
+        return flops;
+    }
+
+    static double hpev(lapack::Job jobz, double n)
+        { return heev(jobz, n); }
+
+    static double hpevd(lapack::Job jobz, double n)
+        { return heevd(jobz, n); }
+
+    static double hpevx(lapack::Job jobz, double n, double nfound)
+        { return heevx(jobz, n, nfound); }
+
+    static double syev(lapack::Job jobz, double n)
+        { return heev(jobz, n); }
+
+    static double syevd(lapack::Job jobz, double n)
+        { return heevd(jobz, n); }
+
+    static double syevr(lapack::Job jobz, double n, double nfound)
+        { return heevr(jobz, n, nfound); }
+
+    static double syevx(lapack::Job jobz, double n, double nfound)
+        { return heevx(jobz, n, nfound); }
+
+    // 2-stage tridiagonal reduction has the same leading cost as hetrd.
+    static double heev_2stage(lapack::Job jobz, double n)
+        { return heev(jobz, n); }
+
+    static double heevd_2stage(lapack::Job jobz, double n)
+        { return heevd(jobz, n); }
+
+    static double heevr_2stage(lapack::Job jobz, double n, double nfound)
+        { return heevr(jobz, n, nfound); }
+
+    static double heevx_2stage(lapack::Job jobz, double n, double nfound)
+        { return heevx(jobz, n, nfound); }
+
+    static double syev_2stage(lapack::Job jobz, double n)
+        { return heev(jobz, n); }
+
+    static double syevd_2stage(lapack::Job jobz, double n)
+        { return heevd(jobz, n); }
+
+    static double syevr_2stage(lapack::Job jobz, double n, double nfound)
+        { return heevr(jobz, n, nfound); }
+
+    static double syevx_2stage(lapack::Job jobz, double n, double nfound)
+        { return heevx(jobz, n, nfound); }
+
+    // non-symmetric eigenvalues
+    static double geev(lapack::Job jobvl, lapack::Job jobvr, double n)
+    {
+        bool wantvl = (jobvl != lapack::Job::NoVec);
+        bool wantvr = (jobvr != lapack::Job::NoVec);
+        lapack::Job compz = (wantvl || wantvr ? lapack::Job::Vec : lapack::Job::NoVec);
+        double flops = gehrd(n)
+                     + 1e-9 * (mul_ops*fmuls_hseqr(compz, n) + add_ops*fadds_hseqr(compz, n));
+        if (wantvl || wantvr)
+            flops += ungqr(n, n, n);
+        double sides = (wantvl ? 1 : 0) + (wantvr ? 1 : 0);
+        flops += sides * 1e-9 * (mul_ops*fmuls_trevc(n) + add_ops*fadds_trevc(n));
+        return flops;
+    }
+
+    // SVD
+    static double gesvd(lapack::Job jobu, lapack::Job jobvt, double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_gesvd(jobu, jobvt, m, n) + add_ops*fadds_gesvd(jobu, jobvt, m, n)); }
+
+    static double gesdd(lapack::Job jobz, double m, double n)
+    {
+        // Bidiagonal reduction, with QR first when m >= 11/6 n as LAPACK does;
+        // with vectors, bdsdc and back transformation. Thin U is
+        // jobz = SomeVec or OverwriteVec; full U is jobz = AllVec.
+        if (m < n)
+            return gesdd(jobz, n, m);
+        bool wantvec = (jobz != lapack::Job::NoVec);
+        bool fullu   = (jobz == lapack::Job::AllVec);
+        blas::Side left  = blas::Side::Left;
+        blas::Side right = blas::Side::Right;
+        double bdsdc = 2e-9 * (mul_ops*fmuls_stedc(n) + add_ops*fadds_stedc(n));
+        if (m >= 11/6.*n) {
+            double flops = geqrf(m, n) + gebrd(n, n);
+            if (wantvec) {
+                flops += bdsdc + unmqr(left, n, n, n) + unmlq(right, n, n, n)
+                      +  (fullu ? ungqr(m, m, n) : ungqr(m, n, n))
+                      +  blas::Gflop<T>::gemm(m, n, n);
+            }
+            return flops;
+        }
+        else {
+            double flops = gebrd(m, n);
+            if (wantvec) {
+                flops += bdsdc + unmlq(right, n, n, n)
+                      +  (fullu ? unmqr(left, m, m, n) : unmqr(left, m, n, n));
+            }
+            return flops;
+        }
+    }
+
+    // ns is the number of singular values found.
+    static double gesvdx(lapack::Job jobu, lapack::Job jobvt,
+                         double m, double n, double ns)
+    {
+        // Bidiagonal reduction, with QR first when m >= 1.6 n;
+        // with vectors, back transformation of ns vectors.
+        // Omits bdsvdx.
+        if (m < n)
+            return gesvdx(jobvt, jobu, n, m, ns);
+        bool wantu = (jobu  != lapack::Job::NoVec);
+        bool wantv = (jobvt != lapack::Job::NoVec);
+        blas::Side left  = blas::Side::Left;
+        blas::Side right = blas::Side::Right;
+        double flops = 0;
+        if (m >= 1.6*n) {
+            flops += geqrf(m, n) + gebrd(n, n);
+            if (wantu)
+                flops += unmqr(left, n, ns, n) + unmqr(left, m, ns, n);
+        }
+        else {
+            flops += gebrd(m, n);
+            if (wantu)
+                flops += unmqr(left, m, ns, n);
+        }
+        if (wantv)
+            flops += unmlq(right, ns, n, n);
+        return flops;
+    }
 };
 
 }  // namespace lapack
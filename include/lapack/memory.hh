@@ -0,0 +1,222 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MEMORY_HH
+#define LAPACK_MEMORY_HH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Page size to request for large work arrays.
+/// @ingroup auxiliary
+enum class HugePages {
+    None,           ///< default pages
+    Transparent,    ///< madvise( MADV_HUGEPAGE ) on a 2 MiB aligned mapping
+    Explicit,       ///< mmap( MAP_HUGETLB ) from the reserved huge page pool,
+                    ///< falling back to Transparent if none are available
+};
+
+//------------------------------------------------------------------------------
+/// NUMA placement of large work arrays.
+/// @ingroup auxiliary
+enum class Numa {
+    Default,        ///< OS default, usually first touch
+    Interleave,     ///< pages interleaved across all allowed nodes
+    Local,          ///< pages on the node of the thread that touches them
+};
+
+//------------------------------------------------------------------------------
+/// Policy for allocating the work arrays used inside LAPACK++ wrappers,
+/// i.e., lapack::vector and Workspace arenas.
+///
+/// Arrays of at least huge_threshold bytes are mapped directly with mmap
+/// when huge_pages or numa is set, so the page size and NUMA policy apply
+/// to them alone. Smaller arrays, and all arrays on systems without mmap,
+/// are allocated with posix_memalign, aligned to alignment.
+///
+/// Example, for multi-GB gesdd or syevd workspaces on a 2-socket node:
+///
+///     lapack::AllocPolicy policy;
+///     policy.huge_pages = lapack::HugePages::Transparent;
+///     policy.numa       = lapack::Numa::Interleave;
+///     lapack::set_alloc_policy( policy );
+///
+/// @ingroup auxiliary
+struct AllocPolicy
+{
+    /// Alignment in bytes; a power of 2, at least 64.
+    size_t alignment = 64;
+
+    HugePages huge_pages = HugePages::None;
+    Numa numa = Numa::Default;
+
+    /// Arrays smaller than this many bytes ignore huge_pages and numa.
+    size_t huge_threshold = size_t( 4 ) << 20;
+};
+
+/// Sets the policy for all threads that don't have an AllocPolicyScope.
+/// Throws Error if alignment isn't a power of 2 that is at least 64.
+/// @ingroup auxiliary
+void set_alloc_policy( AllocPolicy const& policy );
+
+/// @return policy in effect on this thread: the innermost AllocPolicyScope,
+/// if any, otherwise the policy set by set_alloc_policy.
+/// Doesn't take a lock, since it is called for every allocation.
+/// @ingroup auxiliary
+AllocPolicy get_alloc_policy();
+
+//------------------------------------------------------------------------------
+/// Overrides the allocation policy on this thread until the scope ends,
+/// e.g., for a single call. Scopes nest.
+///
+/// Example:
+///
+///     {
+///         lapack::AllocPolicy policy = lapack::get_alloc_policy();
+///         policy.huge_pages = lapack::HugePages::Explicit;
+///         lapack::AllocPolicyScope scope( policy );
+///         lapack::gesdd( ... );
+///     }
+///
+/// @ingroup auxiliary
+class AllocPolicyScope
+{
+public:
+    explicit AllocPolicyScope( AllocPolicy const& policy );
+    ~AllocPolicyScope();
+
+    AllocPolicyScope( AllocPolicyScope const& ) = delete;
+    AllocPolicyScope& operator = ( AllocPolicyScope const& ) = delete;
+
+private:
+    AllocPolicy const* prev_;
+    AllocPolicy policy_;
+};
+
+//------------------------------------------------------------------------------
+/// Interface for user allocators of the work arrays used inside LAPACK++
+/// wrappers, e.g., to route them through an application's memory pool.
+/// An allocator may be called from many threads at once, so it must be
+/// thread safe.
+///
+/// Each lapack::vector and Workspace holds the allocator that was in
+/// effect when it was constructed, and returns its memory to that
+/// allocator, even if the allocator is changed in the meantime.
+/// The allocator must outlive them.
+///
+/// @ingroup auxiliary
+class Allocator
+{
+public:
+    virtual ~Allocator() = default;
+
+    /// @return pointer to bytes of uninitialized memory, aligned to
+    /// alignment, a power of 2 that is at least 64.
+    /// On failure, throws, e.g., std::bad_alloc.
+    virtual void* allocate( size_t bytes, size_t alignment ) = 0;
+
+    /// Frees ptr from allocate( bytes, alignment ).
+    virtual void deallocate( void* ptr, size_t bytes ) noexcept = 0;
+};
+
+/// Sets the allocator for all threads that don't have an AllocatorScope.
+/// set_allocator( nullptr ) restores the default allocator, which follows
+/// the AllocPolicy.
+/// @ingroup auxiliary
+void set_allocator( Allocator* allocator );
+
+/// @return allocator in effect on this thread: the innermost AllocatorScope,
+/// if any, otherwise the allocator set by set_allocator, otherwise the
+/// default allocator. Never null.
+/// @ingroup auxiliary
+Allocator* get_allocator();
+
+//------------------------------------------------------------------------------
+/// Overrides the allocator on this thread until the scope ends,
+/// e.g., for one request. Scopes nest.
+///
+/// Example, with a 1 GiB cap per request:
+///
+///     lapack::LimitAllocator limit( 1 << 30 );
+///     {
+///         lapack::AllocatorScope scope( &limit );
+///         lapack::gesdd( ... );  // throws std::bad_alloc if over 1 GiB
+///     }
+///     printf( "peak %lu bytes\n", limit.peak() );
+///
+/// @ingroup auxiliary
+class AllocatorScope
+{
+public:
+    explicit AllocatorScope( Allocator* allocator );
+    ~AllocatorScope();
+
+    AllocatorScope( AllocatorScope const& ) = delete;
+    AllocatorScope& operator = ( AllocatorScope const& ) = delete;
+
+private:
+    Allocator* prev_;
+};
+
+//------------------------------------------------------------------------------
+/// Allocator that tracks bytes in use and their high-water mark, and
+/// fails allocations that would exceed a limit. It forwards allocations
+/// to the allocator in effect when it was constructed.
+///
+/// @ingroup auxiliary
+class LimitAllocator: public Allocator
+{
+public:
+    /// @param[in] limit
+    ///     Maximum bytes in use at once. Allocations beyond it throw
+    ///     std::bad_alloc. The default is no limit.
+    explicit LimitAllocator( size_t limit = size_t( -1 ) );
+
+    void* allocate( size_t bytes, size_t alignment ) override;
+    void deallocate( void* ptr, size_t bytes ) noexcept override;
+
+    /// @return bytes currently allocated.
+    size_t used() const { return used_.load(); }
+
+    /// @return largest number of bytes allocated at once.
+    size_t peak() const { return peak_.load(); }
+
+    size_t limit() const { return limit_; }
+
+private:
+    Allocator* upstream_;
+    size_t limit_;
+    std::atomic< size_t > used_;
+    std::atomic< size_t > peak_;
+};
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+/// Allocates bytes of uninitialized memory according to the current
+/// AllocPolicy. Throws std::bad_alloc on failure.
+/// This is the default allocator.
+void* allocate( size_t bytes );
+
+/// Allocates bytes of uninitialized memory according to policy.
+/// Throws std::bad_alloc on failure.
+void* allocate( size_t bytes, AllocPolicy const& policy );
+
+/// Allocates bytes with allocator, reading the AllocPolicy once:
+/// the default allocator follows all of it; other allocators get its
+/// alignment. Used by lapack::vector and Workspace.
+void* allocate( Allocator* allocator, size_t bytes );
+
+/// Frees memory from allocate. bytes must match the allocation.
+void deallocate( void* ptr, size_t bytes ) noexcept;
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_MEMORY_HH
@@ -0,0 +1,693 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SAFE_SCALING_HH
+#define LAPACK_SAFE_SCALING_HH
+
+#include "lapack.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <limits>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Header-only lapy2, lapy3, lartg, and lassq, using the safe scaling
+// algorithms of LAPACK 3.10 and later (Anderson, "Algorithm 978: Safe
+// scaling in the Level 1 BLAS", ACM TOMS 44(1), 2017). Values in a safe
+// range are used unscaled, and only the rest are scaled, so the common
+// case is a few flops with no call into Fortran.
+//
+// safe::lartg_batch and safe::lassq_batch apply them to arrays; their
+// inner loops vectorize. Results match the LAPACK routines to rounding
+// error, but not necessarily bitwise. There is no argument checking.
+namespace safe {
+
+namespace internal {
+
+// Partial sums per inner loop of sums of squares.
+const int64_t lanes = 8;
+
+// Values per chunk when gathering strided vectors, and per chunk of
+// batch kernels, so a chunk stays in L1 cache between passes.
+const int64_t chunk = 256;
+
+//------------------------------------------------------------------------------
+// @return true if x is NaN. Written as x != x, which compilers vectorize.
+template <typename real_t>
+inline bool isnan( real_t x )
+{
+    return x != x;
+}
+
+//------------------------------------------------------------------------------
+// Safe range constants, from la_constants.f90.
+template <typename real_t>
+struct Constants
+{
+    using limits = std::numeric_limits< real_t >;
+
+    // Smallest normalized number, whose reciprocal doesn't overflow.
+    static real_t safmin() { return limits::min(); }
+    static real_t safmax() { return 1 / limits::min(); }
+
+    // Squares of values in (rtmin, rtmax) neither underflow nor overflow,
+    // nor does the sum of two of them.
+    static real_t rtmin() { return std::sqrt( safmin() ); }
+    static real_t rtmax() { return std::sqrt( safmax() / 2 ); }
+};
+
+//------------------------------------------------------------------------------
+// Scaled sum of squares, using the three accumulators of Blue's algorithm,
+// as in the reference lassq and nrm2 since LAPACK 3.10. Squares of values
+// above tbig are scaled down by sbig, squares of values below tsml are
+// scaled up by ssml, and all others are summed unscaled, so no sum
+// overflows or underflows unless the result does. Sums are in fixed
+// scales, so partial sums from different arrays add like numbers.
+template <typename real_t>
+struct SumSquares
+{
+    using limits = std::numeric_limits< real_t >;
+
+    // Blue's thresholds and scaling constants, from la_constants.f90.
+    // Integer division truncates toward zero, which is the ceiling for
+    // negative and the floor for positive quotients.
+    static real_t tsml()
+    {
+        // 2^ceil( (minexp - 1) / 2 )
+        return std::ldexp( real_t( 1 ), (limits::min_exponent - 1) / 2 );
+    }
+    static real_t tbig()
+    {
+        // 2^floor( (maxexp - digits + 1) / 2 )
+        return std::ldexp( real_t( 1 ),
+                           (limits::max_exponent - limits::digits + 1) / 2 );
+    }
+    static real_t ssml()
+    {
+        // 2^-floor( (minexp - digits) / 2 )
+        return std::ldexp( real_t( 1 ),
+                           -((limits::min_exponent - limits::digits - 1) / 2) );
+    }
+    static real_t sbig()
+    {
+        // 2^-ceil( (maxexp + digits - 1) / 2 )
+        return std::ldexp( real_t( 1 ),
+                           -((limits::max_exponent + limits::digits) / 2) );
+    }
+
+    real_t big = 0;  // sum of (x*sbig)^2 for |x| > tbig
+    real_t med = 0;  // sum of x^2
+    real_t sml = 0;  // sum of (x*ssml)^2 for |x| < tsml
+
+    //--------------------
+    void add( SumSquares const& other )
+    {
+        big += other.big;
+        med += other.med;
+        sml += other.sml;
+    }
+
+    //--------------------
+    // Adds x_i^2 for the n contiguous real values x, vectorized over lanes.
+    void add( int64_t n, real_t const* x )
+    {
+        const int64_t L = lanes;
+        const real_t tsml_ = tsml(), tbig_ = tbig();
+
+        // Usually max |x_i| is in [tsml/eps, tbig], so x_i^2 can't overflow,
+        // and values whose squares would underflow are below rounding
+        // error of the sum, so only med changes. Otherwise, redo x with
+        // scaling. NaN isn't in the max, but propagates in med.
+        real_t m[ L ] = {}, v[ L ] = {};
+        int64_t i = 0;
+        for (; i + L <= n; i += L) {
+            for (int64_t l = 0; l < L; ++l) {
+                real_t a = std::abs( x[ i + l ] );
+                m[ l ] += a*a;
+                v[ l ] = a > v[ l ] ? a : v[ l ];
+            }
+        }
+        for (; i < n; ++i) {
+            real_t a = std::abs( x[ i ] );
+            m[ 0 ] += a*a;
+            v[ 0 ] = a > v[ 0 ] ? a : v[ 0 ];
+        }
+        real_t amax = 0;
+        for (int64_t l = 0; l < L; ++l)
+            amax = v[ l ] > amax ? v[ l ] : amax;
+
+        if (amax <= tbig_ && amax >= tsml_ / limits::epsilon()) {
+            for (int64_t l = 0; l < L; ++l)
+                med += m[ l ];
+        }
+        else {
+            add_scaled( n, x );
+        }
+    }
+
+    //--------------------
+    // Adds x_i^2 for the n contiguous real values x, scaling each value
+    // into the accumulator for its range.
+    void add_scaled( int64_t n, real_t const* x )
+    {
+        const int64_t L = lanes;
+        const real_t tsml_ = tsml(), tbig_ = tbig();
+        const real_t ssml_ = ssml(), sbig_ = sbig();
+        real_t b[ L ] = {}, m[ L ] = {}, s[ L ] = {};
+
+        int64_t i = 0;
+        for (; i + L <= n; i += L) {
+            for (int64_t l = 0; l < L; ++l) {
+                real_t a  = std::abs( x[ i + l ] );
+                real_t ab = a * sbig_;
+                real_t as = a * ssml_;
+                bool is_big = a > tbig_;
+                bool is_sml = a < tsml_;
+                b[ l ] += is_big ? ab*ab : real_t( 0 );
+                s[ l ] += is_sml ? as*as : real_t( 0 );
+                m[ l ] += (is_big | is_sml) ? real_t( 0 ) : a*a;
+            }
+        }
+        for (; i < n; ++i) {
+            real_t a = std::abs( x[ i ] );
+            if (a > tbig_)
+                b[ 0 ] += (a * sbig_) * (a * sbig_);
+            else if (a < tsml_)
+                s[ 0 ] += (a * ssml_) * (a * ssml_);
+            else
+                m[ 0 ] += a*a;  // NaN lands here
+        }
+        for (int64_t l = 0; l < L; ++l) {
+            big += b[ l ];
+            med += m[ l ];
+            sml += s[ l ];
+        }
+    }
+
+    // Complex values count as two real values.
+    void add( int64_t n, std::complex< real_t > const* x )
+    {
+        add( 2*n, reinterpret_cast< real_t const* >( x ) );
+    }
+
+    //--------------------
+    // Adds x_i^2 for the n values x with stride incx, gathered in chunks
+    // to use the contiguous kernel. The sign of incx doesn't matter.
+    template <typename scalar_t>
+    void add( int64_t n, scalar_t const* x, int64_t incx )
+    {
+        if (incx == 1) {
+            add( n, x );
+            return;
+        }
+        incx = std::abs( incx );
+        scalar_t buffer[ chunk ];
+        for (int64_t i = 0; i < n; i += chunk) {
+            int64_t nb = std::min( chunk, n - i );
+            for (int64_t k = 0; k < nb; ++k)
+                buffer[ k ] = x[ (i + k)*incx ];
+            add( nb, buffer );
+        }
+    }
+
+    //--------------------
+    // Adds scale^2 sumsq, an existing sum of squares from lassq,
+    // into the accumulator for its range, as in the reference lassq.
+    void add_sumsq( real_t scale, real_t sumsq )
+    {
+        if (! (sumsq > 0))
+            return;
+        real_t ax = scale * std::sqrt( sumsq );
+        if (ax > tbig()) {
+            if (scale > 1) {
+                scale *= sbig();
+                big += scale * (scale * sumsq);
+            }
+            else {
+                // sumsq > tbig^2, so sbig^2 sumsq is representable
+                big += scale * (scale * (sbig() * (sbig() * sumsq)));
+            }
+        }
+        else if (ax < tsml()) {
+            if (scale < 1) {
+                scale *= ssml();
+                sml += scale * (scale * sumsq);
+            }
+            else {
+                sml += scale * (scale * (ssml() * (ssml() * sumsq)));
+            }
+        }
+        else {
+            med += scale * (scale * sumsq);
+        }
+    }
+
+    //--------------------
+    // Combines accumulators as in the reference lassq, into scale and
+    // sumsq such that scale^2 sumsq is the sum of squares.
+    void get( real_t* scale, real_t* sumsq ) const
+    {
+        if (big > 0) {
+            // combine big and med, if med > 0 or NaN
+            real_t b = big;
+            if (med > 0 || isnan( med ))
+                b += (med * sbig()) * sbig();
+            *scale = 1 / sbig();
+            *sumsq = b;
+        }
+        else if (sml > 0) {
+            // combine med and sml, if med > 0 or NaN
+            if (med > 0 || isnan( med )) {
+                real_t ymed = std::sqrt( med );
+                real_t ysml = std::sqrt( sml ) / ssml();
+                real_t ymin = (ysml > ymed ? ymed : ysml);
+                real_t ymax = (ysml > ymed ? ysml : ymed);
+                *scale = 1;
+                *sumsq = ymax*ymax * (1 + (ymin/ymax)*(ymin/ymax));
+            }
+            else {
+                *scale = 1 / ssml();
+                *sumsq = sml;
+            }
+        }
+        else {
+            *scale = 1;
+            *sumsq = med;
+        }
+    }
+
+    //--------------------
+    // @return sqrt of the sum of squares, as in the reference nrm2.
+    real_t norm() const
+    {
+        real_t scale, sumsq;
+        get( &scale, &sumsq );
+        return scale * std::sqrt( sumsq );
+    }
+};
+
+//------------------------------------------------------------------------------
+// sqrt vectorizes only if it doesn't set errno, e.g., with -fno-math-errno,
+// which -ffast-math implies. Otherwise, the batch kernels loop over the
+// scalar kernels, which is faster than a scalar two-pass loop.
+#if defined( __NO_MATH_ERRNO__ )
+    const bool simd_sqrt = true;
+#else
+    const bool simd_sqrt = false;
+#endif
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Returns $\sqrt{ x^2 + y^2 },$ taking care not to cause unnecessary
+/// overflow or underflow. If x or y is NaN, returns NaN.
+/// Same as lapack::lapy2, but inline.
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline real_t lapy2( real_t x, real_t y )
+{
+    using C = internal::Constants< real_t >;
+
+    if (internal::isnan( x ))
+        return x;
+    if (internal::isnan( y ))
+        return y;
+
+    real_t xabs = std::abs( x );
+    real_t yabs = std::abs( y );
+    real_t w = (xabs > yabs ? xabs : yabs);
+    real_t z = (xabs > yabs ? yabs : xabs);
+    if (z == 0 || w > std::numeric_limits< real_t >::max())
+        return w;
+    if (z > C::rtmin() && w < C::rtmax())
+        return std::sqrt( x*x + y*y );
+    return w * std::sqrt( 1 + (z/w)*(z/w) );
+}
+
+//------------------------------------------------------------------------------
+/// Returns $\sqrt{ x^2 + y^2 + z^2 },$ taking care not to cause
+/// unnecessary overflow or underflow. If x, y, or z is NaN, returns NaN.
+/// Same as lapack::lapy3, but inline.
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline real_t lapy3( real_t x, real_t y, real_t z )
+{
+    using C = internal::Constants< real_t >;
+
+    real_t xabs = std::abs( x );
+    real_t yabs = std::abs( y );
+    real_t zabs = std::abs( z );
+    real_t w = std::max( xabs, std::max( yabs, zabs ) );
+    if (w == 0 || ! (w <= std::numeric_limits< real_t >::max())) {
+        // w can be Inf or NaN; the sum is Inf or NaN, too
+        return xabs + yabs + zabs;
+    }
+    if (w > C::rtmin() && w < C::rtmax() / 2)
+        return std::sqrt( x*x + y*y + z*z );
+    return w * std::sqrt( (xabs/w)*(xabs/w) + (yabs/w)*(yabs/w)
+                          + (zabs/w)*(zabs/w) );
+}
+
+//------------------------------------------------------------------------------
+/// Generates a plane rotation so that
+/// \[
+///     \begin{bmatrix} c & s \\ -s & c \end{bmatrix}
+///     \begin{bmatrix} f \\ g \end{bmatrix}
+///     =
+///     \begin{bmatrix} r \\ 0 \end{bmatrix},
+/// \]
+/// where $c^2 + s^2 = 1$. Same as lapack::lartg from LAPACK 3.10,
+/// but inline: if g = 0, then c = 1 and s = 0; if f = 0 and g != 0,
+/// then c = 0 and s = sign(g). r has the sign of f.
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline void lartg(
+    real_t f, real_t g,
+    real_t* c, real_t* s, real_t* r )
+{
+    using C = internal::Constants< real_t >;
+    const real_t rtmin = C::rtmin();
+    const real_t rtmax = C::rtmax();
+
+    real_t f1 = std::abs( f );
+    real_t g1 = std::abs( g );
+    if (g == 0) {
+        *c = 1;
+        *s = 0;
+        *r = f;
+    }
+    else if (f == 0) {
+        *c = 0;
+        *s = std::copysign( real_t( 1 ), g );
+        *r = g1;
+    }
+    else if (f1 > rtmin && f1 < rtmax && g1 > rtmin && g1 < rtmax) {
+        real_t d = std::sqrt( f*f + g*g );
+        *c = f1 / d;
+        *r = std::copysign( d, f );
+        *s = g / *r;
+    }
+    else {
+        real_t u = std::min( C::safmax(),
+                             std::max( C::safmin(), std::max( f1, g1 ) ) );
+        real_t fs = f / u;
+        real_t gs = g / u;
+        real_t d = std::sqrt( fs*fs + gs*gs );
+        *c = std::abs( fs ) / d;
+        real_t rs = std::copysign( d, f );
+        *s = gs / rs;
+        *r = rs * u;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Generates a plane rotation so that
+/// \[
+///     \begin{bmatrix} c & s \\ -\bar{s} & c \end{bmatrix}
+///     \begin{bmatrix} f \\ g \end{bmatrix}
+///     =
+///     \begin{bmatrix} r \\ 0 \end{bmatrix},
+/// \]
+/// where c is real and $c^2 + |s|^2 = 1$. Same as lapack::lartg from
+/// LAPACK 3.10, but inline: if g = 0, then c = 1 and s = 0; if f = 0 and
+/// g != 0, then c = 0 and r is real.
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline void lartg(
+    std::complex< real_t > f, std::complex< real_t > g,
+    real_t* c, std::complex< real_t >* s, std::complex< real_t >* r )
+{
+    using C = internal::Constants< real_t >;
+    const real_t safmin = C::safmin();
+    const real_t safmax = C::safmax();
+    const real_t rtmin  = C::rtmin();
+    const real_t rtmax  = C::rtmax();
+
+    real_t fr = real( f ), fi = imag( f );
+    real_t gr = real( g ), gi = imag( g );
+    real_t g1 = std::max( std::abs( gr ), std::abs( gi ) );
+    if (g1 == 0) {
+        *c = 1;
+        *s = 0;
+        *r = f;
+    }
+    else if (fr == 0 && fi == 0) {
+        *c = 0;
+        real_t u = 1;
+        if (! (g1 > rtmin && g1 < rtmax)) {
+            u  = std::min( safmax, std::max( safmin, g1 ) );
+            gr = gr / u;
+            gi = gi / u;
+        }
+        real_t d = std::sqrt( gr*gr + gi*gi );
+        *s = std::complex< real_t >( gr / d, -gi / d );
+        *r = d * u;
+    }
+    else {
+        real_t f1 = std::max( std::abs( fr ), std::abs( fi ) );
+        real_t u = 1, w = 1;
+        if (! (f1 > rtmin && f1 < rtmax/2 && g1 > rtmin && g1 < rtmax/2)) {
+            u  = std::min( safmax, std::max( safmin, std::max( f1, g1 ) ) );
+            gr = gr / u;
+            gi = gi / u;
+            if (f1 / u < rtmin) {
+                // f is not well scaled when scaled by g1; use another scale
+                real_t v = std::min( safmax, std::max( safmin, f1 ) );
+                w  = v / u;
+                fr = fr / v;
+                fi = fi / v;
+            }
+            else {
+                // otherwise use the same scale for f and g
+                fr = fr / u;
+                fi = fi / u;
+            }
+        }
+        real_t f2 = fr*fr + fi*fi;
+        real_t g2 = gr*gr + gi*gi;
+        real_t h2 = f2*w*w + g2;
+        real_t d = (f2 > rtmin && h2 < rtmax)
+                 ? std::sqrt( f2*h2 )
+                 : std::sqrt( f2 ) * std::sqrt( h2 );
+        real_t p = 1 / d;
+        *c = (f2 * p) * w;
+        // s = conj( g ) * (f * p) and r = f * (h2 * p) * u, with complex
+        // products written out, since std::complex checks for NaN
+        real_t q = h2 * p;
+        *s = std::complex< real_t >( gr*(fr*p) + gi*(fi*p),
+                                     gr*(fi*p) - gi*(fr*p) );
+        *r = std::complex< real_t >( (fr*q) * u, (fi*q) * u );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates a scaled sum of squares, so on exit
+/// \[
+///     scale^2 sumsq = x_1^2 + \dots + x_n^2 + scale_{in}^2 sumsq_{in},
+/// \]
+/// where complex $x_i$ count as $real(x_i)^2 + imag(x_i)^2$.
+/// Same as lapack::lassq from LAPACK 3.10, but inline. If scale or sumsq
+/// is NaN on entry, they are unchanged. Contiguous x (incx = 1) is summed
+/// with vectorized loops.
+///
+/// @ingroup auxiliary
+template <typename scalar_t>
+inline void lassq(
+    int64_t n,
+    scalar_t const* x, int64_t incx,
+    blas::real_type< scalar_t >* scale,
+    blas::real_type< scalar_t >* sumsq )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (internal::isnan( *scale ) || internal::isnan( *sumsq ))
+        return;
+    if (*sumsq == 0)
+        *scale = 1;
+    if (*scale == 0) {
+        *scale = 1;
+        *sumsq = 0;
+    }
+    if (n <= 0)
+        return;
+
+    internal::SumSquares< real_t > sum;
+    sum.add( n, x, incx );
+    sum.add_sumsq( *scale, *sumsq );
+    sum.get( scale, sumsq );
+}
+
+//------------------------------------------------------------------------------
+/// Generates plane rotations for n pairs (f_i, g_i), as safe::lartg does
+/// for each pair. For each chunk of pairs, a vectorized loop does the
+/// common case, where all values are in the safe range; other pairs are
+/// then redone one at a time. Arrays c, s, and r must not overlap f or g.
+///
+/// Vectorizing needs sqrt that doesn't set errno, e.g., -fno-math-errno;
+/// otherwise this loops over safe::lartg.
+///
+/// @param[in] n
+///     The number of rotations.
+///
+/// @param[in] f
+///     The vector f of length n.
+///
+/// @param[in] g
+///     The vector g of length n.
+///
+/// @param[out] c
+///     The vector c of length n. The cosines.
+///
+/// @param[out] s
+///     The vector s of length n. The sines.
+///
+/// @param[out] r
+///     The vector r of length n. The rotated values.
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline void lartg_batch(
+    int64_t n,
+    real_t const* f, real_t const* g,
+    real_t* c, real_t* s, real_t* r )
+{
+    using C = internal::Constants< real_t >;
+    const real_t rtmin = C::rtmin();
+    const real_t rtmax = C::rtmax();
+
+    if (! internal::simd_sqrt) {
+        for (int64_t i = 0; i < n; ++i)
+            lartg( f[ i ], g[ i ], &c[ i ], &s[ i ], &r[ i ] );
+        return;
+    }
+
+    for (int64_t i0 = 0; i0 < n; i0 += internal::chunk) {
+        int64_t i1 = std::min( i0 + internal::chunk, n );
+        for (int64_t i = i0; i < i1; ++i) {
+            real_t fi = f[ i ];
+            real_t gi = g[ i ];
+            real_t d  = std::sqrt( fi*fi + gi*gi );
+            real_t ri = std::copysign( d, fi );
+            c[ i ] = std::abs( fi ) / d;
+            s[ i ] = gi / ri;
+            r[ i ] = ri;
+        }
+        for (int64_t i = i0; i < i1; ++i) {
+            real_t f1 = std::abs( f[ i ] );
+            real_t g1 = std::abs( g[ i ] );
+            if (! (f1 > rtmin && f1 < rtmax && g1 > rtmin && g1 < rtmax))
+                lartg( f[ i ], g[ i ], &c[ i ], &s[ i ], &r[ i ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Generates complex plane rotations for n pairs (f_i, g_i), as
+/// safe::lartg does for each pair.
+/// @see lartg_batch( int64_t, real_t const*, real_t const*, ... )
+///
+/// @ingroup auxiliary
+template <typename real_t>
+inline void lartg_batch(
+    int64_t n,
+    std::complex< real_t > const* f, std::complex< real_t > const* g,
+    real_t* c, std::complex< real_t >* s, std::complex< real_t >* r )
+{
+    using C = internal::Constants< real_t >;
+    const real_t rtmin = C::rtmin();
+    const real_t rtmax = C::rtmax();
+
+    if (! internal::simd_sqrt) {
+        for (int64_t i = 0; i < n; ++i)
+            lartg( f[ i ], g[ i ], &c[ i ], &s[ i ], &r[ i ] );
+        return;
+    }
+
+    // complex arrays as interleaved real and imaginary parts
+    real_t const* fp = reinterpret_cast< real_t const* >( f );
+    real_t const* gp = reinterpret_cast< real_t const* >( g );
+    real_t* sp = reinterpret_cast< real_t* >( s );
+    real_t* rp = reinterpret_cast< real_t* >( r );
+
+    for (int64_t i0 = 0; i0 < n; i0 += internal::chunk) {
+        int64_t i1 = std::min( i0 + internal::chunk, n );
+        for (int64_t i = i0; i < i1; ++i) {
+            real_t fr = fp[ 2*i ], fi = fp[ 2*i + 1 ];
+            real_t gr = gp[ 2*i ], gi = gp[ 2*i + 1 ];
+            real_t f2 = fr*fr + fi*fi;
+            real_t h2 = f2 + gr*gr + gi*gi;
+            real_t p  = 1 / std::sqrt( f2*h2 );
+            real_t q  = h2 * p;
+            c[ i ] = f2 * p;
+            sp[ 2*i     ] = gr*(fr*p) + gi*(fi*p);
+            sp[ 2*i + 1 ] = gr*(fi*p) - gi*(fr*p);
+            rp[ 2*i     ] = fr*q;
+            rp[ 2*i + 1 ] = fi*q;
+        }
+        for (int64_t i = i0; i < i1; ++i) {
+            real_t fr = fp[ 2*i ], fi = fp[ 2*i + 1 ];
+            real_t gr = gp[ 2*i ], gi = gp[ 2*i + 1 ];
+            real_t f1 = std::max( std::abs( fr ), std::abs( fi ) );
+            real_t g1 = std::max( std::abs( gr ), std::abs( gi ) );
+            real_t f2 = fr*fr + fi*fi;
+            real_t h2 = f2 + gr*gr + gi*gi;
+            if (! (f1 > rtmin && f1 < rtmax/2 && g1 > rtmin && g1 < rtmax/2
+                   && f2 > rtmin && h2 < rtmax))
+                lartg( f[ i ], g[ i ], &c[ i ], &s[ i ], &r[ i ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates scaled sums of squares of the n columns of the m-by-n matrix A,
+/// as safe::lassq does for each column:
+/// \[
+///     scale_j^2 sumsq_j = \sum_i |A(i,j)|^2 + scale_{j,in}^2 sumsq_{j,in}.
+/// \]
+/// For instance, with scale = 0 and sumsq = 0 on entry, column norms are
+/// $scale_j \sqrt{ sumsq_j }.$
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] scale
+///     The vector scale of length n.
+///
+/// @param[in,out] sumsq
+///     The vector sumsq of length n.
+///
+/// @ingroup auxiliary
+template <typename scalar_t>
+inline void lassq_batch(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* scale,
+    blas::real_type< scalar_t >* sumsq )
+{
+    for (int64_t j = 0; j < n; ++j)
+        lassq( m, &A[ j*lda ], 1, &scale[ j ], &sumsq[ j ] );
+}
+
+}  // namespace safe
+}  // namespace lapack
+
+#endif // LAPACK_SAFE_SCALING_HH
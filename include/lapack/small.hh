@@ -0,0 +1,470 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SMALL_HH
+#define LAPACK_SMALL_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Kernels for tiny matrices, n <= small::max_n, with the size fixed at
+// compile time. Loop bounds are constants, so the compiler fully unrolls
+// and vectorizes them, and there is no argument checking, workspace, or
+// call into Fortran. Results match the LAPACK routines to rounding error,
+// but not necessarily bitwise.
+//
+// small::getrf< N >( A, lda, ipiv ) etc. take the size as a template
+// argument. small::getrf( n, A, lda, ipiv ) etc. dispatch at runtime to
+// the fixed-size kernel, or call the regular wrapper if n > max_n.
+namespace small {
+
+/// Largest n handled by the fixed-size kernels.
+constexpr int64_t max_n = 16;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return |real(x)| + |imag(x)|, as used by LAPACK to choose pivots.
+template <typename scalar_t>
+inline blas::real_type<scalar_t> abs1( scalar_t x )
+{
+    return std::abs( blas::real( x ) ) + std::abs( blas::imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// Calls func( std::integral_constant< int64_t, n >() ) for 1 <= n <= max_n.
+/// @return result of func.
+template <int64_t N, typename Func>
+inline int64_t dispatch( int64_t n, Func&& func )
+{
+    if constexpr (N > max_n) {
+        return 0;  // not reached
+    }
+    else {
+        if (n == N)
+            return func( std::integral_constant< int64_t, N >() );
+        return dispatch< N+1 >( n, func );
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of an N-by-N matrix A, with N fixed at
+/// compile time, using partial pivoting with row interchanges,
+/// \[
+///     A = P L U.
+/// \]
+/// Same as lapack::getrf with m = n = N, but without argument checks.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= max_n.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On exit, the factors L and U; the unit diagonal of L is not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[out] ipiv
+///     The vector ipiv of length N. The pivot indices;
+///     row i of the matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero.
+///
+/// @ingroup gesv_computational
+template <int64_t N, typename scalar_t>
+inline int64_t getrf( scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    static_assert( 1 <= N && N <= max_n, "small::getrf: N out of range" );
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+
+    int64_t info = 0;
+    for (int64_t j = 0; j < N; ++j) {
+        // find pivot in column j
+        int64_t p = j;
+        real_t amax = internal::abs1( A[ j + j*lda ] );
+        for (int64_t i = j+1; i < N; ++i) {
+            real_t a = internal::abs1( A[ i + j*lda ] );
+            if (a > amax) {
+                amax = a;
+                p = i;
+            }
+        }
+        ipiv[ j ] = p + 1;
+
+        if (A[ p + j*lda ] != zero) {
+            // swap rows j and p
+            if (p != j) {
+                for (int64_t k = 0; k < N; ++k)
+                    std::swap( A[ j + k*lda ], A[ p + k*lda ] );
+            }
+            // compute elements j+1:N-1 of column j
+            scalar_t ajj = A[ j + j*lda ];
+            if (std::abs( ajj ) >= sfmin) {
+                scalar_t rcp = one / ajj;
+                for (int64_t i = j+1; i < N; ++i)
+                    A[ i + j*lda ] *= rcp;
+            }
+            else {
+                for (int64_t i = j+1; i < N; ++i)
+                    A[ i + j*lda ] /= ajj;
+            }
+        }
+        else if (info == 0) {
+            info = j + 1;
+        }
+
+        // update trailing submatrix
+        for (int64_t k = j+1; k < N; ++k) {
+            scalar_t ajk = A[ j + k*lda ];
+            for (int64_t i = j+1; i < N; ++i)
+                A[ i + k*lda ] -= A[ i + j*lda ] * ajk;
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the inverse of an N-by-N matrix A, with N fixed at compile
+/// time, using the LU factorization computed by small::getrf.
+/// Same as lapack::getri with n = N, but without argument checks or
+/// workspace allocation.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= max_n.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On entry, the factors L and U from small::getrf.
+///     On successful exit, the inverse of the original matrix A.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[in] ipiv
+///     The pivot indices from small::getrf.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero; the matrix is
+///              singular and its inverse could not be computed.
+///
+/// @ingroup gesv_computational
+template <int64_t N, typename scalar_t>
+inline int64_t getri( scalar_t* A, int64_t lda, int64_t const* ipiv )
+{
+    static_assert( 1 <= N && N <= max_n, "small::getri: N out of range" );
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    for (int64_t j = 0; j < N; ++j) {
+        if (A[ j + j*lda ] == zero)
+            return j + 1;
+    }
+
+    // inv(U), column by column, as in trti2
+    for (int64_t j = 0; j < N; ++j) {
+        A[ j + j*lda ] = one / A[ j + j*lda ];
+        scalar_t ajj = -A[ j + j*lda ];
+        // A(0:j-1, j) = ajj * inv(U)(0:j-1, 0:j-1) * A(0:j-1, j);
+        // row i reads only rows i:j-1 of column j, so overwrite top down.
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t sum = zero;
+            for (int64_t k = i; k < j; ++k)
+                sum += A[ i + k*lda ] * A[ k + j*lda ];
+            A[ i + j*lda ] = ajj * sum;
+        }
+    }
+
+    // solve inv(A) L = inv(U) for inv(A)
+    scalar_t work[ N ];
+    for (int64_t j = N-2; j >= 0; --j) {
+        for (int64_t i = j+1; i < N; ++i) {
+            work[ i ] = A[ i + j*lda ];
+            A[ i + j*lda ] = zero;
+        }
+        for (int64_t k = j+1; k < N; ++k) {
+            scalar_t wk = work[ k ];
+            for (int64_t i = 0; i < N; ++i)
+                A[ i + j*lda ] -= A[ i + k*lda ] * wk;
+        }
+    }
+
+    // apply column interchanges
+    for (int64_t j = N-2; j >= 0; --j) {
+        int64_t p = ipiv[ j ] - 1;
+        if (p != j) {
+            for (int64_t i = 0; i < N; ++i)
+                std::swap( A[ i + j*lda ], A[ i + p*lda ] );
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of an N-by-N Hermitian positive
+/// definite matrix A, with N fixed at compile time,
+/// \[
+///     A = U^H U  \text{ or }  A = L L^H.
+/// \]
+/// Same as lapack::potrf with n = N, but without argument checks.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= max_n.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On successful exit, the factor U or L.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///              positive definite, and the factorization could not be
+///              completed.
+///
+/// @ingroup posv_computational
+template <int64_t N, typename scalar_t>
+inline int64_t potrf( lapack::Uplo uplo, scalar_t* A, int64_t lda )
+{
+    static_assert( 1 <= N && N <= max_n, "small::potrf: N out of range" );
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    if (uplo == Uplo::Upper) {
+        for (int64_t j = 0; j < N; ++j) {
+            real_t ajj = real( A[ j + j*lda ] );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( conj( A[ k + j*lda ] ) * A[ k + j*lda ] );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                A[ j + j*lda ] = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            A[ j + j*lda ] = ajj;
+            real_t rcp = 1 / ajj;
+            // row j of U
+            for (int64_t i = j+1; i < N; ++i) {
+                scalar_t sum = A[ j + i*lda ];
+                for (int64_t k = 0; k < j; ++k)
+                    sum -= conj( A[ k + j*lda ] ) * A[ k + i*lda ];
+                A[ j + i*lda ] = sum * rcp;
+            }
+        }
+    }
+    else {
+        for (int64_t j = 0; j < N; ++j) {
+            real_t ajj = real( A[ j + j*lda ] );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( A[ j + k*lda ] * conj( A[ j + k*lda ] ) );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                A[ j + j*lda ] = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            A[ j + j*lda ] = ajj;
+            real_t rcp = 1 / ajj;
+            // column j of L
+            for (int64_t i = j+1; i < N; ++i) {
+                scalar_t sum = A[ i + j*lda ];
+                for (int64_t k = 0; k < j; ++k)
+                    sum -= A[ i + k*lda ] * conj( A[ j + k*lda ] );
+                A[ i + j*lda ] = sum * rcp;
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations $A X = B$ with an N-by-N Hermitian
+/// positive definite matrix A, with N fixed at compile time, using the
+/// Cholesky factorization computed by small::potrf.
+/// Same as lapack::potrs with n = N, but without argument checks.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= max_n.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in] A
+///     The factor U or L from small::potrf, stored in an lda-by-N array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[in,out] B
+///     The N-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= N.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+template <int64_t N, typename scalar_t>
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 1 <= N && N <= max_n, "small::potrs: N out of range" );
+    using blas::conj;
+
+    for (int64_t r = 0; r < nrhs; ++r) {
+        scalar_t* b = &B[ r*ldb ];
+        if (uplo == Uplo::Upper) {
+            // solve U^H y = b
+            for (int64_t i = 0; i < N; ++i) {
+                scalar_t sum = b[ i ];
+                for (int64_t k = 0; k < i; ++k)
+                    sum -= conj( A[ k + i*lda ] ) * b[ k ];
+                b[ i ] = sum / conj( A[ i + i*lda ] );
+            }
+            // solve U x = y
+            for (int64_t i = N-1; i >= 0; --i) {
+                scalar_t sum = b[ i ];
+                for (int64_t k = i+1; k < N; ++k)
+                    sum -= A[ i + k*lda ] * b[ k ];
+                b[ i ] = sum / A[ i + i*lda ];
+            }
+        }
+        else {
+            // solve L y = b
+            for (int64_t i = 0; i < N; ++i) {
+                scalar_t sum = b[ i ];
+                for (int64_t k = 0; k < i; ++k)
+                    sum -= A[ i + k*lda ] * b[ k ];
+                b[ i ] = sum / A[ i + i*lda ];
+            }
+            // solve L^H x = y
+            for (int64_t i = N-1; i >= 0; --i) {
+                scalar_t sum = b[ i ];
+                for (int64_t k = i+1; k < N; ++k)
+                    sum -= conj( A[ k + i*lda ] ) * b[ k ];
+                b[ i ] = sum / conj( A[ i + i*lda ] );
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// LU factorization of an n-by-n matrix A. Dispatches to small::getrf< n >
+/// for n <= max_n, otherwise calls lapack::getrf.
+/// @see lapack::getrf
+/// @ingroup gesv_computational
+template <typename scalar_t>
+inline int64_t getrf( int64_t n, scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < blas::max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+    if (n > max_n)
+        return lapack::getrf( n, n, A, lda, ipiv );
+    return internal::dispatch< 1 >( n, [&]( auto N_ ) {
+        return getrf< decltype( N_ )::value >( A, lda, ipiv );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Inverse of an n-by-n matrix A from its LU factorization. Dispatches to
+/// small::getri< n > for n <= max_n, otherwise calls lapack::getri.
+/// @see lapack::getri
+/// @ingroup gesv_computational
+template <typename scalar_t>
+inline int64_t getri( int64_t n, scalar_t* A, int64_t lda, int64_t const* ipiv )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < blas::max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+    if (n > max_n)
+        return lapack::getri( n, A, lda, ipiv );
+    return internal::dispatch< 1 >( n, [&]( auto N_ ) {
+        return getri< decltype( N_ )::value >( A, lda, ipiv );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization of an n-by-n Hermitian positive definite
+/// matrix A. Dispatches to small::potrf< n > for n <= max_n,
+/// otherwise calls lapack::potrf.
+/// @see lapack::potrf
+/// @ingroup posv_computational
+template <typename scalar_t>
+inline int64_t potrf( lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < blas::max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+    if (n > max_n)
+        return lapack::potrf( uplo, n, A, lda );
+    return internal::dispatch< 1 >( n, [&]( auto N_ ) {
+        return potrf< decltype( N_ )::value >( uplo, A, lda );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$ using the Cholesky factorization from small::potrf.
+/// Dispatches to small::potrs< n > for n <= max_n,
+/// otherwise calls lapack::potrs.
+/// @see lapack::potrs
+/// @ingroup posv_computational
+template <typename scalar_t>
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < blas::max( 1, n ) );
+    lapack_error_if( ldb < blas::max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+    if (n > max_n)
+        return lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+    return internal::dispatch< 1 >( n, [&]( auto N_ ) {
+        return potrs< decltype( N_ )::value >( uplo, nrhs, A, lda, B, ldb );
+    });
+}
+
+}  // namespace small
+}  // namespace lapack
+
+#endif // LAPACK_SMALL_HH
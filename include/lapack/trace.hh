@@ -0,0 +1,249 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TRACE_HH
+#define LAPACK_TRACE_HH
+
+#include "blas.hh"
+#include "lapack/config.h"
+#include "lapack/workspace.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace lapack {
+namespace trace {
+
+//------------------------------------------------------------------------------
+/// One call to a LAPACK++ routine, as reported to the trace sink.
+/// Dimensions that a routine doesn't have are 0. Square routines report
+/// m = n; k is the routine's k, nrhs, or kd.
+///
+/// @ingroup auxiliary
+struct Event
+{
+    char const* routine;    ///< name without precision, e.g., "getrf"
+    char        precision;  ///< 's', 'd', 'c', or 'z'
+    int64_t     m, n, k;    ///< dimensions
+    double      time;       ///< wall time in seconds
+    double      gflop;      ///< flop estimate from lapack/flops.hh, or 0 if none
+    size_t      work_bytes; ///< workspace allocated by the wrapper
+};
+
+/// Callback that receives each Event. It is called from the thread that
+/// made the LAPACK++ call, possibly from many threads at once, so it must
+/// be thread safe.
+using Sink = std::function< void (Event const&) >;
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+extern std::atomic< bool > g_on;
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @return true if LAPACK++ was built with tracing (CMake use_trace=yes),
+/// i.e., with LAPACK_TRACE defined. Otherwise, set_sink has no effect
+/// and no events are reported.
+///
+/// @ingroup auxiliary
+inline constexpr bool built_with_trace()
+{
+    #if defined(LAPACK_TRACE)
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/// Sets the sink that receives an Event for each traced call,
+/// and turns tracing on. set_sink( nullptr ) turns tracing off.
+/// @ingroup auxiliary
+void set_sink( Sink sink );
+
+/// @return true if tracing is on, i.e., a sink is set.
+/// @ingroup auxiliary
+inline bool is_on()
+{
+    return internal::g_on.load( std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+/// Fixed-capacity, thread-safe ring buffer of events, to use as a sink.
+/// When full, each new event overwrites the oldest one.
+///
+/// Example:
+///
+///     auto ring = std::make_shared< lapack::trace::RingBuffer >( 10000 );
+///     lapack::trace::set_sink( ring->sink() );
+///     ...
+///     for (auto& event : ring->drain())
+///         gflops[ event.routine ] += event.gflop / event.time;
+///
+/// @ingroup auxiliary
+class RingBuffer
+{
+public:
+    explicit RingBuffer( size_t capacity );
+
+    void push( Event const& event );
+
+    /// @return events in the order they were pushed, and empties the buffer.
+    std::vector< Event > drain();
+
+    /// @return number of events overwritten before being drained.
+    size_t dropped() const;
+
+    size_t capacity() const { return events_.size(); }
+
+    /// @return sink that pushes to this buffer. The sink refers to this
+    /// buffer, which must outlive it, or be reset with set_sink( nullptr ).
+    Sink sink()
+    {
+        return [this]( Event const& event ) { push( event ); };
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector< Event > events_;
+    size_t head_;     ///< index of oldest event
+    size_t size_;     ///< number of events held
+    size_t dropped_;
+};
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+/// @return bytes held by a workspace vector, e.g., work, rwork, or iwork.
+template <typename T, typename Allocator>
+size_t bytes_of( std::vector< T, Allocator > const& vec )
+{
+    return vec.size() * sizeof( T );
+}
+
+/// @return bytes taken from a Workspace in the current pass.
+inline size_t bytes_of( Workspace const& workspace )
+{
+    return workspace.used();
+}
+
+/// @return bytes, for work arrays provided by the caller to *_work routines.
+inline size_t bytes_of( size_t bytes )
+{
+    return bytes;
+}
+
+/// @return total bytes held by workspace vectors and Workspaces.
+inline size_t bytes()
+{
+    return 0;
+}
+
+template <typename Work, typename... Works>
+size_t bytes( Work const& work, Works const&... works )
+{
+    return bytes_of( work ) + bytes( works... );
+}
+
+/// @return precision letter of scalar_t: 's', 'd', 'c', or 'z'.
+template <typename scalar_t>
+constexpr char precision()
+{
+    using real_t = blas::real_type< scalar_t >;
+    constexpr bool is_double = std::is_same< real_t, double >::value;
+    return blas::is_complex< scalar_t >::value
+           ? (is_double ? 'z' : 'c')
+           : (is_double ? 'd' : 's');
+}
+
+//------------------------------------------------------------------------------
+/// Times a scope and reports it to the sink when the scope ends.
+/// If tracing is off when the scope starts, it does nothing else.
+class Block
+{
+public:
+    Block( char const* routine, char precision,
+           int64_t m, int64_t n, int64_t k )
+        : active_( is_on() )
+    {
+        if (active_) {
+            event_ = Event{ routine, precision, m, n, k, 0, 0, 0 };
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~Block()
+    {
+        if (active_)
+            finish();
+    }
+
+    Block( Block const& ) = delete;
+    Block& operator = ( Block const& ) = delete;
+
+    bool active() const { return active_; }
+
+    void gflop( double gflop ) { event_.gflop = gflop; }
+
+    void work_bytes( size_t bytes ) { event_.work_bytes += bytes; }
+
+private:
+    void finish();
+
+    bool active_;
+    Event event_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace internal
+}  // namespace trace
+}  // namespace lapack
+
+//------------------------------------------------------------------------------
+// Instrumentation used by the wrappers in src. Without LAPACK_TRACE,
+// these expand to nothing, so tracing costs nothing.
+//
+// lapack_trace_block( routine, precision, m, n, k, gflop ) times the rest
+// of the enclosing scope; gflop is evaluated only if tracing is on.
+// lapack_trace_work( works... ) adds the bytes of workspace vectors,
+// Workspaces, and caller-provided arrays (given as a size in bytes).
+// lapack_trace_gflop( gflop ) later in the scope replaces gflop, for
+// models that depend on outputs, e.g., the number of eigenvalues found.
+#if defined(LAPACK_TRACE)
+    // The empty then-branch closes each if, so a following else
+    // can't bind to it.
+    #define lapack_trace_block( routine, precision, m, n, k, gflop_ ) \
+        lapack::trace::internal::Block lapack_trace_block_( \
+            routine, precision, m, n, k ); \
+        if (! lapack_trace_block_.active()) {} \
+        else lapack_trace_block_.gflop( gflop_ )
+
+    #define lapack_trace_work( ... ) \
+        if (! lapack_trace_block_.active()) {} \
+        else lapack_trace_block_.work_bytes( \
+            lapack::trace::internal::bytes( __VA_ARGS__ ) )
+
+    #define lapack_trace_gflop( gflop_ ) \
+        if (! lapack_trace_block_.active()) {} \
+        else lapack_trace_block_.gflop( gflop_ )
+#else
+    #define lapack_trace_block( routine, precision, m, n, k, gflop_ ) \
+        ((void) 0)
+
+    #define lapack_trace_work( ... ) \
+        ((void) 0)
+
+    #define lapack_trace_gflop( gflop_ ) \
+        ((void) 0)
+#endif
+
+#endif // LAPACK_TRACE_HH
@@ -0,0 +1,204 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORKSPACE_HH
+#define LAPACK_WORKSPACE_HH
+
+#include "lapack/memory.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Growable, 64-byte aligned workspace arena.
+///
+/// Wrappers that query LAPACK for the optimal workspace size, such as
+/// gesdd, syevd, heevr, gels, and geqrf, have overloads that take a
+/// Workspace instead of allocating their work, rwork, and iwork arrays
+/// on every call. Each call starts with reset(), then carves its arrays
+/// out of the arena with take(). If the arena is too small, the extra
+/// arrays are allocated separately; at the next reset() the arena is
+/// regrown to the largest size needed so far. So the first call with a
+/// given problem size allocates its arrays, the second consolidates them
+/// into the arena, and after that there is no further heap traffic.
+///
+/// A Workspace is not thread safe; use one per thread.
+/// Its memory comes from the lapack::Allocator in effect when it was
+/// constructed.
+///
+/// Example:
+///
+///     lapack::Workspace work;
+///     for (auto& A : matrices)
+///         lapack::syevd( Job::Vec, Uplo::Lower, n, A, lda, W, work );
+///
+/// @ingroup auxiliary
+class Workspace
+{
+public:
+    /// Alignment in bytes of each array returned by take().
+    static constexpr size_t alignment = 64;
+
+    Workspace() = default;
+
+    /// Constructs a workspace with an initial capacity of bytes.
+    explicit Workspace( size_t bytes )
+    {
+        reserve( bytes );
+    }
+
+    ~Workspace()
+    {
+        release();
+    }
+
+    Workspace( Workspace&& orig ) noexcept
+    {
+        swap( orig );
+    }
+
+    Workspace& operator = ( Workspace&& orig ) noexcept
+    {
+        if (this != &orig) {
+            release();
+            swap( orig );
+        }
+        return *this;
+    }
+
+    // Disable copying; arrays taken from the arena point into it.
+    Workspace( Workspace const& ) = delete;
+    Workspace& operator = ( Workspace const& ) = delete;
+
+    void reserve( size_t bytes );
+    void release();
+
+    //--------------------------------------------------------------------------
+    /// Starts a new pass, invalidating all arrays previously taken.
+    /// If the previous pass overflowed the arena, the arena is regrown
+    /// to hold everything that pass needed.
+    void reset()
+    {
+        if (! overflow_.empty())
+            consolidate();
+        used_ = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    /// @return pointer to an uninitialized array of max( n, 1 ) elements
+    /// of type T, aligned to Workspace::alignment bytes. The array is valid
+    /// until the next reset() or release().
+    template <typename T>
+    T* take( int64_t n )
+    {
+        size_t bytes = round_up( size_t( n > 1 ? n : 1 ) * sizeof(T) );
+        if (used_ + bytes > capacity_)
+            return static_cast< T* >( take_overflow( bytes ) );
+
+        void* ptr = data_ + used_;
+        used_ += bytes;
+        if (used_ + overflow_bytes_ > peak_)
+            peak_ = used_ + overflow_bytes_;
+        return static_cast< T* >( ptr );
+    }
+
+    /// @return capacity of the arena, in bytes.
+    size_t capacity() const { return capacity_; }
+
+    /// @return bytes taken in the current pass, including overflow blocks.
+    size_t used() const { return used_ + overflow_bytes_; }
+
+    /// @return largest number of bytes needed by any pass so far.
+    size_t peak() const { return peak_; }
+
+    /// @return bytes, rounded up to a multiple of Workspace::alignment.
+    static size_t round_up( size_t bytes )
+    {
+        return (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    void swap( Workspace& other ) noexcept
+    {
+        std::swap( data_,           other.data_           );
+        std::swap( capacity_,       other.capacity_       );
+        std::swap( used_,           other.used_           );
+        std::swap( peak_,           other.peak_           );
+        std::swap( overflow_bytes_, other.overflow_bytes_ );
+        std::swap( overflow_,       other.overflow_       );
+        std::swap( allocator_,      other.allocator_      );
+    }
+
+private:
+    void* take_overflow( size_t bytes );
+    void consolidate();
+
+    char*  data_           = nullptr;
+    size_t capacity_       = 0;
+    size_t used_           = 0;
+    size_t peak_           = 0;
+    size_t overflow_bytes_ = 0;
+    Allocator* allocator_  = get_allocator();
+
+    // Blocks allocated when a pass outgrew the arena; freed at reset().
+    std::vector< std::pair< char*, size_t > > overflow_;
+};
+
+//------------------------------------------------------------------------------
+/// Sizes of the work, rwork, and iwork arrays, in elements, returned by
+/// the `*_work_query` routines for the matching `*_work` routines,
+/// e.g., lapack::gesdd_work_query for lapack::gesdd_work.
+/// Arrays that a routine doesn't have are 0.
+///
+/// Example:
+///
+///     lapack::WorkSizes sizes = lapack::syevd_work_query(
+///         lapack::Job::Vec, lapack::Uplo::Lower, n, A, lda, W );
+///     std::vector< double > work( sizes.lwork );
+///     std::vector< lapack_int > iwork( sizes.liwork );
+///     for (auto& A : matrices)
+///         lapack::syevd_work(
+///             lapack::Job::Vec, lapack::Uplo::Lower, n, A, lda, W,
+///             work.data(), sizes.lwork, iwork.data(), sizes.liwork );
+///
+/// @ingroup auxiliary
+struct WorkSizes
+{
+    int64_t lwork;   ///< length of work, in elements of the scalar type
+    int64_t lrwork;  ///< length of rwork, in elements of the real type
+    int64_t liwork;  ///< length of iwork, in lapack_int elements
+};
+
+//------------------------------------------------------------------------------
+/// Statistics for the cache of optimal workspace sizes.
+///
+/// Wrappers that take a Workspace remember the sizes returned by LAPACK's
+/// workspace query (lwork = -1), keyed by routine, precision, job options,
+/// and dimensions. When the same problem shape repeats, the query call is
+/// skipped. The cache is thread safe and bounded; once it is full, the
+/// least recently used entry is evicted.
+///
+/// @ingroup auxiliary
+struct WorkSizeCacheStats
+{
+    int64_t hits;       ///< queries answered from the cache
+    int64_t misses;     ///< queries that called LAPACK
+    int64_t evictions;  ///< entries evicted to stay within capacity
+    int64_t size;       ///< current number of entries
+    int64_t capacity;   ///< maximum number of entries; 0 disables the cache
+};
+
+WorkSizeCacheStats work_size_cache_stats();
+
+void work_size_cache_clear();
+
+void work_size_cache_set_capacity( int64_t capacity );
+
+}  // namespace lapack
+
+#endif // LAPACK_WORKSPACE_HH
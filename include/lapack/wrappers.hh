@@ -7,6 +7,8 @@
 #define LAPACK_WRAPPERS_HH
 
 #include "lapack/util.hh"
+#include "lapack/memory.hh"
+#include "lapack/workspace.hh"
 
 namespace lapack {
 
@@ -502,6 +504,26 @@ int64_t gbtrf(
     std::complex<double>* AB, int64_t ldab,
     int64_t* ipiv );
 
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab,
+    int32_t* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab,
+    int32_t* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab,
+    int32_t* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t gbtrs(
     lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
@@ -527,6 +549,30 @@ int64_t gbtrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t gebak(
     lapack::Balance balance, lapack::Side side, int64_t n, int64_t ilo, int64_t ihi,
@@ -779,6 +825,14 @@ int64_t geev(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr );
 
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    lapack::Workspace& workspace );
+
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
@@ -786,6 +840,14 @@ int64_t geev(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr );
 
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    lapack::Workspace& workspace );
+
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -794,12 +856,90 @@ int64_t geev(
     std::complex<float>* VR, int64_t ldvr );
 
 int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    lapack::Workspace& workspace );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr );
+
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr );
+
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr );
+
+lapack::WorkSizes geev_work_query(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* W,
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr );
 
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    float* work, int64_t lwork );
+
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    double* work, int64_t lwork );
+
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t geevx(
     lapack::Balance balance, lapack::Job jobvl, lapack::Job jobvr, lapack::Sense sense, int64_t n,
@@ -874,6 +1014,50 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+lapack::WorkSizes gehrd_work_query(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau );
+
+lapack::WorkSizes gehrd_work_query(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau );
+
+lapack::WorkSizes gehrd_work_query(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+lapack::WorkSizes gehrd_work_query(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelq(
     int64_t m, int64_t n,
@@ -943,21 +1127,89 @@ int64_t gels(
     float* A, int64_t lda,
     float* B, int64_t ldb );
 
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    lapack::Workspace& workspace );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb );
 
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    lapack::Workspace& workspace );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    lapack::Workspace& workspace );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork );
+
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork );
+
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
@@ -987,6 +1239,72 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank );
 
+lapack::WorkSizes gelsd_work_query(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank );
+
+lapack::WorkSizes gelsd_work_query(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank );
+
+lapack::WorkSizes gelsd_work_query(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank );
+
+lapack::WorkSizes gelsd_work_query(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank );
+
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
@@ -1235,21 +1553,89 @@ int64_t geqrf(
     float* A, int64_t lda,
     float* tau );
 
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    lapack::Workspace& workspace );
+
 int64_t geqrf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau );
 
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    lapack::Workspace& workspace );
+
 int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
 int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    lapack::Workspace& workspace );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+lapack::WorkSizes geqrf_work_query(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t geqrfp(
     int64_t m, int64_t n,
@@ -1486,6 +1872,14 @@ int64_t gesdd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt );
 
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     double* A, int64_t lda,
@@ -1493,6 +1887,14 @@ int64_t gesdd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt );
 
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -1500,6 +1902,14 @@ int64_t gesdd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt );
 
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -1507,6 +1917,80 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t gesv(
     int64_t n, int64_t nrhs,
@@ -1548,6 +2032,46 @@ int64_t gesv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter );
 
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int32_t* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int32_t* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t gesvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
@@ -1609,35 +2133,129 @@ int64_t gesvx(
     double* berr,
     double* rpivotgrowth );
 
-// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
 int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes gesvd_work_query(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     float* A, int64_t lda,
     float* S,
     float* U, int64_t ldu,
     float* VT, int64_t ldvt );
 
-int64_t gesvd(
+lapack::WorkSizes gesvd_work_query(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
     double* U, int64_t ldu,
     double* VT, int64_t ldvt );
 
-int64_t gesvd(
+lapack::WorkSizes gesvd_work_query(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* S,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt );
 
-int64_t gesvd(
+lapack::WorkSizes gesvd_work_query(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* S,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork );
+
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork );
+
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
@@ -1713,6 +2331,26 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t getrf2(
     int64_t m, int64_t n,
@@ -1780,6 +2418,30 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
@@ -2603,6 +3265,34 @@ int64_t hbev_2stage(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+lapack::WorkSizes hbev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+lapack::WorkSizes hbev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+int64_t hbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t hbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -2629,6 +3319,36 @@ int64_t hbevd_2stage(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+lapack::WorkSizes hbevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+lapack::WorkSizes hbevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+int64_t hbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t hbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -2667,6 +3387,48 @@ int64_t hbevx_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+lapack::WorkSizes hbevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+lapack::WorkSizes hbevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t hbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t hbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbgst(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
@@ -2812,6 +3574,30 @@ int64_t heev_2stage(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+lapack::WorkSizes heev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes heev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+int64_t heev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t heev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -2819,10 +3605,48 @@ int64_t heevd(
     float* W );
 
 int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    lapack::Workspace& workspace );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes heevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes heevd_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* W );
 
+int64_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -2834,8 +3658,107 @@ int64_t heevd_2stage(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+lapack::WorkSizes heevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes heevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+int64_t heevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t heevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace );
+
+lapack::WorkSizes heevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+lapack::WorkSizes heevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t heevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t heevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
-int64_t heevr(
+int64_t heevr_2stage(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
@@ -2843,7 +3766,7 @@ int64_t heevr(
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz );
 
-int64_t heevr(
+int64_t heevr_2stage(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
@@ -2851,23 +3774,44 @@ int64_t heevr(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz );
 
-// -----------------------------------------------------------------------------
-int64_t heevr_2stage(
+lapack::WorkSizes heevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
+    int64_t* nfound,
     float* W,
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz );
 
-int64_t heevr_2stage(
+lapack::WorkSizes heevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+    int64_t* nfound,
     double* W,
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz );
 
+int64_t heevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t heevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -2902,6 +3846,44 @@ int64_t heevx_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+lapack::WorkSizes heevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+lapack::WorkSizes heevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t heevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t heevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hegst(
     int64_t itype, lapack::Uplo uplo, int64_t n,
@@ -2939,6 +3921,34 @@ int64_t hegv_2stage(
     std::complex<double>* B, int64_t ldb,
     double* W );
 
+lapack::WorkSizes hegv_2stage_work_query(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+lapack::WorkSizes hegv_2stage_work_query(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+int64_t hegv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t hegv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t hegvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -3122,6 +4132,36 @@ int64_t hetrd(
     double* E,
     std::complex<double>* tau );
 
+lapack::WorkSizes hetrd_work_query(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau );
+
+lapack::WorkSizes hetrd_work_query(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau );
+
+int64_t hetrd_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrd_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetrd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -3139,6 +4179,40 @@ int64_t hetrd_2stage(
     std::complex<double>* tau,
     std::complex<double>* hous2, int64_t lhous2 );
 
+lapack::WorkSizes hetrd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2 );
+
+lapack::WorkSizes hetrd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2 );
+
+int64_t hetrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf(
     lapack::Uplo uplo, int64_t n,
@@ -3150,6 +4224,16 @@ int64_t hetrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf_aa(
     lapack::Uplo uplo, int64_t n,
@@ -3161,6 +4245,16 @@ int64_t hetrf_aa(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
@@ -3174,6 +4268,18 @@ int64_t hetrf_rk(
     std::complex<double>* E,
     int64_t* ipiv );
 
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int32_t* ipiv );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
@@ -3185,6 +4291,16 @@ int64_t hetrf_rook(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t hetri(
     lapack::Uplo uplo, int64_t n,
@@ -3234,6 +4350,18 @@ int64_t hetrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t hetrs2(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3247,6 +4375,18 @@ int64_t hetrs2(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t hetrs_aa(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3260,6 +4400,18 @@ int64_t hetrs_aa(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 // hetrs_rk wraps hetrs_3
 int64_t hetrs_rk(
@@ -3276,6 +4428,21 @@ int64_t hetrs_rk(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+// hetrs_rk wraps hetrs_3
+int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t hetrs_rook(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3289,6 +4456,18 @@ int64_t hetrs_rook(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 void hfrk(
     lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
@@ -4282,6 +5461,39 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<double>* X );
 
+// -----------------------------------------------------------------------------
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    float* X );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    double* X );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    std::complex<float>* X );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    std::complex<double>* X );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    float* A, int64_t lda );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    double* A, int64_t lda );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
 // -----------------------------------------------------------------------------
 void lartg(
     float f, float g,
@@ -4388,32 +5600,65 @@ void lassq(
     float* scale,
     float* sumsq );
 
-void lassq(
+void lassq(
+    int64_t n,
+    std::complex<double> const* X, int64_t incx,
+    double* scale,
+    double* sumsq );
+
+// -----------------------------------------------------------------------------
+/// How lapack::laswp applies a sequence of row interchanges.
+/// @ingroup gesv_computational
+enum class LaswpMethod {
+    Auto,       ///< Permute for long pivot sequences, otherwise Swap
+    Swap,       ///< apply interchanges in order, to one column tile at a time
+    Permute,    ///< compose interchanges into a permutation, then move
+                ///< each row once
+};
+
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
+    int64_t n,
+    double* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
+    int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
     int64_t n,
-    std::complex<double> const* X, int64_t incx,
-    double* scale,
-    double* sumsq );
+    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
 
-// -----------------------------------------------------------------------------
 void laswp(
     int64_t n,
     float* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method );
 
 void laswp(
     int64_t n,
     double* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method );
 
 void laswp(
     int64_t n,
     std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method );
 
 void laswp(
     int64_t n,
     std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method );
 
 // -----------------------------------------------------------------------------
 int64_t lauum(
@@ -4911,6 +6156,32 @@ inline int64_t unmqr(
     return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
 }
 
+lapack::WorkSizes ormqr_work_query(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+lapack::WorkSizes ormqr_work_query(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
+
+int64_t ormqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
+
+int64_t ormqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ormrq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -5481,6 +6752,20 @@ int64_t posv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter );
 
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
 // -----------------------------------------------------------------------------
 int64_t posvx(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -6189,6 +7474,32 @@ inline int64_t hbev_2stage(
     return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
 }
 
+lapack::WorkSizes sbev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
+
+lapack::WorkSizes sbev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
+
+int64_t sbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork );
+
+int64_t sbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t sbevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -6255,6 +7566,34 @@ inline int64_t hbevd_2stage(
     return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
 }
 
+lapack::WorkSizes sbevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
+
+lapack::WorkSizes sbevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
+
+int64_t sbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t sbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t sbevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -6345,6 +7684,46 @@ inline int64_t hbevx_2stage(
     return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
+lapack::WorkSizes sbevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+lapack::WorkSizes sbevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t sbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t sbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t sbgst(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
@@ -7448,6 +8827,21 @@ int64_t sturm(
     int64_t n, scalar_t const* diag,
     scalar_t const* offd, scalar_t u);
 
+template <typename scalar_t>
+void sturm(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t nshifts, scalar_t const* u, int64_t* count );
+
+template <typename scalar_t>
+void sturm_slice(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    scalar_t vl, scalar_t vu, int64_t nslices, int64_t* count );
+
+template <typename scalar_t>
+void sturm_bisect(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t il, int64_t iu, scalar_t abstol, scalar_t* W );
+
 // -----------------------------------------------------------------------------
 int64_t sycon(
     lapack::Uplo uplo, int64_t n,
@@ -7654,12 +9048,40 @@ inline int64_t heev_2stage(
     return syev_2stage( jobz, uplo, n, A, lda, W );
 }
 
+lapack::WorkSizes syev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes syev_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+int64_t syev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork );
+
+int64_t syev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t syevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* W );
 
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    lapack::Workspace& workspace );
+
 // heevd alias to syevd
 inline int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -7669,11 +9091,27 @@ inline int64_t heevd(
     return syevd( jobz, uplo, n, A, lda, W );
 }
 
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    lapack::Workspace& workspace )
+{
+    return syevd( jobz, uplo, n, A, lda, W, workspace );
+}
+
 int64_t syevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* W );
 
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    lapack::Workspace& workspace );
+
 // heevd alias to syevd
 inline int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -7683,6 +9121,40 @@ inline int64_t heevd(
     return syevd( jobz, uplo, n, A, lda, W );
 }
 
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    lapack::Workspace& workspace )
+{
+    return syevd( jobz, uplo, n, A, lda, W, workspace );
+}
+
+lapack::WorkSizes syevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes syevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+int64_t syevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t syevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t syevd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -7712,6 +9184,30 @@ inline int64_t heevd_2stage(
     return syevd_2stage( jobz, uplo, n, A, lda, W );
 }
 
+lapack::WorkSizes syevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+lapack::WorkSizes syevd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+int64_t syevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t syevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t syevr(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -7721,6 +9217,27 @@ int64_t syevr(
     float* Z, int64_t ldz,
     int64_t* isuppz );
 
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+}
+
 // heevr alias to syevr
 inline int64_t heevr(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -7728,30 +9245,89 @@ inline int64_t heevr(
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz, workspace );
+}
+
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
     int64_t* isuppz )
 {
     return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
-int64_t syevr(
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz, workspace );
+}
+
+lapack::WorkSizes syevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+lapack::WorkSizes syevr_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+    int64_t* nfound,
     double* W,
     double* Z, int64_t ldz,
     int64_t* isuppz );
 
-// heevr alias to syevr
-inline int64_t heevr(
+int64_t syevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t syevr_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+    int64_t* nfound,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* isuppz )
-{
-    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
-}
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
 
 // -----------------------------------------------------------------------------
 int64_t syevr_2stage(
@@ -7794,6 +9370,42 @@ inline int64_t heevr_2stage(
     return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
+lapack::WorkSizes syevr_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+lapack::WorkSizes syevr_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t syevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t syevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t syevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -7876,6 +9488,42 @@ inline int64_t heevx_2stage(
     return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
+lapack::WorkSizes syevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+lapack::WorkSizes syevx_2stage_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t syevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
+int64_t syevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t sygst(
     int64_t itype, lapack::Uplo uplo, int64_t n,
@@ -7971,6 +9619,32 @@ inline int64_t hegv_2stage(
     return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
+lapack::WorkSizes sygv_2stage_work_query(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
+
+lapack::WorkSizes sygv_2stage_work_query(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+int64_t sygv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork );
+
+int64_t sygv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t sygvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -8581,6 +10255,36 @@ inline int64_t hetrd(
     return sytrd( uplo, n, A, lda, D, E, tau );
 }
 
+lapack::WorkSizes sytrd_work_query(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau );
+
+lapack::WorkSizes sytrd_work_query(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau );
+
+int64_t sytrd_work(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t sytrd_work(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t sytrd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -8622,6 +10326,40 @@ inline int64_t hetrd_2stage(
     return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
 }
 
+lapack::WorkSizes sytrd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 );
+
+lapack::WorkSizes sytrd_2stage_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 );
+
+int64_t sytrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork );
+
+int64_t sytrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t sytrf(
     lapack::Uplo uplo, int64_t n,
@@ -8661,6 +10399,44 @@ int64_t sytrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
@@ -8700,19 +10476,101 @@ int64_t sytrf_aa(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf_aa( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf_aa( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv );
+
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv )
+{
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+}
+
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv );
+
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv )
+{
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+}
+
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv );
+
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv );
+
 int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* E,
-    int64_t* ipiv );
+    int32_t* ipiv );
 
 // hetrf_rk alias to sytrf_rk
 inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* E,
-    int64_t* ipiv )
+    int32_t* ipiv )
 {
     return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
@@ -8721,14 +10579,14 @@ int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* E,
-    int64_t* ipiv );
+    int32_t* ipiv );
 
 // hetrf_rk alias to sytrf_rk
 inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* E,
-    int64_t* ipiv )
+    int32_t* ipiv )
 {
     return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
@@ -8737,13 +10595,13 @@ int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* E,
-    int64_t* ipiv );
+    int32_t* ipiv );
 
 int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* E,
-    int64_t* ipiv );
+    int32_t* ipiv );
 
 // -----------------------------------------------------------------------------
 int64_t sytrf_rook(
@@ -8784,6 +10642,44 @@ int64_t sytrf_rook(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf_rook( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv );
+
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv )
+{
+    return sytrf_rook( uplo, n, A, lda, ipiv );
+}
+
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv );
+
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv );
+
 // -----------------------------------------------------------------------------
 int64_t sytri(
     lapack::Uplo uplo, int64_t n,
@@ -8953,6 +10849,50 @@ int64_t sytrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs alias to sytrs
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs alias to sytrs
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t sytrs2(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -8998,6 +10938,50 @@ int64_t sytrs2(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t sytrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs2 alias to sytrs2
+inline int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs2( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs2 alias to sytrs2
+inline int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs2( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sytrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t sytrs_aa(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -9043,6 +11027,50 @@ int64_t sytrs_aa(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs_aa alias to sytrs_aa
+inline int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs_aa alias to sytrs_aa
+inline int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 // sytrs_rk wraps sytrs_3
 int64_t sytrs_rk(
@@ -9095,6 +11123,57 @@ int64_t sytrs_rk(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+// sytrs_rk wraps sytrs_3
+int64_t sytrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* E,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs_rk alias to sytrs_rk
+inline int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* E,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+}
+
+int64_t sytrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* E,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs_rk alias to sytrs_rk
+inline int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* E,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+}
+
+int64_t sytrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sytrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t sytrs_rook(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -9140,6 +11219,50 @@ int64_t sytrs_rook(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+int64_t sytrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs_rook alias to sytrs_rook
+inline int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs_rook alias to sytrs_rook
+inline int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sytrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t tbcon(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t kd,
@@ -10229,6 +12352,32 @@ int64_t unmqr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+lapack::WorkSizes unmqr_work_query(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc );
+
+lapack::WorkSizes unmqr_work_query(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc );
+
+int64_t unmqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmrq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -8,23 +8,34 @@
 
 #include <cstddef>  // std::size_t
 #include <limits>   // std::numeric_limits
-#include <new>      // std::bad_alloc, std::bad_array_new_length
+#include <new>      // std::bad_array_new_length
 #include <vector>   // std::vector
-#if defined( _WIN32 ) || defined( _WIN64 )
-#   include <malloc.h>  // _aligned_malloc, _aligned_free
-#else
-#   include <stdlib.h>  // posix_memalign, free
-#endif
+
+#include "lapack/memory.hh"
 
 namespace lapack {
 
-// No-construct allocator type which allocates / deallocates.
+// No-construct allocator type which allocates / deallocates using
+// the lapack::Allocator in effect when it was constructed;
+// see lapack/memory.hh.
 template <typename T>
 struct NoConstructAllocator
 {
     using value_type = T;
 
-    NoConstructAllocator() = default;
+    NoConstructAllocator():
+        allocator_( get_allocator() )
+    {}
+
+    explicit NoConstructAllocator( Allocator* allocator ):
+        allocator_( allocator )
+    {}
+
+    // Rebinding copies the allocator.
+    template <typename U>
+    NoConstructAllocator( NoConstructAllocator<U> const& other ):
+        allocator_( other.allocator_ )
+    {}
 
     // Construction given an allocated pointer is a null-op.
     //
@@ -42,46 +53,30 @@ struct NoConstructAllocator
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_array_new_length();
 
-        void* memPtr = nullptr;
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            memPtr = _aligned_malloc( n*sizeof(T), 64 );
-            if (memPtr != nullptr) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
-        #else
-            int err = posix_memalign( &memPtr, 64, n*sizeof(T) );
-            if (err == 0) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
-        #endif
-
-        throw std::bad_alloc();
+        return static_cast<T*>(
+            internal::allocate( allocator_, n*sizeof(T) ) );
     }
 
     void deallocate(T* p, std::size_t n) noexcept
     {
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            _aligned_free( p );
-        #else
-            free( p );
-        #endif
+        allocator_->deallocate( p, n*sizeof(T) );
     }
+
+    Allocator* allocator_;
 };
 
 template <class T, class U>
 bool operator == ( NoConstructAllocator<T> const& a,
                    NoConstructAllocator<U> const& b )
 {
-    return true;
+    return a.allocator_ == b.allocator_;
 }
 
 template <class T, class U>
 bool operator != ( NoConstructAllocator<T> const& a,
                    NoConstructAllocator<U> const& b)
 {
-    return false;
+    return ! (a == b);
 }
 
 template <typename T>
@@ -0,0 +1,114 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_COMMON_HH
+#define LAPACK_BATCH_COMMON_HH
+
+#include "lapack/util.hh"
+#include "lapack/memory.hh"
+
+#include <exception>
+#include <vector>
+
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
+
+//------------------------------------------------------------------------------
+// Throws if an argument vector is neither of length 1 nor of length batch.
+// These are macros so the error reports the calling routine.
+#define lapack_check_batch_arg( vec, batch ) \
+    lapack_error_if_msg( (vec).size() != 1 && (vec).size() != (batch), \
+                         "%s.size() = %lld; expected 1 or batch = %lld", \
+                         #vec, (long long) (vec).size(), (long long) (batch) )
+
+// Throws if an array of pointers doesn't have one entry per matrix.
+#define lapack_check_batch_array( vec, batch ) \
+    lapack_error_if_msg( (vec).size() < (batch), \
+                         "%s.size() = %lld; expected batch = %lld", \
+                         #vec, (long long) (vec).size(), (long long) (batch) )
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// @return vec[ i ] for a per-matrix argument, or vec[ 0 ] for an argument
+// that applies to the whole batch.
+template <typename T>
+inline T const& extract( std::vector<T> const& vec, size_t i )
+{
+    return vec.size() == 1 ? vec[ 0 ] : vec[ i ];
+}
+
+//------------------------------------------------------------------------------
+// @return number of threads batch_for will use.
+inline int batch_num_threads()
+{
+    #if defined(_OPENMP)
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// @return index of the calling thread within batch_for, in
+// [0, batch_num_threads()).
+inline int batch_thread_num()
+{
+    #if defined(_OPENMP)
+        return omp_get_thread_num();
+    #else
+        return 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Calls func( i ) for i = 0, ..., batch-1, spread over OpenMP threads.
+// Exceptions can't leave an OpenMP region, so the first one thrown is
+// caught and rethrown after all threads finish.
+// The allocator and allocation policy are thread-local, so the caller's
+// are set on each worker thread, for allocations inside func.
+template <typename Func>
+void batch_for( size_t batch, Func&& func )
+{
+    std::exception_ptr error;
+    Allocator* allocator = get_allocator();
+    AllocPolicy policy = get_alloc_policy();
+
+    #if defined(_OPENMP)
+    #pragma omp parallel
+    #endif
+    {
+        AllocatorScope allocator_scope( allocator );
+        AllocPolicyScope policy_scope( policy );
+
+        #if defined(_OPENMP)
+        #pragma omp for schedule( dynamic )
+        #endif
+        for (size_t i = 0; i < batch; ++i) {
+            try {
+                func( i );
+            }
+            catch (...) {
+                #if defined(_OPENMP)
+                #pragma omp critical( lapack_batch_for )
+                #endif
+                {
+                    if (! error)
+                        error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (error)
+        std::rethrow_exception( error );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_COMMON_HH
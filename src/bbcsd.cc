@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
@@ -92,6 +93,8 @@ int64_t bbcsd(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "bbcsd", 's', m, 0, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -194,6 +197,8 @@ int64_t bbcsd(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "bbcsd", 'd', m, 0, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -296,6 +301,8 @@ int64_t bbcsd(
     // allocate workspace
     lapack::vector< float > rwork( lrwork_ );
 
+    lapack_trace_block( "bbcsd", 'c', m, 0, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_cbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -583,6 +590,8 @@ int64_t bbcsd(
     // allocate workspace
     lapack::vector< double > rwork( lrwork_ );
 
+    lapack_trace_block( "bbcsd", 'z', m, 0, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_zbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -58,6 +59,8 @@ int64_t bdsdc(
     lapack::vector< float > work( (max( 1, lwork )) );
     lapack::vector< lapack_int > iwork( (8*n) );
 
+    lapack_trace_block( "bdsdc", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sbdsdc(
         &uplo_, &compq_, &n_,
         D,
@@ -227,6 +230,8 @@ int64_t bdsdc(
     lapack::vector< double > work( (max( 1, lwork )) );
     lapack::vector< lapack_int > iwork( (8*n) );
 
+    lapack_trace_block( "bdsdc", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dbdsdc(
         &uplo_, &compq_, &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +49,8 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    lapack_trace_block( "bdsqr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -99,6 +102,8 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    lapack_trace_block( "bdsqr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -150,6 +155,8 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< float > rwork( (4*n) );
 
+    lapack_trace_block( "bdsqr", 'c', n, n, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_cbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -300,6 +307,8 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< double > rwork( (4*n) );
 
+    lapack_trace_block( "bdsqr", 'z', n, n, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_zbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
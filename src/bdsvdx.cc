@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -48,6 +49,8 @@ int64_t bdsvdx(
     lapack::vector< float > work( (14*n) );
     lapack::vector< lapack_int > iwork( (12*n) );
 
+    lapack_trace_block( "bdsvdx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sbdsvdx(
         &uplo_, &jobz_, &range_, &n_,
         D,
@@ -226,6 +229,8 @@ int64_t bdsvdx(
     lapack::vector< double > work( (14*n) );
     lapack::vector< lapack_int > iwork( (12*n) );
 
+    lapack_trace_block( "bdsvdx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dbdsvdx(
         &uplo_, &jobz_, &range_, &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +31,7 @@ int64_t disna(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "disna", 's', m, n, 0, 0 );
     LAPACK_sdisna(
         &jobcond_, &m_, &n_,
         D,
@@ -60,6 +62,7 @@ int64_t disna(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "disna", 'd', m, n, 0, 0 );
     LAPACK_ddisna(
         &jobcond_, &m_, &n_,
         D,
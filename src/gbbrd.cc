@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -53,6 +54,8 @@ int64_t gbbrd(
     // allocate workspace
     lapack::vector< float > work( (2*max(m,n)) );
 
+    lapack_trace_block( "gbbrd", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         AB, &ldab_,
@@ -110,6 +113,8 @@ int64_t gbbrd(
     // allocate workspace
     lapack::vector< double > work( (2*max(m,n)) );
 
+    lapack_trace_block( "gbbrd", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         AB, &ldab_,
@@ -168,6 +173,8 @@ int64_t gbbrd(
     lapack::vector< std::complex<float> > work( (max(m,n)) );
     lapack::vector< float > rwork( (max(m,n)) );
 
+    lapack_trace_block( "gbbrd", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -312,6 +319,8 @@ int64_t gbbrd(
     lapack::vector< std::complex<double> > work( (max(m,n)) );
     lapack::vector< double > rwork( (max(m,n)) );
 
+    lapack_trace_block( "gbbrd", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
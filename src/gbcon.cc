@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +49,8 @@ int64_t gbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgbcon(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -97,6 +100,8 @@ int64_t gbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgbcon(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -146,6 +151,8 @@ int64_t gbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gbcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgbcon(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -247,6 +254,8 @@ int64_t gbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gbcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgbcon(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
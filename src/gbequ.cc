@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -40,6 +41,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequ", 's', m, n, 0, 0 );
     LAPACK_sgbequ(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -77,6 +79,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequ", 'd', m, n, 0, 0 );
     LAPACK_dgbequ(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -114,6 +117,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequ", 'c', m, n, 0, 0 );
     LAPACK_cgbequ(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -216,6 +220,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequ", 'z', m, n, 0, 0 );
     LAPACK_zgbequ(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -40,6 +41,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequb", 's', m, n, 0, 0 );
     LAPACK_sgbequb(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -77,6 +79,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequb", 'd', m, n, 0, 0 );
     LAPACK_dgbequb(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -114,6 +117,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequb", 'c', m, n, 0, 0 );
     LAPACK_cgbequb(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -223,6 +227,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbequb", 'z', m, n, 0, 0 );
     LAPACK_zgbequb(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -60,6 +61,8 @@ int64_t gbrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -126,6 +129,8 @@ int64_t gbrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -192,6 +197,8 @@ int64_t gbrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gbrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -344,6 +351,8 @@ int64_t gbrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gbrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
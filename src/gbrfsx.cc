@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
@@ -72,6 +73,8 @@ int64_t gbrfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbrfsx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -152,6 +155,8 @@ int64_t gbrfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbrfsx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -232,6 +237,8 @@ int64_t gbrfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "gbrfsx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -613,6 +620,8 @@ int64_t gbrfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "gbrfsx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -47,6 +49,8 @@ int64_t gbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbsv", 's', n, n, nrhs,
+                        Gflop< float >::gbsv( n, kl, ku, nrhs ) );
     LAPACK_sgbsv(
         &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -93,6 +97,8 @@ int64_t gbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbsv", 'd', n, n, nrhs,
+                        Gflop< double >::gbsv( n, kl, ku, nrhs ) );
     LAPACK_dgbsv(
         &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -139,6 +145,8 @@ int64_t gbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gbsv( n, kl, ku, nrhs ) );
     LAPACK_cgbsv(
         &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -267,6 +275,8 @@ int64_t gbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gbsv( n, kl, ku, nrhs ) );
     LAPACK_zgbsv(
         &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
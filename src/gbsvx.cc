@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t gbsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -145,6 +148,8 @@ int64_t gbsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gbsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -224,6 +229,8 @@ int64_t gbsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gbsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -524,6 +531,8 @@ int64_t gbsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gbsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
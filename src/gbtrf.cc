@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +46,8 @@ int64_t gbtrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrf", 's', m, n, 0,
+                        Gflop< float >::gbtrf( m, n, kl, ku ) );
     LAPACK_sgbtrf(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -57,6 +61,50 @@ int64_t gbtrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrf", 's', m, n, 0,
+                        Gflop< float >::gbtrf( m, n, kl, ku ) );
+    LAPACK_sgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gbsv_computational
 int64_t gbtrf(
@@ -86,6 +134,8 @@ int64_t gbtrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrf", 'd', m, n, 0,
+                        Gflop< double >::gbtrf( m, n, kl, ku ) );
     LAPACK_dgbtrf(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -99,6 +149,50 @@ int64_t gbtrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrf", 'd', m, n, 0,
+                        Gflop< double >::gbtrf( m, n, kl, ku ) );
+    LAPACK_dgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gbsv_computational
 int64_t gbtrf(
@@ -128,6 +222,8 @@ int64_t gbtrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gbtrf( m, n, kl, ku ) );
     LAPACK_cgbtrf(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -141,6 +237,50 @@ int64_t gbtrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gbtrf( m, n, kl, ku ) );
+    LAPACK_cgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// Computes an LU factorization of an m-by-n band matrix A
 /// using partial pivoting with row interchanges.
@@ -238,6 +378,8 @@ int64_t gbtrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gbtrf( m, n, kl, ku ) );
     LAPACK_zgbtrf(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -251,4 +393,51 @@ int64_t gbtrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::gbtrf
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gbtrf( m, n, kl, ku ) );
+    LAPACK_zgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +50,58 @@ int64_t gbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrs", 's', n, n, nrhs,
+                        Gflop< float >::gbtrs( n, kl, ku, nrhs ) );
+    LAPACK_sgbtrs(
+        &trans_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv_ptr,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrs", 's', n, n, nrhs,
+                        Gflop< float >::gbtrs( n, kl, ku, nrhs ) );
     LAPACK_sgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -96,6 +150,58 @@ int64_t gbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrs", 'd', n, n, nrhs,
+                        Gflop< double >::gbtrs( n, kl, ku, nrhs ) );
+    LAPACK_dgbtrs(
+        &trans_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv_ptr,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrs", 'd', n, n, nrhs,
+                        Gflop< double >::gbtrs( n, kl, ku, nrhs ) );
     LAPACK_dgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -144,6 +250,58 @@ int64_t gbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gbtrs( n, kl, ku, nrhs ) );
+    LAPACK_cgbtrs(
+        &trans_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gbtrs( n, kl, ku, nrhs ) );
     LAPACK_cgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -254,6 +412,61 @@ int64_t gbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gbtrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gbtrs( n, kl, ku, nrhs ) );
+    LAPACK_zgbtrs(
+        &trans_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::gbtrs
+/// @ingroup gbsv_computational
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gbtrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gbtrs( n, kl, ku, nrhs ) );
     LAPACK_zgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -38,6 +39,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebak", 's', m, n, 0, 0 );
     LAPACK_sgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -76,6 +78,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebak", 'd', m, n, 0, 0 );
     LAPACK_dgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -114,6 +117,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebak", 'c', m, n, 0, 0 );
     LAPACK_cgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -201,6 +205,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebak", 'z', m, n, 0, 0 );
     LAPACK_zgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
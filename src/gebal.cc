@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -35,6 +36,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebal", 's', n, n, 0, 0 );
     LAPACK_sgebal(
         &balance_, &n_,
         A, &lda_, &ilo_, &ihi_,
@@ -72,6 +74,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebal", 'd', n, n, 0, 0 );
     LAPACK_dgebal(
         &balance_, &n_,
         A, &lda_, &ilo_, &ihi_,
@@ -109,6 +112,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebal", 'c', n, n, 0, 0 );
     LAPACK_cgebal(
         &balance_, &n_,
         (lapack_complex_float*) A, &lda_, &ilo_, &ihi_,
@@ -235,6 +239,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gebal", 'z', n, n, 0, 0 );
     LAPACK_zgebal(
         &balance_, &n_,
         (lapack_complex_double*) A, &lda_, &ilo_, &ihi_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -55,6 +57,8 @@ int64_t gebrd(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gebrd", 's', m, n, 0, Gflop< float >::gebrd( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgebrd(
         &m_, &n_,
         A, &lda_,
@@ -109,6 +113,8 @@ int64_t gebrd(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gebrd", 'd', m, n, 0, Gflop< double >::gebrd( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgebrd(
         &m_, &n_,
         A, &lda_,
@@ -163,6 +169,9 @@ int64_t gebrd(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gebrd", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gebrd( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgebrd(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -345,6 +354,9 @@ int64_t gebrd(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gebrd", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gebrd( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgebrd(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +37,8 @@ int64_t gecon(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gecon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
@@ -72,6 +75,8 @@ int64_t gecon(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gecon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
@@ -108,6 +113,8 @@ int64_t gecon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "gecon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgecon(
         &norm_, &n_,
         (lapack_complex_float*) A, &lda_, &anorm, rcond,
@@ -182,6 +189,8 @@ int64_t gecon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "gecon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgecon(
         &norm_, &n_,
         (lapack_complex_double*) A, &lda_, &anorm, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -36,6 +37,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequ", 's', m, n, 0, 0 );
     LAPACK_sgeequ(
         &m_, &n_,
         A, &lda_,
@@ -69,6 +71,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequ", 'd', m, n, 0, 0 );
     LAPACK_dgeequ(
         &m_, &n_,
         A, &lda_,
@@ -102,6 +105,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequ", 'c', m, n, 0, 0 );
     LAPACK_cgeequ(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -192,6 +196,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequ", 'z', m, n, 0, 0 );
     LAPACK_zgeequ(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
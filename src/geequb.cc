@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -36,6 +37,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequb", 's', m, n, 0, 0 );
     LAPACK_sgeequb(
         &m_, &n_,
         A, &lda_,
@@ -69,6 +71,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequb", 'd', m, n, 0, 0 );
     LAPACK_dgeequb(
         &m_, &n_,
         A, &lda_,
@@ -102,6 +105,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequb", 'c', m, n, 0, 0 );
     LAPACK_cgeequb(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -199,6 +203,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geequb", 'z', m, n, 0, 0 );
     LAPACK_zgeequb(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
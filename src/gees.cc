@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -67,6 +68,8 @@ int64_t gees(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gees", 's', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, bwork );
     LAPACK_sgees(
         &jobvs_, &sort_,
         select, &n_,
@@ -143,6 +146,8 @@ int64_t gees(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gees", 'd', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, bwork );
     LAPACK_dgees(
         &jobvs_, &sort_,
         select, &n_,
@@ -217,6 +222,8 @@ int64_t gees(
     lapack::vector< float > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gees", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_cgees(
         &jobvs_, &sort_,
         (LAPACK_C_SELECT1) select, &n_,
@@ -287,6 +294,8 @@ int64_t gees(
     lapack::vector< double > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gees", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_zgees(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &n_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -74,6 +75,8 @@ int64_t geesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "geesx", 's', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, iwork, bwork );
     LAPACK_sgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
@@ -158,6 +161,8 @@ int64_t geesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "geesx", 'd', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, iwork, bwork );
     LAPACK_dgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
@@ -236,6 +241,8 @@ int64_t geesx(
     lapack::vector< float > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "geesx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_cgeesx(
         &jobvs_, &sort_,
         (LAPACK_C_SELECT1) select, &sense_, &n_,
@@ -309,6 +316,8 @@ int64_t geesx(
     lapack::vector< double > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "geesx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_zgeesx(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &sense_, &n_,
@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -23,6 +26,25 @@ int64_t geev(
     std::complex<float>* W,
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr )
+{
+    lapack::Workspace workspace;
+    return geev(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work_query
+/// @ingroup geev
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,32 +61,80 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    // split-complex representation, not referenced by the query;
+    // W has room for it
+    float* WR = reinterpret_cast< float* >( W );
+    float* WI = WR + max( 1, n );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "sgeev", { jobvl_, jobvr_ }, { n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeev(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            &WR[0], &WI[0],
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_ + 2*max( 1, n ), 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    // split-complex representation, at end of work
+    lapack_error_if( lwork < 2*max( 1, n ) );
+    lwork -= 2*max( 1, n );
+    float* WR = &work[ lwork ];
+    float* WI = WR + max( 1, n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geev", 's', n, n, 0,
+                        Gflop< float >::geev( jobvl, jobvr, n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -87,8 +157,59 @@ int64_t geev(
 }
 
 // -----------------------------------------------------------------------------
+/// @see lapack::geev
 /// @ingroup geev
 int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geev_work_query(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+
+    return geev_work(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr,
+        work, sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr )
+{
+    lapack::Workspace workspace;
+    return geev(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work_query
+/// @ingroup geev
+lapack::WorkSizes geev_work_query(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     std::complex<double>* W,
@@ -110,32 +231,80 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    // split-complex representation, not referenced by the query;
+    // W has room for it
+    double* WR = reinterpret_cast< double* >( W );
+    double* WI = WR + max( 1, n );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "dgeev", { jobvl_, jobvr_ }, { n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeev(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            &WR[0], &WI[0],
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_ + 2*max( 1, n ), 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    // split-complex representation, at end of work
+    lapack_error_if( lwork < 2*max( 1, n ) );
+    lwork -= 2*max( 1, n );
+    double* WR = &work[ lwork ];
+    double* WI = WR + max( 1, n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geev", 'd', n, n, 0,
+                        Gflop< double >::geev( jobvl, jobvr, n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -157,6 +326,38 @@ int64_t geev(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geev
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geev_work_query(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+
+    return geev_work(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup geev
 int64_t geev(
@@ -165,6 +366,25 @@ int64_t geev(
     std::complex<float>* W,
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr )
+{
+    lapack::Workspace workspace;
+    return geev(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work_query
+/// @ingroup geev
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -181,31 +401,74 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "cgeev", { jobvl_, jobvr_ }, { n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeev(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) W,
+            (lapack_complex_float*) VL, &ldvl_,
+            (lapack_complex_float*) VR, &ldvr_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    return { lwork_, 2*n, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geev_work
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geev", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::geev( jobvl, jobvr, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float) );
     LAPACK_cgeev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -224,6 +487,40 @@ int64_t geev(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geev
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geev_work_query(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+    float* rwork = workspace.take< float >( sizes.lrwork );
+
+    return geev_work(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr,
+        work, sizes.lwork,
+        rwork, sizes.lrwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes for an n-by-n nonsymmetric matrix A, the
 /// eigenvalues and, optionally, the left and/or right eigenvectors.
@@ -332,6 +629,30 @@ int64_t geev(
     std::complex<double>* W,
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
+{
+    lapack::Workspace workspace;
+    return geev(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geev_work. Takes the same arguments as
+/// lapack::geev; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup geev
+lapack::WorkSizes geev_work_query(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -348,31 +669,94 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "zgeev", { jobvl_, jobvr_ }, { n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeev(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) W,
+            (lapack_complex_double*) VL, &ldvl_,
+            (lapack_complex_double*) VR, &ldvr_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+    return { lwork_, 2*n, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::geev, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::geev.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::geev_work_query.
+///     For real matrices, the last 2 max( 1, n ) elements hold the real
+///     and imaginary parts of the eigenvalues, so lwork must be the query
+///     value, not LAPACK's documented minimum.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::geev_work_query.
+///
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "geev", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::geev( jobvl, jobvr, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double) );
     LAPACK_zgeev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -391,4 +775,38 @@ int64_t geev(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geev
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geev_work_query(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+    double* rwork = workspace.take< double >( sizes.lrwork );
+
+    return geev_work(
+        jobvl, jobvr, n,
+        A, lda,
+        W,
+        VL, ldvl,
+        VR, ldvr,
+        work, sizes.lwork,
+        rwork, sizes.lrwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -16,8 +18,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work_query
 /// @ingroup geev_computational
-int64_t gehrd(
+lapack::WorkSizes gehrd_work_query(
     int64_t n, int64_t ilo, int64_t ihi,
     float* A, int64_t lda,
     float* tau )
@@ -48,9 +51,35 @@ int64_t gehrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work
+/// @ingroup geev_computational
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gehrd", 's', n, n, 0, Gflop< float >::gehrd( n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -65,6 +94,30 @@ int64_t gehrd(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = gehrd_work_query(
+        n, ilo, ihi,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return gehrd_work(
+        n, ilo, ihi,
+        A, lda,
+        tau,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work_query
+/// @ingroup geev_computational
+lapack::WorkSizes gehrd_work_query(
     int64_t n, int64_t ilo, int64_t ihi,
     double* A, int64_t lda,
     double* tau )
@@ -95,9 +148,35 @@ int64_t gehrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work
+/// @ingroup geev_computational
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gehrd", 'd', n, n, 0, Gflop< double >::gehrd( n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -112,6 +191,30 @@ int64_t gehrd(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = gehrd_work_query(
+        n, ilo, ihi,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return gehrd_work(
+        n, ilo, ihi,
+        A, lda,
+        tau,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work_query
+/// @ingroup geev_computational
+lapack::WorkSizes gehrd_work_query(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
@@ -142,9 +245,36 @@ int64_t gehrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gehrd_work
+/// @ingroup geev_computational
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gehrd", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::gehrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>) );
     LAPACK_cgehrd(
         &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
@@ -156,6 +286,29 @@ int64_t gehrd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = gehrd_work_query(
+        n, ilo, ihi,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+
+    return gehrd_work(
+        n, ilo, ihi,
+        A, lda,
+        tau,
+        work.data(), sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Reduces a general matrix A to upper Hessenberg form H by
 /// an unitary similarity transformation: $Q^H A Q = H$.
@@ -196,6 +349,96 @@ int64_t gehrd(
 ///
 /// @return = 0: successful exit
 ///
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gehrd_work. Takes the same arguments as
+/// lapack::gehrd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup geev_computational
+lapack::WorkSizes gehrd_work_query(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    lapack_int lwork_ = real(qry_work[0]);
+
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::gehrd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::gehrd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::gehrd_work_query.
+///
+/// @ingroup geev_computational
+int64_t gehrd_work(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gehrd", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::gehrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>) );
+    LAPACK_zgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @par Further Details
 ///
@@ -240,44 +483,20 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ilo_ = (lapack_int) ilo;
-    lapack_int ihi_ = (lapack_int) ihi;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    WorkSizes sizes = gehrd_work_query(
+        n, ilo, ihi,
+        A, lda,
+        tau );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( sizes.lwork );
 
-    LAPACK_zgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gehrd_work(
+        n, ilo, ihi,
+        A, lda,
+        tau,
+        work.data(), sizes.lwork );
 }
 
 }  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -52,6 +53,8 @@ int64_t gelq(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gelq", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sgelq(
         &m_, &n_,
         A, &lda_,
@@ -98,6 +101,8 @@ int64_t gelq(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gelq", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dgelq(
         &m_, &n_,
         A, &lda_,
@@ -144,6 +149,8 @@ int64_t gelq(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gelq", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cgelq(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -190,6 +197,8 @@ int64_t gelq(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gelq", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< float > work( (m) );
 
+    lapack_trace_block( "gelq2", 's', m, n, 0, Gflop< float >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgelq2(
         &m_, &n_,
         A, &lda_,
@@ -68,6 +72,8 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< double > work( (m) );
 
+    lapack_trace_block( "gelq2", 'd', m, n, 0, Gflop< double >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgelq2(
         &m_, &n_,
         A, &lda_,
@@ -100,6 +106,9 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m) );
 
+    lapack_trace_block( "gelq2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgelq2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -181,6 +190,9 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m) );
 
+    lapack_trace_block( "gelq2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgelq2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -49,6 +51,8 @@ int64_t gelqf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gelqf", 's', m, n, 0, Gflop< float >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgelqf(
         &m_, &n_,
         A, &lda_,
@@ -94,6 +98,8 @@ int64_t gelqf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gelqf", 'd', m, n, 0, Gflop< double >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgelqf(
         &m_, &n_,
         A, &lda_,
@@ -139,6 +145,9 @@ int64_t gelqf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gelqf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgelqf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -233,6 +242,9 @@ int64_t gelqf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gelqf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gelqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgelqf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
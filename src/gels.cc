@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -21,6 +24,21 @@ int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb )
+{
+    lapack::Workspace workspace;
+    return gels(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work_query
+/// @ingroup gels
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -42,26 +60,71 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "sgels", { trans_ }, { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgels(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gels", 's', m, n, nrhs,
+                        Gflop< float >::gels( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
@@ -77,12 +140,53 @@ int64_t gels(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gels
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gels_work_query(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+
+    return gels_work(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb )
+{
+    lapack::Workspace workspace;
+    return gels(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work_query
+/// @ingroup gels
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -104,26 +208,71 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "dgels", { trans_ }, { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgels(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gels", 'd', m, n, nrhs,
+                        Gflop< double >::gels( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
@@ -140,8 +289,49 @@ int64_t gels(
 }
 
 // -----------------------------------------------------------------------------
+/// @see lapack::gels
 /// @ingroup gels
 int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gels_work_query(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+
+    return gels_work(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb,
+        work, sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    lapack::Workspace workspace;
+    return gels(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work_query
+/// @ingroup gels
+lapack::WorkSizes gels_work_query(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
@@ -162,26 +352,67 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "cgels", { trans_ }, { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgels(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gels_work
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gels", 'c', m, n, nrhs,
+                        Gflop< std::complex<float> >::gels( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>) );
     LAPACK_cgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -197,6 +428,32 @@ int64_t gels(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gels
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gels_work_query(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+
+    return gels_work(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Solves overdetermined or underdetermined complex linear systems
 /// involving an m-by-n matrix A, or its conjugate-transpose, using a QR
@@ -293,6 +550,26 @@ int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
+{
+    lapack::Workspace workspace;
+    return gels(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gels_work. Takes the same arguments as
+/// lapack::gels; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup gels
+lapack::WorkSizes gels_work_query(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -310,26 +587,77 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "zgels", { trans_ }, { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgels(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::gels, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::gels.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::gels_work_query.
+///
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gels", 'z', m, n, nrhs,
+                        Gflop< std::complex<double> >::gels( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>) );
     LAPACK_zgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -345,4 +673,30 @@ int64_t gels(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gels
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gels_work_query(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+
+    return gels_work(
+        trans, m, n, nrhs,
+        A, lda,
+        B, ldb,
+        work, sizes.lwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -16,8 +18,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work_query
 /// @ingroup gels
-int64_t gelsd(
+lapack::WorkSizes gelsd_work_query(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
@@ -57,10 +60,42 @@ int64_t gelsd(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = qry_iwork[0];
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work
+/// @ingroup gels
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gelsd", 's', m, n, nrhs,
+                        Gflop< float >::gelsd( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_sgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -78,6 +113,38 @@ int64_t gelsd(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    // query for workspace size
+    WorkSizes sizes = gelsd_work_query(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return gelsd_work(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work_query
+/// @ingroup gels
+lapack::WorkSizes gelsd_work_query(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
@@ -117,10 +184,42 @@ int64_t gelsd(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = qry_iwork[0];
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work
+/// @ingroup gels
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gelsd", 'd', m, n, nrhs,
+                        Gflop< double >::gelsd( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -138,6 +237,38 @@ int64_t gelsd(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    // query for workspace size
+    WorkSizes sizes = gelsd_work_query(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return gelsd_work(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work_query
+/// @ingroup gels
+lapack::WorkSizes gelsd_work_query(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
@@ -180,11 +311,44 @@ int64_t gelsd(
     lapack_int lrwork_ = qry_rwork[0];
     lapack_int liwork_ = qry_iwork[0];
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gelsd_work
+/// @ingroup gels
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gelsd", 'c', m, n, nrhs,
+                        Gflop< std::complex<float> >::gelsd( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cgelsd(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -200,6 +364,167 @@ int64_t gelsd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    // query for workspace size
+    WorkSizes sizes = gelsd_work_query(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return gelsd_work(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelsd_work. Takes the same arguments as
+/// lapack::gelsd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup gels
+lapack::WorkSizes gelsd_work_query(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lrwork_ = qry_rwork[0];
+    lapack_int liwork_ = qry_iwork[0];
+
+    return { lwork_, lrwork_, liwork_ };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::gelsd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::gelsd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::gelsd_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::gelsd_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::gelsd_work_query.
+///
+/// @ingroup gels
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gelsd", 'z', m, n, nrhs,
+                        Gflop< std::complex<double> >::gelsd( m, n, nrhs ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
+    LAPACK_zgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_double*) &work[0], &lwork_,
+        &rwork[0],
+        &iwork[0], &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the minimum-norm solution to a real linear least
 /// squares problem:
@@ -290,60 +615,28 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    WorkSizes sizes = gelsd_work_query(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
 
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelsd_work(
+        m, n, nrhs,
+        A, lda,
+        B, ldb,
+        S, rcond,
+        rank,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
 }
 
 }  // namespace lapack
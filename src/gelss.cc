@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -57,6 +59,9 @@ int64_t gelss(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gelss", 's', m, n, nrhs,
+                        Gflop< float >::gelss( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_sgelss(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -112,6 +117,9 @@ int64_t gelss(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gelss", 'd', m, n, nrhs,
+                        Gflop< double >::gelss( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dgelss(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -170,6 +178,9 @@ int64_t gelss(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (5*min(m,n)) );
 
+    lapack_trace_block( "gelss", 'c', m, n, nrhs,
+                        Gflop< std::complex<float> >::gelss( m, n, nrhs ) );
+    lapack_trace_work( work, rwork );
     LAPACK_cgelss(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -296,6 +307,9 @@ int64_t gelss(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (5*min(m,n)) );
 
+    lapack_trace_block( "gelss", 'z', m, n, nrhs,
+                        Gflop< std::complex<double> >::gelss( m, n, nrhs ) );
+    lapack_trace_work( work, rwork );
     LAPACK_zgelss(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
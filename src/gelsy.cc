@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -64,6 +66,9 @@ int64_t gelsy(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gelsy", 's', m, n, nrhs,
+                        Gflop< float >::gelsy( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_sgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -129,6 +134,9 @@ int64_t gelsy(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gelsy", 'd', m, n, nrhs,
+                        Gflop< double >::gelsy( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -197,6 +205,9 @@ int64_t gelsy(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "gelsy", 'c', m, n, nrhs,
+                        Gflop< std::complex<float> >::gelsy( m, n, nrhs ) );
+    lapack_trace_work( work, rwork );
     LAPACK_cgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -365,6 +376,9 @@ int64_t gelsy(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "gelsy", 'z', m, n, nrhs,
+                        Gflop< std::complex<double> >::gelsy( m, n, nrhs ) );
+    lapack_trace_work( work, rwork );
     LAPACK_zgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -64,6 +65,8 @@ int64_t gemqr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gemqr", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_sgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -127,6 +130,8 @@ int64_t gemqr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gemqr", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -190,6 +195,8 @@ int64_t gemqr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gemqr", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_cgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -253,6 +260,8 @@ int64_t gemqr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gemqr", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
 
@@ -55,6 +56,8 @@ int64_t gemqrt(
     // allocate workspace
     std::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gemqrt", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_sgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
         V, &ldv_,
@@ -110,6 +113,8 @@ int64_t gemqrt(
     // allocate workspace
     std::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gemqrt", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
         V, &ldv_,
@@ -165,6 +170,8 @@ int64_t gemqrt(
     // allocate workspace
     std::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gemqrt", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_cgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
         (lapack_complex_float*) V, &ldv_,
@@ -295,6 +302,8 @@ int64_t gemqrt(
     // allocate workspace
     std::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gemqrt", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
         (lapack_complex_double*) V, &ldv_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t geql2(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "geql2", 's', m, n, 0, Gflop< float >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgeql2(
         &m_, &n_,
         A, &lda_,
@@ -68,6 +72,8 @@ int64_t geql2(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "geql2", 'd', m, n, 0, Gflop< double >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgeql2(
         &m_, &n_,
         A, &lda_,
@@ -100,6 +106,9 @@ int64_t geql2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "geql2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgeql2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -186,6 +195,9 @@ int64_t geql2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "geql2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgeql2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -49,6 +51,8 @@ int64_t geqlf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "geqlf", 's', m, n, 0, Gflop< float >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgeqlf(
         &m_, &n_,
         A, &lda_,
@@ -94,6 +98,8 @@ int64_t geqlf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "geqlf", 'd', m, n, 0, Gflop< double >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgeqlf(
         &m_, &n_,
         A, &lda_,
@@ -139,6 +145,9 @@ int64_t geqlf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "geqlf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgeqlf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -238,6 +247,9 @@ int64_t geqlf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "geqlf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqlf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgeqlf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -57,6 +58,8 @@ int64_t geqp3(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "geqp3", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
@@ -114,6 +117,8 @@ int64_t geqp3(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "geqp3", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
@@ -174,6 +179,8 @@ int64_t geqp3(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "geqp3", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -235,6 +242,8 @@ int64_t geqp3(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "geqp3", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
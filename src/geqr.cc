@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
@@ -57,6 +58,8 @@ int64_t geqr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "geqr", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sgeqr(
         &m_, &n_,
         A, &lda_,
@@ -108,6 +111,8 @@ int64_t geqr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "geqr", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dgeqr(
         &m_, &n_,
         A, &lda_,
@@ -159,6 +164,8 @@ int64_t geqr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "geqr", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cgeqr(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -299,6 +306,8 @@ int64_t geqr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "geqr", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zgeqr(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "geqr2", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgeqr2(
         &m_, &n_,
         A, &lda_,
@@ -68,6 +72,8 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "geqr2", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgeqr2(
         &m_, &n_,
         A, &lda_,
@@ -100,6 +106,9 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "geqr2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgeqr2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -184,6 +193,9 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "geqr2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgeqr2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
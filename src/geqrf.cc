@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -21,6 +24,21 @@ int64_t geqrf(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     float* tau )
+{
+    lapack::Workspace workspace;
+    return geqrf(
+        m, n,
+        A, lda,
+        tau, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work_query
+/// @ingroup geqrf
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,22 +51,57 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "sgeqrf", {}, { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeqrf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work
+/// @ingroup geqrf
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "geqrf", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sgeqrf(
         &m_, &n_,
         A, &lda_,
@@ -60,12 +113,53 @@ int64_t geqrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geqrf_work_query(
+        m, n,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+
+    return geqrf_work(
+        m, n,
+        A, lda,
+        tau,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup geqrf
 int64_t geqrf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau )
+{
+    lapack::Workspace workspace;
+    return geqrf(
+        m, n,
+        A, lda,
+        tau, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work_query
+/// @ingroup geqrf
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -78,22 +172,57 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "dgeqrf", {}, { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeqrf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work
+/// @ingroup geqrf
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrf", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dgeqrf(
         &m_, &n_,
         A, &lda_,
@@ -105,12 +234,53 @@ int64_t geqrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geqrf_work_query(
+        m, n,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+
+    return geqrf_work(
+        m, n,
+        A, lda,
+        tau,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup geqrf
 int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
+{
+    lapack::Workspace workspace;
+    return geqrf(
+        m, n,
+        A, lda,
+        tau, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work_query
+/// @ingroup geqrf
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -123,22 +293,58 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqrf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "cgeqrf", {}, { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeqrf(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf_work
+/// @ingroup geqrf
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqrf( m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>) );
     LAPACK_cgeqrf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -150,6 +356,32 @@ int64_t geqrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geqrf_work_query(
+        m, n,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+
+    return geqrf_work(
+        m, n,
+        A, lda,
+        tau,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes a QR factorization of an m-by-n matrix A:
 /// $A = Q R$.
@@ -207,6 +439,26 @@ int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
+{
+    lapack::Workspace workspace;
+    return geqrf(
+        m, n,
+        A, lda,
+        tau, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geqrf_work. Takes the same arguments as
+/// lapack::geqrf; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup geqrf
+lapack::WorkSizes geqrf_work_query(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -219,22 +471,68 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqrf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "zgeqrf", {}, { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeqrf(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::geqrf, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::geqrf.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::geqrf_work_query.
+///
+/// @ingroup geqrf
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqrf( m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>) );
     LAPACK_zgeqrf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -246,4 +544,30 @@ int64_t geqrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = geqrf_work_query(
+        m, n,
+        A, lda,
+        tau );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+
+    return geqrf_work(
+        m, n,
+        A, lda,
+        tau,
+        work, sizes.lwork );
+}
+
 }  // namespace lapack
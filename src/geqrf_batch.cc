@@ -0,0 +1,230 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of general m-by-n matrices.
+/// Each matrix is factored by lapack::geqrf; matrices are distributed
+/// over OpenMP threads. Each thread reuses one lapack::Workspace for all
+/// its matrices, so workspace is allocated only when a matrix is larger
+/// than any the thread has seen. For best throughput on small matrices,
+/// use a single-threaded LAPACK library.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     Vector of length 1 or batch. The number of rows of each matrix A.
+///
+/// @param[in] n
+///     Vector of length 1 or batch. The number of columns of each matrix A.
+///
+/// @param[in,out] Aarray
+///     Vector of length batch. Aarray[i] is the m_i-by-n_i matrix A_i,
+///     stored in an lda_i-by-n_i array.
+///     On exit, R and the Householder vectors, as in lapack::geqrf.
+///
+/// @param[in] lda
+///     Vector of length 1 or batch. Leading dimension of each A_i.
+///     lda_i >= max(1,m_i).
+///
+/// @param[out] tau_array
+///     Vector of length batch. tau_array[i] is the vector of length
+///     min(m_i,n_i) of scalar factors of the elementary reflectors for A_i.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::geqrf
+///     return value for A_i.
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<scalar_t*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<scalar_t*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    using internal::extract;
+
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_check_batch_arg( m, batch );
+    lapack_check_batch_arg( n, batch );
+    lapack_check_batch_array( Aarray, batch );
+    lapack_check_batch_arg( lda, batch );
+    lapack_check_batch_array( tau_array, batch );
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t m_i = extract( m, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( extract( n, i ) < 0 );
+        lapack_error_if( extract( lda, i ) < max( 1, m_i ) );
+    }
+
+    std::vector< lapack::Workspace > workspaces( internal::batch_num_threads() );
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        lapack::Workspace& workspace = workspaces[ internal::batch_thread_num() ];
+        info[ i ] = geqrf( extract( m, i ), extract( n, i ),
+                           Aarray[ i ], extract( lda, i ),
+                           tau_array[ i ], workspace );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of general m-by-n matrices,
+/// stored at a fixed stride.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     Matrix A_i is the m-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///     On exit, R and the Householder vectors, as in lapack::geqrf.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] stride_A
+///     Distance between consecutive matrices. stride_A >= lda*n.
+///
+/// @param[out] tau
+///     The vector of scalar factors for A_i, of length min(m,n),
+///     starts at tau + i*stride_tau.
+///
+/// @param[in] stride_tau
+///     Distance between consecutive tau vectors.
+///     stride_tau >= min(m,n).
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::geqrf
+///     return value for A_i.
+///
+/// @see lapack::geqrf_batch
+/// @ingroup geqrf
+template <typename scalar_t>
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    scalar_t* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( stride_A < lda*n );
+    lapack_error_if( stride_tau < blas::min( m, n ) );
+
+    std::vector< lapack::Workspace > workspaces( internal::batch_num_threads() );
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        lapack::Workspace& workspace = workspaces[ internal::batch_thread_num() ];
+        info[ i ] = geqrf( m, n, &A[ i*stride_A ], lda,
+                           &tau[ i*stride_tau ], workspace );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<float*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<float*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<double*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<double*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<std::complex<float>*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<std::complex<float>*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch(
+    std::vector<int64_t> const& m,
+    std::vector<int64_t> const& n,
+    std::vector<std::complex<double>*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    std::vector<std::complex<double>*> const& tau_array,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//--------------------
+template
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t stride_A,
+    float* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t stride_A,
+    double* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t stride_A,
+    std::complex<float>* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t stride_A,
+    std::complex<double>* tau, int64_t stride_tau,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
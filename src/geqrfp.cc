@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30202  // >= v3.2.2
@@ -50,6 +52,8 @@ int64_t geqrfp(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "geqrfp", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgeqrfp(
         &m_, &n_,
         A, &lda_,
@@ -94,6 +98,9 @@ int64_t geqrfp(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "geqrfp", 'd', m, n, 0,
+                        Gflop< double >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgeqrfp(
         &m_, &n_,
         A, &lda_,
@@ -138,6 +145,9 @@ int64_t geqrfp(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "geqrfp", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgeqrfp(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -182,6 +192,9 @@ int64_t geqrfp(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "geqrfp", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqrf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgeqrfp(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
@@ -41,6 +43,8 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
 
+    lapack_trace_block( "geqrt", 's', m, n, 0, Gflop< float >::geqrt( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgeqrt(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -76,6 +80,8 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
 
+    lapack_trace_block( "geqrt", 'd', m, n, 0, Gflop< double >::geqrt( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgeqrt(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -111,6 +117,9 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
 
+    lapack_trace_block( "geqrt", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqrt( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgeqrt(
         &m_, &n_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -146,6 +155,9 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
 
+    lapack_trace_block( "geqrt", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqrt( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgeqrt(
         &m_, &n_, &nb_,
         (lapack_complex_double*) A, &lda_,
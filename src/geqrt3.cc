@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -35,6 +37,7 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrt3", 's', m, n, 0, Gflop< float >::geqrt( m, n ) );
     LAPACK_sgeqrt3(
         &m_, &n_,
         A, &lda_,
@@ -64,6 +67,8 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrt3", 'd', m, n, 0,
+                        Gflop< double >::geqrt( m, n ) );
     LAPACK_dgeqrt3(
         &m_, &n_,
         A, &lda_,
@@ -93,6 +98,8 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrt3", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::geqrt( m, n ) );
     LAPACK_cgeqrt3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -122,6 +129,8 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "geqrt3", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::geqrt( m, n ) );
     LAPACK_zgeqrt3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
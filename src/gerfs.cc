@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +57,8 @@ int64_t gerfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gerfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgerfs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -118,6 +121,8 @@ int64_t gerfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gerfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgerfs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -180,6 +185,8 @@ int64_t gerfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gerfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgerfs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -316,6 +323,8 @@ int64_t gerfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gerfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgerfs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
@@ -68,6 +69,8 @@ int64_t gerfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gerfsx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -144,6 +147,8 @@ int64_t gerfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gerfsx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -220,6 +225,8 @@ int64_t gerfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "gerfsx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -568,6 +575,8 @@ int64_t gerfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "gerfsx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t gerq2(
     // allocate workspace
     lapack::vector< float > work( (m) );
 
+    lapack_trace_block( "gerq2", 's', m, n, 0, Gflop< float >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgerq2(
         &m_, &n_,
         A, &lda_,
@@ -68,6 +72,8 @@ int64_t gerq2(
     // allocate workspace
     lapack::vector< double > work( (m) );
 
+    lapack_trace_block( "gerq2", 'd', m, n, 0, Gflop< double >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgerq2(
         &m_, &n_,
         A, &lda_,
@@ -100,6 +106,9 @@ int64_t gerq2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m) );
 
+    lapack_trace_block( "gerq2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgerq2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -187,6 +196,9 @@ int64_t gerq2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m) );
 
+    lapack_trace_block( "gerq2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgerq2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
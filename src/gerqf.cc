@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -49,6 +51,8 @@ int64_t gerqf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gerqf", 's', m, n, 0, Gflop< float >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_sgerqf(
         &m_, &n_,
         A, &lda_,
@@ -94,6 +98,8 @@ int64_t gerqf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gerqf", 'd', m, n, 0, Gflop< double >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_dgerqf(
         &m_, &n_,
         A, &lda_,
@@ -139,6 +145,9 @@ int64_t gerqf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gerqf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_cgerqf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -239,6 +248,9 @@ int64_t gerqf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gerqf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gerqf( m, n ) );
+    lapack_trace_work( work );
     LAPACK_zgerqf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
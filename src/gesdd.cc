@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -23,6 +26,25 @@ int64_t gesdd(
     float* S,
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesdd(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,31 +62,75 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "sgesdd", { jobz_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgesdd(
+            &jobz_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    return { lwork_, 0, 8*min(m,n) };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gesdd", 's', m, n, 0,
+                        Gflop< float >::gesdd( jobz, m, n ) );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_sgesdd(
         &jobz_, &m_, &n_,
         A, &lda_,
@@ -83,6 +149,40 @@ int64_t gesdd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesdd_work_query(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return gesdd_work(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesdd(
@@ -91,6 +191,25 @@ int64_t gesdd(
     double* S,
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesdd(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -108,31 +227,75 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "dgesdd", { jobz_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgesdd(
+            &jobz_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    return { lwork_, 0, 8*min(m,n) };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesdd", 'd', m, n, 0,
+                        Gflop< double >::gesdd( jobz, m, n ) );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dgesdd(
         &jobz_, &m_, &n_,
         A, &lda_,
@@ -151,6 +314,40 @@ int64_t gesdd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesdd_work_query(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return gesdd_work(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesdd(
@@ -159,6 +356,25 @@ int64_t gesdd(
     float* S,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesdd(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -176,29 +392,41 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_;
+    internal::WorkSizeKey key(
+        "cgesdd", { jobz_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1] = { 0 };
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgesdd(
+            &jobz_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            S,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) VT, &ldvt_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = qry_rwork[0];
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
     if (lrwork_ == 0) {
         // if query doesn't work, this is from documentation
         lapack_int mx = max( m, n );
@@ -212,11 +440,45 @@ int64_t gesdd(
         lrwork_ = max( 1, lrwork_ );
     }
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    return { lwork_, lrwork_, 8*min(m,n) };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd_work
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesdd", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gesdd( jobz, m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cgesdd(
         &jobz_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -236,6 +498,42 @@ int64_t gesdd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesdd_work_query(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+    float* rwork = workspace.take< float >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return gesdd_work(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the singular value decomposition (SVD) of a
 /// m-by-n matrix A, optionally computing the left and/or right singular
@@ -350,6 +648,30 @@ int64_t gesdd(
     double* S,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesdd(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesdd_work. Takes the same arguments as
+/// lapack::gesdd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup gesvd
+lapack::WorkSizes gesdd_work_query(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -367,29 +689,41 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_;
+    internal::WorkSizeKey key(
+        "zgesdd", { jobz_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1] = { 0 };
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgesdd(
+            &jobz_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            S,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) VT, &ldvt_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = qry_rwork[0];
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
     if (lrwork_ == 0) {
         // if query doesn't work, this is from documentation
         lapack_int mx = max( m, n );
@@ -403,11 +737,69 @@ int64_t gesdd(
         lrwork_ = max( 1, lrwork_ );
     }
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    return { lwork_, lrwork_, 8*min(m,n) };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::gesdd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::gesdd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::gesdd_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::gesdd_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::gesdd_work_query.
+///
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesdd", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gesdd( jobz, m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zgesdd(
         &jobz_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -427,4 +819,40 @@ int64_t gesdd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesdd
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesdd_work_query(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+    double* rwork = workspace.take< double >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return gesdd_work(
+        jobz, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 }  // namespace lapack
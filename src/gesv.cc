@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -43,6 +45,8 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gesv", 's', n, n, nrhs,
+                        Gflop< float >::gesv( n, nrhs ) );
     LAPACK_sgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -57,6 +61,50 @@ int64_t gesv(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int32_t* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesv", 's', n, n, nrhs,
+                        Gflop< float >::gesv( n, nrhs ) );
+    LAPACK_sgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv
 int64_t gesv(
@@ -85,6 +133,8 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gesv", 'd', n, n, nrhs,
+                        Gflop< double >::gesv( n, nrhs ) );
     LAPACK_dgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -99,6 +149,50 @@ int64_t gesv(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int32_t* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesv", 'd', n, n, nrhs,
+                        Gflop< double >::gesv( n, nrhs ) );
+    LAPACK_dgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv
 int64_t gesv(
@@ -127,6 +221,8 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gesv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gesv( n, nrhs ) );
     LAPACK_cgesv(
         &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -141,6 +237,50 @@ int64_t gesv(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gesv( n, nrhs ) );
+    LAPACK_cgesv(
+        &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the solution to a system of linear equations
 ///     $A X = B$,
@@ -218,6 +358,8 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gesv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gesv( n, nrhs ) );
     LAPACK_zgesv(
         &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -232,6 +374,53 @@ int64_t gesv(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::gesv
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gesv( n, nrhs ) );
+    LAPACK_zgesv(
+        &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 int64_t gesv(
     int64_t n, int64_t nrhs,
@@ -268,6 +457,9 @@ int64_t gesv(
     lapack::vector< double > work( (n)*(nrhs) );
     lapack::vector< float > swork( (n*(n+nrhs)) );
 
+    lapack_trace_block( "gesv", 'd', n, n, nrhs,
+                        Gflop< double >::gesv( n, nrhs ) );
+    lapack_trace_work( work, swork );
     LAPACK_dsgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -323,6 +515,9 @@ int64_t gesv(
     lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gesv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gesv( n, nrhs ) );
+    lapack_trace_work( work, swork, rwork );
     LAPACK_zcgesv(
         &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,154 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// where each A_i is n-by-n and X_i and B_i are n-by-nrhs, with the
+/// matrices stored at fixed strides.
+/// Arguments are checked once for the whole batch, and pivots for
+/// all systems are held in a single allocation; then each system is
+/// solved by lapack::gesv, with the batch distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of linear equations in each system. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] A
+///     Matrix A_i is the n-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///     On exit, the factors L and U from A_i = P L U.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] stride_A
+///     Distance between consecutive A_i. stride_A >= lda*n.
+///
+/// @param[out] ipiv
+///     The pivot vector for A_i, of length n, starts at
+///     ipiv + i*stride_ipiv.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     Matrix B_i is the n-by-nrhs matrix starting at B + i*stride_B,
+///     stored in an ldb-by-nrhs array.
+///     On successful exit, the solution X_i.
+///
+/// @param[in] ldb
+///     Leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] stride_B
+///     Distance between consecutive B_i. stride_B >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::gesv
+///     return value for system i.
+///
+/// @see lapack::getrf_batch_strided
+/// @ingroup gesv
+template <typename scalar_t>
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( stride_A < lda*n );
+    lapack_error_if( stride_ipiv < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( stride_B < ldb*nrhs );
+
+    // Passing lapack_int pivots selects the gesv overload that
+    // calls LAPACK directly, without a per-call pivot copy.
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, n*int64_t( batch ) ) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+        int64_t stride_ipiv_ = n;
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+        int64_t stride_ipiv_ = stride_ipiv;
+    #endif
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        lapack_int* ipiv_i = &ipiv_ptr[ i*stride_ipiv_ ];
+        info[ i ] = gesv( n, nrhs, &A[ i*stride_A ], lda, ipiv_i,
+                          &B[ i*stride_B ], ldb );
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_i, ipiv_i + n, &ipiv[ i*stride_ipiv ] );
+        #endif
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t stride_A,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
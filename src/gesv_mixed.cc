@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "mixed_common.hh"
+#include "NoConstructAllocator.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using low_t  = typename mixed_low_type< scalar_t >::type;
+
+    const scalar_t one = 1.0;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    *iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    // Stopping criterion of dsgesv: ||r||_max <= ||x||_max ||A||_inf sqrt(n) eps,
+    // with eps = dlamch( 'E' ), the unit roundoff.
+    const real_t eps = std::numeric_limits< real_t >::epsilon() / 2;
+    real_t Anorm = lapack::lange( Norm::Inf, n, n, A, lda );
+    real_t cte = Anorm * eps * std::sqrt( real_t( n ) );
+
+    int64_t ldr = n;
+    lapack::vector< scalar_t > R( n * nrhs );
+    lapack::vector< low_t > SA( n * n );
+    lapack::vector< low_t > SX( n * nrhs );
+
+    // R = B - A X
+    auto residual = [&]() {
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, &R[0], ldr );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n, nrhs, n,
+                    -one, A, lda,
+                          X, ldx,
+                    one,  &R[0], ldr );
+    };
+
+    int64_t iiter = 0;
+    if (lag2_low( n, nrhs, B, ldb, &SX[0], n ) != 0) {
+        *iter = -2;
+    }
+    else if (lag2_low( n, n, A, lda, &SA[0], n ) != 0) {
+        *iter = -2;
+    }
+    else if (lapack::getrf( n, n, &SA[0], n, ipiv ) != 0) {
+        *iter = -3;
+    }
+    else {
+        // Initial solve in low precision.
+        lapack::getrs( Op::NoTrans, n, nrhs, &SA[0], n, ipiv, &SX[0], n );
+        lag2_high( n, nrhs, &SX[0], n, X, ldx );
+        residual();
+
+        for (iiter = 0; iiter <= mixed_itermax; ++iiter) {
+            if (mixed_converged( n, nrhs, X, ldx, &R[0], ldr, cte )) {
+                *iter = iiter;
+                return 0;
+            }
+            if (iiter == mixed_itermax) {
+                *iter = -(mixed_itermax + 1);
+                break;
+            }
+            // Correction: solve A C = R in low precision; X += C.
+            if (lag2_low( n, nrhs, &R[0], ldr, &SX[0], n ) != 0) {
+                *iter = -2;
+                break;
+            }
+            lapack::getrs( Op::NoTrans, n, nrhs, &SA[0], n, ipiv, &SX[0], n );
+            lag2_high( n, nrhs, &SX[0], n, &R[0], ldr );
+            for (int64_t j = 0; j < nrhs; ++j) {
+                blas::axpy( n, one, &R[ j*ldr ], 1, &X[ j*ldx ], 1 );
+            }
+            residual();
+        }
+    }
+
+    // Fall back to factoring and solving in full precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    int64_t info = lapack::getrf( n, n, A, lda, ipiv );
+    if (info == 0) {
+        lapack::getrs( Op::NoTrans, n, nrhs, A, lda, ipiv, X, ldx );
+    }
+    return info;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using mixed-precision iterative refinement.
+///
+/// A is factored in single precision with lapack::getrf, and the
+/// solution is refined in double precision until its backward error
+/// matches that of a double precision solve. If refinement does not
+/// converge, or single precision fails (overflow or a singular factor),
+/// A is refactored in double precision and the system solved directly,
+/// so the result is always as accurate as lapack::gesv.
+/// For well-conditioned systems, most of the work is in single
+/// precision, which is about twice as fast.
+///
+/// Unlike lapack::gesv with iter, which calls LAPACK's dsgesv or zcgesv,
+/// this is implemented in C++ using lapack::lag2s, lapack::lag2c,
+/// lapack::lag2d, and lapack::lag2z, so it uses 64-bit pivots
+/// and the BLAS and LAPACK routines of this library.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, if iterative refinement has been successfully used
+///     (info = 0 and iter >= 0), then A is unchanged. If double
+///     precision factorization has been used (info = 0 and iter < 0),
+///     then A contains the factors L and U from the factorization
+///     A = P L U.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices that define the permutation matrix P;
+///     row i of the matrix was interchanged with row ipiv(i).
+///     Corresponds either to the single precision factorization
+///     (if info = 0 and iter >= 0) or the double precision
+///     factorization (if info = 0 and iter < 0).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs array X, stored in an ldx-by-nrhs array.
+///     If info = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - < 0: iterative refinement has failed, double precision
+///            factorization has been performed
+///         - -2: overflow converting to single precision
+///         - -3: failure of single precision lapack::getrf
+///         - -31: refinement did not converge in 30 iterations
+///     - > 0: iterative refinement has been successfully used.
+///            Returns the number of refinement iterations.
+///     - = 0: the single precision solve was already accurate.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) computed in double precision is
+///     exactly zero. The factorization has been completed, but the
+///     factor U is exactly singular, so the solution could not be computed.
+///
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter )
+{
+    return internal::gesv_mixed( n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter );
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::gesv_mixed
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter )
+{
+    return internal::gesv_mixed( n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter );
+}
+
+}  // namespace lapack
@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -23,6 +26,25 @@ int64_t gesvd(
     float* S,
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesvd(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesvd_work_query(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -41,28 +63,72 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "sgesvd", { jobu_, jobvt_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    std::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work
+/// @ingroup gesvd
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesvd", 's', m, n, 0,
+                        Gflop< float >::gesvd( jobu, jobvt, m, n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
@@ -81,8 +147,59 @@ int64_t gesvd(
 }
 
 // -----------------------------------------------------------------------------
+/// @see lapack::gesvd
 /// @ingroup gesvd
 int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesvd_work_query(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+
+    return gesvd_work(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesvd(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesvd_work_query(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
@@ -106,28 +223,72 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "dgesvd", { jobu_, jobvt_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    std::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work
+/// @ingroup gesvd
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesvd", 'd', m, n, 0,
+                        Gflop< double >::gesvd( jobu, jobvt, m, n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
@@ -145,6 +306,38 @@ int64_t gesvd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesvd_work_query(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+
+    return gesvd_work(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesvd(
@@ -153,6 +346,25 @@ int64_t gesvd(
     float* S,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesvd(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work_query
+/// @ingroup gesvd
+lapack::WorkSizes gesvd_work_query(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -171,31 +383,76 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "cgesvd", { jobu_, jobvt_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            S,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) VT, &ldvt_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
-    std::vector< float > rwork( (5*min(m,n)) );
+    return { lwork_, 5*min(m,n), 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd_work
+/// @ingroup gesvd
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 5*min(m,n) );
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "gesvd", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::gesvd( jobu, jobvt, m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float) );
     LAPACK_cgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -214,6 +471,40 @@ int64_t gesvd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesvd_work_query(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+    float* rwork = workspace.take< float >( sizes.lrwork );
+
+    return gesvd_work(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        rwork, sizes.lrwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the singular value decomposition (SVD) of a
 /// m-by-n matrix A, optionally computing the left and/or right singular
@@ -331,6 +622,30 @@ int64_t gesvd(
     double* S,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
+{
+    lapack::Workspace workspace;
+    return gesvd(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesvd_work. Takes the same arguments as
+/// lapack::gesvd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup gesvd
+lapack::WorkSizes gesvd_work_query(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -349,31 +664,93 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_;
+    internal::WorkSizeKey key(
+        "zgesvd", { jobu_, jobvt_ }, { m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_ = sizes.lwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            S,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) VT, &ldvt_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, 0 } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
-    std::vector< double > rwork( (5*min(m,n)) );
+    return { lwork_, 5*min(m,n), 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::gesvd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::gesvd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::gesvd_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::gesvd_work_query.
+///
+/// @ingroup gesvd
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 5*min(m,n) );
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "gesvd", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::gesvd( jobu, jobvt, m, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double) );
     LAPACK_zgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -392,4 +769,38 @@ int64_t gesvd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::gesvd
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = gesvd_work_query(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+    double* rwork = workspace.take< double >( sizes.lrwork );
+
+    return gesvd_work(
+        jobu, jobvt, m, n,
+        A, lda,
+        S,
+        U, ldu,
+        VT, ldvt,
+        work, sizes.lwork,
+        rwork, sizes.lrwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -75,6 +77,8 @@ int64_t gesvdx(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (12*min(m,n)) );
 
+    lapack_trace_block( "gesvdx", 's', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -91,6 +95,7 @@ int64_t gesvdx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< float >::gesvdx( jobu, jobvt, m, n, nfound_ ) );
     return info_;
 }
 
@@ -152,6 +157,8 @@ int64_t gesvdx(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (12*min(m,n)) );
 
+    lapack_trace_block( "gesvdx", 'd', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -168,6 +175,7 @@ int64_t gesvdx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< double >::gesvdx( jobu, jobvt, m, n, nfound_ ) );
     return info_;
 }
 
@@ -235,6 +243,8 @@ int64_t gesvdx(
     lapack::vector< float > rwork( (max( 1, lrwork )) );
     lapack::vector< lapack_int > iwork( (12*min(m,n)) );
 
+    lapack_trace_block( "gesvdx", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_cgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -252,6 +262,8 @@ int64_t gesvdx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::gesvdx( jobu, jobvt, m, n, nfound_ ) );
     return info_;
 }
 
@@ -446,6 +458,8 @@ int64_t gesvdx(
     lapack::vector< double > rwork( (max( 1, lrwork )) );
     lapack::vector< lapack_int > iwork( (12*min(m,n)) );
 
+    lapack_trace_block( "gesvdx", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -463,6 +477,8 @@ int64_t gesvdx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::gesvdx( jobu, jobvt, m, n, nfound_ ) );
     return info_;
 }
 
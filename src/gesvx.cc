@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -63,6 +64,8 @@ int64_t gesvx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gesvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgesvx(
         &fact_, &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -140,6 +143,8 @@ int64_t gesvx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gesvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgesvx(
         &fact_, &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -217,6 +222,8 @@ int64_t gesvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "gesvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgesvx(
         &fact_, &trans_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -505,6 +512,8 @@ int64_t gesvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "gesvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgesvx(
         &fact_, &trans_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +42,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getf2", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
     LAPACK_sgetf2(
         &m_, &n_,
         A, &lda_,
@@ -78,6 +81,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getf2", 'd', m, n, 0, Gflop< double >::getrf( m, n ) );
     LAPACK_dgetf2(
         &m_, &n_,
         A, &lda_,
@@ -116,6 +120,8 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getf2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::getrf( m, n ) );
     LAPACK_cgetf2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -196,6 +202,8 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getf2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::getrf( m, n ) );
     LAPACK_zgetf2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
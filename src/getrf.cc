@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +42,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
     LAPACK_sgetrf(
         &m_, &n_,
         A, &lda_,
@@ -53,6 +56,45 @@ int64_t getrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrf", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
+    LAPACK_sgetrf(
+        &m_, &n_,
+        A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t getrf(
@@ -78,6 +120,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf", 'd', m, n, 0, Gflop< double >::getrf( m, n ) );
     LAPACK_dgetrf(
         &m_, &n_,
         A, &lda_,
@@ -91,6 +134,45 @@ int64_t getrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrf", 'd', m, n, 0, Gflop< double >::getrf( m, n ) );
+    LAPACK_dgetrf(
+        &m_, &n_,
+        A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t getrf(
@@ -116,6 +198,8 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::getrf( m, n ) );
     LAPACK_cgetrf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -129,6 +213,46 @@ int64_t getrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrf", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::getrf( m, n ) );
+    LAPACK_cgetrf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// Computes an LU factorization of a general m-by-n matrix A
 /// using partial pivoting with row interchanges.
@@ -196,6 +320,8 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::getrf( m, n ) );
     LAPACK_zgetrf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -209,4 +335,47 @@ int64_t getrf(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::getrf
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrf", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::getrf( m, n ) );
+    LAPACK_zgetrf(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -42,6 +44,7 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf2", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
     LAPACK_sgetrf2(
         &m_, &n_,
         A, &lda_,
@@ -80,6 +83,8 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf2", 'd', m, n, 0,
+                        Gflop< double >::getrf( m, n ) );
     LAPACK_dgetrf2(
         &m_, &n_,
         A, &lda_,
@@ -118,6 +123,8 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf2", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::getrf( m, n ) );
     LAPACK_cgetrf2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -226,6 +233,8 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrf2", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::getrf( m, n ) );
     LAPACK_zgetrf2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
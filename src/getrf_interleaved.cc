@@ -0,0 +1,186 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// LU factorization of one chunk of W interleaved n-by-n matrices.
+// Every loop over lanes l has the constant trip count W, so the compiler
+// vectorizes across matrices; pivot rows differ per lane.
+template <typename scalar_t>
+void getrf_interleaved_chunk(
+    int64_t n, scalar_t* A, int64_t* ipiv, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::real;
+    using blas::imag;
+    constexpr int64_t W = interleaved_width;
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    real_t amax[ W ];
+    int64_t piv[ W ];
+    scalar_t rcp[ W ];
+
+    for (int64_t l = 0; l < W; ++l)
+        info[ l ] = 0;
+
+    for (int64_t j = 0; j < n; ++j) {
+        // find pivot in column j, per lane
+        scalar_t const* Ajj = &A[ (j + j*n)*W ];
+        for (int64_t l = 0; l < W; ++l) {
+            amax[ l ] = std::abs( real( Ajj[ l ] ) ) + std::abs( imag( Ajj[ l ] ) );
+            piv[ l ] = j;
+        }
+        for (int64_t i = j+1; i < n; ++i) {
+            scalar_t const* Aij = &A[ (i + j*n)*W ];
+            for (int64_t l = 0; l < W; ++l) {
+                real_t a = std::abs( real( Aij[ l ] ) ) + std::abs( imag( Aij[ l ] ) );
+                bool greater = a > amax[ l ];
+                amax[ l ] = greater ? a : amax[ l ];
+                piv[ l ]  = greater ? i : piv[ l ];
+            }
+        }
+        for (int64_t l = 0; l < W; ++l)
+            ipiv[ j*W + l ] = piv[ l ] + 1;
+
+        // swap rows j and piv, per lane
+        for (int64_t k = 0; k < n; ++k) {
+            scalar_t* Ak = &A[ k*n*W ];
+            for (int64_t l = 0; l < W; ++l) {
+                int64_t p = piv[ l ];
+                scalar_t tmp = Ak[ j*W + l ];
+                Ak[ j*W + l ] = Ak[ p*W + l ];
+                Ak[ p*W + l ] = tmp;
+            }
+        }
+
+        // compute elements j+1:n-1 of column j;
+        // a zero pivot leaves the (zero) column as is, as in getrf.
+        for (int64_t l = 0; l < W; ++l) {
+            bool singular = Ajj[ l ] == zero;
+            if (singular && info[ l ] == 0)
+                info[ l ] = j + 1;
+            rcp[ l ] = singular ? one : one / Ajj[ l ];
+        }
+        for (int64_t i = j+1; i < n; ++i) {
+            scalar_t* Aij = &A[ (i + j*n)*W ];
+            for (int64_t l = 0; l < W; ++l)
+                Aij[ l ] *= rcp[ l ];
+        }
+
+        // update trailing submatrix
+        for (int64_t k = j+1; k < n; ++k) {
+            scalar_t const* Ajk = &A[ (j + k*n)*W ];
+            for (int64_t i = j+1; i < n; ++i) {
+                scalar_t const* Aij = &A[ (i + j*n)*W ];
+                scalar_t* Aik = &A[ (i + k*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    Aik[ l ] -= Aij[ l ] * Ajk[ l ];
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of n-by-n matrices stored in
+/// interleaved layout, using partial pivoting with row interchanges,
+/// \[
+///     A_i = P_i L_i U_i.
+/// \]
+/// Intended for large batches of tiny matrices (n up to about 16),
+/// where factoring one matrix at a time leaves SIMD lanes idle.
+/// The kernel vectorizes across interleaved_width matrices at once,
+/// and chunks are distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     Array of length interleaved_size( n, n, batch ),
+///     holding the batch in interleaved layout.
+///     On exit, the factors L_i and U_i, in interleaved layout.
+///
+/// @param[out] ipiv
+///     Array of length interleaved_size( n, 1, batch ).
+///     On exit, the pivot indices of each matrix, as in lapack::getrf,
+///     in interleaved layout.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is as returned by lapack::getrf
+///     for A_i.
+///
+/// @see lapack::pack_interleaved
+/// @ingroup gesv_computational
+template <typename scalar_t>
+void getrf_interleaved(
+    int64_t n,
+    scalar_t* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( n < 0 );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        int64_t info_c[ interleaved_width ];
+        internal::getrf_interleaved_chunk(
+            n, &A[ c*n*n*W ], &ipiv[ c*n*W ], info_c );
+        int64_t lanes = std::min( W, int64_t( batch ) - int64_t( c )*W );
+        std::copy( info_c, info_c + lanes, &info[ c*W ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrf_interleaved(
+    int64_t n,
+    float* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrf_interleaved(
+    int64_t n,
+    double* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrf_interleaved(
+    int64_t n,
+    std::complex<float>* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrf_interleaved(
+    int64_t n,
+    std::complex<double>* A, int64_t* ipiv,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -55,6 +57,8 @@ int64_t getri(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "getri", 's', n, n, 0, Gflop< float >::getri( n ) );
+    lapack_trace_work( work );
     LAPACK_sgetri(
         &n_,
         A, &lda_,
@@ -106,6 +110,8 @@ int64_t getri(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "getri", 'd', n, n, 0, Gflop< double >::getri( n ) );
+    lapack_trace_work( work );
     LAPACK_dgetri(
         &n_,
         A, &lda_,
@@ -157,6 +163,9 @@ int64_t getri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "getri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::getri( n ) );
+    lapack_trace_work( work );
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
@@ -240,6 +249,9 @@ int64_t getri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "getri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::getri( n ) );
+    lapack_trace_work( work );
     LAPACK_zgetri(
         &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +47,55 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrs", 's', n, n, nrhs,
+                        Gflop< float >::getrs( n, nrhs ) );
+    LAPACK_sgetrs(
+        &trans_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrs", 's', n, n, nrhs,
+                        Gflop< float >::getrs( n, nrhs ) );
     LAPACK_sgetrs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -90,6 +141,55 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrs", 'd', n, n, nrhs,
+                        Gflop< double >::getrs( n, nrhs ) );
+    LAPACK_dgetrs(
+        &trans_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrs", 'd', n, n, nrhs,
+                        Gflop< double >::getrs( n, nrhs ) );
     LAPACK_dgetrs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -135,6 +235,55 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::getrs( n, nrhs ) );
+    LAPACK_cgetrs(
+        &trans_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::getrs( n, nrhs ) );
     LAPACK_cgetrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -233,6 +382,58 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "getrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::getrs( n, nrhs ) );
+    LAPACK_zgetrs(
+        &trans_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::getrs
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "getrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::getrs( n, nrhs ) );
     LAPACK_zgetrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
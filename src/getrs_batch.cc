@@ -0,0 +1,168 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i   X_i = B_i,
+/// \]
+/// \[
+///     A_i^T X_i = B_i,
+/// \]
+/// or
+/// \[
+///     A_i^H X_i = B_i,
+/// \]
+/// using the LU factorizations computed by lapack::getrf_batch_strided or
+/// lapack::gesv_batch_strided, with the matrices stored at fixed strides.
+/// Arguments are checked once for the whole batch, and pivots for
+/// all systems are held in a single allocation; then each system is
+/// solved by lapack::getrs, with the batch distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i X_i = B_i$   (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     Matrix A_i is the n-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array, holding the factors L and U
+///     from A_i = P L U.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] stride_A
+///     Distance between consecutive A_i. stride_A >= lda*n.
+///
+/// @param[in] ipiv
+///     The pivot vector for A_i, of length n, starts at
+///     ipiv + i*stride_ipiv.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     Matrix B_i is the n-by-nrhs matrix starting at B + i*stride_B,
+///     stored in an ldb-by-nrhs array.
+///     On exit, the solution X_i.
+///
+/// @param[in] ldb
+///     Leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] stride_B
+///     Distance between consecutive B_i. stride_B >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::getrs
+///     return value for system i.
+///
+/// @ingroup gesv_computational
+template <typename scalar_t>
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( stride_A < lda*n );
+    lapack_error_if( stride_ipiv < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( stride_B < ldb*nrhs );
+
+    // Passing lapack_int pivots selects the getrs overload that
+    // calls LAPACK directly, without a per-call pivot copy.
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, n*int64_t( batch ) ) );
+    #endif
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        int64_t const* ipiv_i = &ipiv[ i*stride_ipiv ];
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_i_ = &ipiv_[ i*n ];
+            std::copy( ipiv_i, ipiv_i + n, ipiv_i_ );
+        #else
+            lapack_int const* ipiv_i_ = ipiv_i;
+        #endif
+        info[ i ] = getrs( trans, n, nrhs, &A[ i*stride_A ], lda,
+                           ipiv_i_,
+                           &B[ i*stride_B ], ldb );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t stride_A,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
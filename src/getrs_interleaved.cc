@@ -0,0 +1,214 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Solves with the LU factors of one chunk of W interleaved n-by-n matrices.
+// Loops over lanes l have the constant trip count W, so the compiler
+// vectorizes across matrices.
+template <typename scalar_t>
+void getrs_interleaved_chunk(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t const* ipiv, scalar_t* B )
+{
+    using blas::conj;
+    constexpr int64_t W = interleaved_width;
+
+    // op( x ) = x or conj( x ), applied to A for trans = ConjTrans.
+    bool do_conj = (trans == Op::ConjTrans);
+    auto op = [do_conj]( scalar_t x ) {
+        return do_conj ? conj( x ) : x;
+    };
+
+    for (int64_t r = 0; r < nrhs; ++r) {
+        scalar_t* b = &B[ r*n*W ];
+        if (trans == Op::NoTrans) {
+            // apply row interchanges
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t l = 0; l < W; ++l) {
+                    int64_t p = ipiv[ j*W + l ] - 1;
+                    scalar_t tmp = b[ j*W + l ];
+                    b[ j*W + l ] = b[ p*W + l ];
+                    b[ p*W + l ] = tmp;
+                }
+            }
+            // solve L y = b, L unit lower
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ i*W + l ] -= Aij[ l ] * b[ j*W + l ];
+                }
+            }
+            // solve U x = y
+            for (int64_t j = n-1; j >= 0; --j) {
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= Ajj[ l ];
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ i*W + l ] -= Aij[ l ] * b[ j*W + l ];
+                }
+            }
+        }
+        else {
+            // solve op( U ) y = b
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ j*W + l ] -= op( Aij[ l ] ) * b[ i*W + l ];
+                }
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= op( Ajj[ l ] );
+            }
+            // solve op( L ) x = y, L unit lower
+            for (int64_t j = n-1; j >= 0; --j) {
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ j*W + l ] -= op( Aij[ l ] ) * b[ i*W + l ];
+                }
+            }
+            // apply row interchanges in reverse
+            for (int64_t j = n-1; j >= 0; --j) {
+                for (int64_t l = 0; l < W; ++l) {
+                    int64_t p = ipiv[ j*W + l ] - 1;
+                    scalar_t tmp = b[ j*W + l ];
+                    b[ j*W + l ] = b[ p*W + l ];
+                    b[ p*W + l ] = tmp;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// \[
+///     A_i^T X_i = B_i,
+/// \]
+/// or
+/// \[
+///     A_i^H X_i = B_i,
+/// \]
+/// using the LU factorizations computed by lapack::getrf_interleaved.
+/// A_i, ipiv, and B_i are all in interleaved layout.
+/// The kernel vectorizes across interleaved_width systems at once,
+/// and chunks are distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     Array of length interleaved_size( n, n, batch ).
+///     The factors L_i and U_i from lapack::getrf_interleaved.
+///
+/// @param[in] ipiv
+///     Array of length interleaved_size( n, 1, batch ).
+///     The pivot indices from lapack::getrf_interleaved.
+///
+/// @param[in,out] B
+///     Array of length interleaved_size( n, nrhs, batch ),
+///     holding the n-by-nrhs right hand sides B_i in interleaved layout.
+///     On exit, the solutions X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is as returned by lapack::getrs
+///     for system i.
+///
+/// @see lapack::pack_interleaved
+/// @ingroup gesv_computational
+template <typename scalar_t>
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t const* ipiv,
+    scalar_t* B,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        internal::getrs_interleaved_chunk(
+            trans, n, nrhs, &A[ c*n*n*W ], &ipiv[ c*n*W ], &B[ c*n*nrhs*W ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t const* ipiv,
+    float* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t const* ipiv,
+    double* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t const* ipiv,
+    std::complex<float>* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void getrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t const* ipiv,
+    std::complex<double>* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
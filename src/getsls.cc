@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -79,6 +81,9 @@ int64_t getsls(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "getsls", 's', m, n, nrhs,
+                        Gflop< float >::getsls( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_sgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
@@ -156,6 +161,9 @@ int64_t getsls(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "getsls", 'd', m, n, nrhs,
+                        Gflop< double >::getsls( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
@@ -229,6 +237,9 @@ int64_t getsls(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "getsls", 'c', m, n, nrhs,
+                        Gflop< std::complex<float> >::getsls( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_cgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -302,6 +313,9 @@ int64_t getsls(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "getsls", 'z', m, n, nrhs,
+                        Gflop< std::complex<double> >::getsls( m, n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -38,6 +39,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ggbak", 's', m, n, 0, 0 );
     LAPACK_sggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -77,6 +79,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ggbak", 'd', m, n, 0, 0 );
     LAPACK_dggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -116,6 +119,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ggbak", 'c', m, n, 0, 0 );
     LAPACK_cggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -155,6 +159,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ggbak", 'z', m, n, 0, 0 );
     LAPACK_zggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +46,8 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< float > work( (lwork) );
 
+    lapack_trace_block( "ggbal", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sggbal(
         &balance_, &n_,
         A, &lda_,
@@ -94,6 +97,8 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< double > work( (lwork) );
 
+    lapack_trace_block( "ggbal", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dggbal(
         &balance_, &n_,
         A, &lda_,
@@ -143,6 +148,8 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< float > work( (lwork) );
 
+    lapack_trace_block( "ggbal", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cggbal(
         &balance_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -192,6 +199,8 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< double > work( (lwork) );
 
+    lapack_trace_block( "ggbal", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zggbal(
         &balance_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -79,6 +80,8 @@ int64_t gges(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, bwork );
     LAPACK_sgges(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -170,6 +173,8 @@ int64_t gges(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, bwork );
     LAPACK_dgges(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -259,6 +264,8 @@ int64_t gges(
     lapack::vector< float > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_cgges(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &n_,
@@ -344,6 +351,8 @@ int64_t gges(
     lapack::vector< double > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_zgges(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &n_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -81,6 +82,8 @@ int64_t gges3(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges3", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, bwork );
     LAPACK_sgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -172,6 +175,8 @@ int64_t gges3(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges3", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, bwork );
     LAPACK_dgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -261,6 +266,8 @@ int64_t gges3(
     lapack::vector< float > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges3", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_cgges3(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &n_,
@@ -346,6 +353,8 @@ int64_t gges3(
     lapack::vector< double > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "gges3", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, bwork );
     LAPACK_zgges3(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &n_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -88,6 +89,8 @@ int64_t ggesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "ggesx", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, iwork, bwork );
     LAPACK_sggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
@@ -191,6 +194,8 @@ int64_t ggesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "ggesx", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work, iwork, bwork );
     LAPACK_dggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
@@ -292,6 +297,8 @@ int64_t ggesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "ggesx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork, bwork );
     LAPACK_cggesx(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &sense_, &n_,
@@ -389,6 +396,8 @@ int64_t ggesx(
     lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
+    lapack_trace_block( "ggesx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork, bwork );
     LAPACK_zggesx(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &sense_, &n_,
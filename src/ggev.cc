@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -70,6 +71,8 @@ int64_t ggev(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ggev", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_sggev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -148,6 +151,8 @@ int64_t ggev(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ggev", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_dggev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -225,6 +230,8 @@ int64_t ggev(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (8*n) );
 
+    lapack_trace_block( "ggev", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cggev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -299,6 +306,8 @@ int64_t ggev(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (8*n) );
 
+    lapack_trace_block( "ggev", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zggev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -72,6 +73,8 @@ int64_t ggev3(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ggev3", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_sggev3(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -150,6 +153,8 @@ int64_t ggev3(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ggev3", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_dggev3(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -227,6 +232,8 @@ int64_t ggev3(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (8*n) );
 
+    lapack_trace_block( "ggev3", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cggev3(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -301,6 +308,8 @@ int64_t ggev3(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (8*n) );
 
+    lapack_trace_block( "ggev3", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zggev3(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -59,6 +60,8 @@ int64_t ggglm(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ggglm", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sggglm(
         &n_, &m_, &p_,
         A, &lda_,
@@ -117,6 +120,8 @@ int64_t ggglm(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ggglm", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dggglm(
         &n_, &m_, &p_,
         A, &lda_,
@@ -175,6 +180,8 @@ int64_t ggglm(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ggglm", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cggglm(
         &n_, &m_, &p_,
         (lapack_complex_float*) A, &lda_,
@@ -317,6 +324,8 @@ int64_t ggglm(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ggglm", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zggglm(
         &n_, &m_, &p_,
         (lapack_complex_double*) A, &lda_,
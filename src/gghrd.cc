@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -43,6 +44,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gghrd", 's', n, n, 0, 0 );
     LAPACK_sgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -88,6 +90,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gghrd", 'd', n, n, 0, 0 );
     LAPACK_dgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -133,6 +136,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gghrd", 'c', n, n, 0, 0 );
     LAPACK_cgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
@@ -178,6 +182,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gghrd", 'z', n, n, 0, 0 );
     LAPACK_zgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) A, &lda_,
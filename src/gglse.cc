@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -59,6 +60,8 @@ int64_t gglse(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "gglse", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sgglse(
         &m_, &n_, &p_,
         A, &lda_,
@@ -117,6 +120,8 @@ int64_t gglse(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "gglse", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dgglse(
         &m_, &n_, &p_,
         A, &lda_,
@@ -175,6 +180,8 @@ int64_t gglse(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "gglse", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cgglse(
         &m_, &n_, &p_,
         (lapack_complex_float*) A, &lda_,
@@ -324,6 +331,8 @@ int64_t gglse(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "gglse", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zgglse(
         &m_, &n_, &p_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +57,8 @@ int64_t ggrqf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ggrqf", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sggrqf(
         &m_, &p_, &n_,
         A, &lda_,
@@ -110,6 +113,8 @@ int64_t ggrqf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ggrqf", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dggrqf(
         &m_, &p_, &n_,
         A, &lda_,
@@ -164,6 +169,8 @@ int64_t ggrqf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ggrqf", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cggrqf(
         &m_, &p_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -218,6 +225,8 @@ int64_t ggrqf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ggrqf", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zggrqf(
         &m_, &p_, &n_,
         (lapack_complex_double*) A, &lda_,
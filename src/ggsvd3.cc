@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= 3.6
@@ -84,6 +85,8 @@ int64_t ggsvd3(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ggsvd3", 's', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         A, &lda_,
@@ -174,6 +177,8 @@ int64_t ggsvd3(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ggsvd3", 'd', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         A, &lda_,
@@ -267,6 +272,8 @@ int64_t ggsvd3(
     lapack::vector< float > rwork( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ggsvd3", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_cggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -361,6 +368,8 @@ int64_t ggsvd3(
     lapack::vector< double > rwork( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ggsvd3", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
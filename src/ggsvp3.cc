@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -82,6 +83,8 @@ int64_t ggsvp3(
     lapack::vector< lapack_int > iwork( (n) );
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ggsvp3", 's', m, n, 0, 0 );
+    lapack_trace_work( iwork, work );
     LAPACK_sggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
         A, &lda_,
@@ -169,6 +172,8 @@ int64_t ggsvp3(
     lapack::vector< lapack_int > iwork( (n) );
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ggsvp3", 'd', m, n, 0, 0 );
+    lapack_trace_work( iwork, work );
     LAPACK_dggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
         A, &lda_,
@@ -259,6 +264,8 @@ int64_t ggsvp3(
     lapack::vector< float > rwork( (2*n) );
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ggsvp3", 'c', m, n, 0, 0 );
+    lapack_trace_work( iwork, rwork, work );
     LAPACK_cggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -350,6 +357,8 @@ int64_t ggsvp3(
     lapack::vector< double > rwork( (2*n) );
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ggsvp3", 'z', m, n, 0, 0 );
+    lapack_trace_work( iwork, rwork, work );
     LAPACK_zggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +46,8 @@ int64_t gtcon(
     lapack::vector< float > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgtcon(
         &norm_, &n_,
         DL,
@@ -94,6 +97,8 @@ int64_t gtcon(
     lapack::vector< double > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgtcon(
         &norm_, &n_,
         DL,
@@ -142,6 +147,8 @@ int64_t gtcon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "gtcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cgtcon(
         &norm_, &n_,
         (lapack_complex_float*) DL,
@@ -245,6 +252,8 @@ int64_t gtcon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "gtcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zgtcon(
         &norm_, &n_,
         (lapack_complex_double*) DL,
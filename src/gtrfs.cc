@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -57,6 +58,8 @@ int64_t gtrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgtrfs(
         &trans_, &n_, &nrhs_,
         DL,
@@ -125,6 +128,8 @@ int64_t gtrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgtrfs(
         &trans_, &n_, &nrhs_,
         DL,
@@ -193,6 +198,8 @@ int64_t gtrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gtrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgtrfs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) DL,
@@ -352,6 +359,8 @@ int64_t gtrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gtrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgtrfs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) DL,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -34,6 +36,8 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gtsv", 's', n, n, nrhs,
+                        Gflop< float >::gtsv( n, nrhs ) );
     LAPACK_sgtsv(
         &n_, &nrhs_,
         DL,
@@ -66,6 +70,8 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gtsv", 'd', n, n, nrhs,
+                        Gflop< double >::gtsv( n, nrhs ) );
     LAPACK_dgtsv(
         &n_, &nrhs_,
         DL,
@@ -98,6 +104,8 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gtsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gtsv( n, nrhs ) );
     LAPACK_cgtsv(
         &n_, &nrhs_,
         (lapack_complex_float*) DL,
@@ -181,6 +189,8 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gtsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gtsv( n, nrhs ) );
     LAPACK_zgtsv(
         &n_, &nrhs_,
         (lapack_complex_double*) DL,
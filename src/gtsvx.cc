@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -59,6 +60,8 @@ int64_t gtsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sgtsvx(
         &fact_, &trans_, &n_, &nrhs_,
         DL,
@@ -132,6 +135,8 @@ int64_t gtsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "gtsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dgtsvx(
         &fact_, &trans_, &n_, &nrhs_,
         DL,
@@ -205,6 +210,8 @@ int64_t gtsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "gtsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cgtsvx(
         &fact_, &trans_, &n_, &nrhs_,
         (lapack_complex_float*) DL,
@@ -434,6 +441,8 @@ int64_t gtsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "gtsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zgtsvx(
         &fact_, &trans_, &n_, &nrhs_,
         (lapack_complex_double*) DL,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +41,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrf", 's', n, n, 0, Gflop< float >::gttrf( n ) );
     LAPACK_sgttrf(
         &n_,
         DL,
@@ -79,6 +82,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrf", 'd', n, n, 0, Gflop< double >::gttrf( n ) );
     LAPACK_dgttrf(
         &n_,
         DL,
@@ -119,6 +123,8 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrf", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::gttrf( n ) );
     LAPACK_cgttrf(
         &n_,
         (lapack_complex_float*) DL,
@@ -215,6 +221,8 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrf", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::gttrf( n ) );
     LAPACK_zgttrf(
         &n_,
         (lapack_complex_double*) DL,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +47,8 @@ int64_t gttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrs", 's', n, n, nrhs,
+                        Gflop< float >::gttrs( n, nrhs ) );
     LAPACK_sgttrs(
         &trans_, &n_, &nrhs_,
         DL,
@@ -93,6 +97,8 @@ int64_t gttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrs", 'd', n, n, nrhs,
+                        Gflop< double >::gttrs( n, nrhs ) );
     LAPACK_dgttrs(
         &trans_, &n_, &nrhs_,
         DL,
@@ -141,6 +147,8 @@ int64_t gttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::gttrs( n, nrhs ) );
     LAPACK_cgttrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) DL,
@@ -254,6 +262,8 @@ int64_t gttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "gttrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::gttrs( n, nrhs ) );
     LAPACK_zgttrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) DL,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +43,9 @@ int64_t hbev(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hbev", 'c', n, n, kd,
+                        Gflop< std::complex<float> >::hbev( jobz, n, kd ) );
+    lapack_trace_work( work, rwork );
     LAPACK_chbev(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -84,6 +89,9 @@ int64_t hbev(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hbev", 'z', n, n, kd,
+                        Gflop< std::complex<double> >::hbev( jobz, n, kd ) );
+    lapack_trace_work( work, rwork );
     LAPACK_zhbev(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hbev_2stage(
+/// @see lapack::hbev_2stage_work_query
+lapack::WorkSizes hbev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
     float* W,
@@ -59,10 +62,40 @@ int64_t hbev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hbev_2stage_work
+int64_t hbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbev_2stage", 'c', n, n, kd,
+                        Gflop< std::complex<float> >::hbev( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float) );
     LAPACK_chbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -82,6 +115,38 @@ int64_t hbev_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = hbev_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+
+    return hbev_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hbev_2stage_work. Takes the same arguments as
+/// lapack::hbev_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes hbev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
@@ -122,10 +187,56 @@ int64_t hbev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::hbev_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hbev_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hbev_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::hbev_2stage_work_query.
+int64_t hbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbev_2stage", 'z', n, n, kd,
+                        Gflop< std::complex<double> >::hbev( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double) );
     LAPACK_zhbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -143,6 +254,33 @@ int64_t hbev_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = hbev_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+
+    return hbev_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +68,9 @@ int64_t hbevd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hbevd", 'c', n, n, kd,
+                        Gflop< std::complex<float> >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chbevd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -135,6 +140,9 @@ int64_t hbevd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hbevd", 'z', n, n, kd,
+                        Gflop< std::complex<double> >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhbevd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
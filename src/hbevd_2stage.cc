@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hbevd_2stage(
+/// @see lapack::hbevd_2stage_work_query
+lapack::WorkSizes hbevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
     float* W,
@@ -63,11 +66,45 @@ int64_t hbevd_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hbevd_2stage_work
+int64_t hbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbevd_2stage", 'c', n, n, kd,
+                        Gflop< std::complex<float> >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_chbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -88,6 +125,40 @@ int64_t hbevd_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = hbevd_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return hbevd_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hbevd_2stage_work. Takes the same arguments as
+/// lapack::hbevd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes hbevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
@@ -132,11 +203,68 @@ int64_t hbevd_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::hbevd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hbevd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hbevd_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::hbevd_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::hbevd_2stage_work_query.
+int64_t hbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbevd_2stage", 'z', n, n, kd,
+                        Gflop< std::complex<double> >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zhbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -155,6 +283,35 @@ int64_t hbevd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = hbevd_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return hbevd_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -60,6 +62,8 @@ int64_t hbevx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hbevx", 'c', n, n, kd, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -78,6 +82,8 @@ int64_t hbevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -131,6 +137,8 @@ int64_t hbevx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hbevx", 'z', n, n, kd, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -149,6 +157,8 @@ int64_t hbevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hbevx_2stage(
+/// @see lapack::hbevx_2stage_work_query
+lapack::WorkSizes hbevx_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
     std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
@@ -48,13 +51,7 @@ int64_t hbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = (lapack_int*) ifail;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -81,11 +78,66 @@ int64_t hbevx_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    int64_t liwork = 5*n;
+    #ifndef LAPACK_ILP64
+        liwork += n;  // 32-bit copy of ifail
+    #endif
+    return { lwork_, 7*n, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hbevx_2stage_work
+int64_t hbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 7*n );
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < n );
+        liwork -= n;
+        lapack_int* ifail_ = &iwork[ liwork ];
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_error_if( liwork < 5*n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbevx_2stage", 'c', n, n, kd, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_chbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -104,6 +156,8 @@ int64_t hbevx_2stage(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -114,6 +168,49 @@ int64_t hbevx_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    WorkSizes sizes = hbevx_2stage_work_query(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return hbevx_2stage_work(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hbevx_2stage_work. Takes the same arguments as
+/// lapack::hbevx_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes hbevx_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
@@ -143,13 +240,7 @@ int64_t hbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = (lapack_int*) ifail;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -176,11 +267,92 @@ int64_t hbevx_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    int64_t liwork = 5*n;
+    #ifndef LAPACK_ILP64
+        liwork += n;  // 32-bit copy of ifail
+    #endif
+    return { lwork_, 7*n, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::hbevx_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hbevx_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hbevx_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::hbevx_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::hbevx_2stage_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last n elements
+///     hold a 32-bit copy of ifail, so liwork must be the query value,
+///     not LAPACK's documented minimum.
+int64_t hbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 7*n );
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < n );
+        liwork -= n;
+        lapack_int* ifail_ = &iwork[ liwork ];
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_error_if( liwork < 5*n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hbevx_2stage", 'z', n, n, kd, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zhbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -199,6 +371,8 @@ int64_t hbevx_2stage(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -207,6 +381,44 @@ int64_t hbevx_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    WorkSizes sizes = hbevx_2stage_work_query(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return hbevx_2stage_work(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
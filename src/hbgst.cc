@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +46,8 @@ int64_t hbgst(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "hbgst", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -92,6 +95,8 @@ int64_t hbgst(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "hbgst", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -46,6 +47,8 @@ int64_t hbgv(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (3*n) );
 
+    lapack_trace_block( "hbgv", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -95,6 +98,8 @@ int64_t hbgv(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (3*n) );
 
+    lapack_trace_block( "hbgv", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -75,6 +76,8 @@ int64_t hbgvd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hbgvd", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -154,6 +157,8 @@ int64_t hbgvd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hbgvd", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +66,8 @@ int64_t hbgvx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hbgvx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -142,6 +145,8 @@ int64_t hbgvx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hbgvx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
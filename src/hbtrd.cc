@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +42,8 @@ int64_t hbtrd(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "hbtrd", 'c', n, n, kd, 0 );
+    lapack_trace_work( work );
     LAPACK_chbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -84,6 +87,8 @@ int64_t hbtrd(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "hbtrd", 'z', n, n, kd, 0 );
+    lapack_trace_work( work );
     LAPACK_zhbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -43,6 +44,8 @@ int64_t hecon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "hecon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_checon(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -130,6 +133,8 @@ int64_t hecon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "hecon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zhecon(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
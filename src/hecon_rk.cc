@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -46,6 +47,8 @@ int64_t hecon_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "hecon_rk", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_checon_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -169,6 +172,8 @@ int64_t hecon_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "hecon_rk", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zhecon_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -37,6 +38,8 @@ int64_t heequb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "heequb", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cheequb(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -119,6 +122,8 @@ int64_t heequb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "heequb", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zheequb(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
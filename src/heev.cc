@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +58,9 @@ int64_t heev(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "heev", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::heev( jobz, n ) );
+    lapack_trace_work( work, rwork );
     LAPACK_cheev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -160,6 +165,9 @@ int64_t heev(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "heev", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::heev( jobz, n ) );
+    lapack_trace_work( work, rwork );
     LAPACK_zheev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
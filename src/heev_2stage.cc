@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::heev_2stage_work_query
 /// @ingroup heev
-int64_t heev_2stage(
+lapack::WorkSizes heev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* W )
@@ -54,10 +57,36 @@ int64_t heev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heev_2stage_work
+/// @ingroup heev
+int64_t heev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heev_2stage", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::heev_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float) );
     LAPACK_cheev_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -74,6 +103,31 @@ int64_t heev_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = heev_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+
+    return heev_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes all eigenvalues and, optionally, eigenvectors of a
 /// Hermitian matrix A using the 2-stage technique for
@@ -125,35 +179,14 @@ int64_t heev_2stage(
 ///              form did not converge to zero.
 ///
 // -----------------------------------------------------------------------------
-/// @par Further Details
-///
-/// All details about the 2-stage techniques are available in:
+/// Workspace query for lapack::heev_2stage_work. Takes the same arguments as
+/// lapack::heev_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
 ///
-/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
-/// Parallel reduction to condensed forms for symmetric eigenvalue problems
-/// using aggregated fine-grained and memory-aware kernels. In Proceedings
-/// of 2011 International Conference for High Performance Computing,
-/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
-/// Article 8, 11 pages.
-/// http://doi.acm.org/10.1145/2063384.2063394
-///
-/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
-/// An improved parallel singular value algorithm and its implementation
-/// for multicore hardware, In Proceedings of 2013 International Conference
-/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
-/// Denver, Colorado, USA, 2013.
-/// Article 90, 12 pages.
-/// http://doi.acm.org/10.1145/2503210.2503292
-///
-/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
-/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
-/// calculations based on fine-grained memory aware tasks.
-/// International Journal of High Performance Computing Applications.
-/// Volume 28 Issue 2, Pages 196-209, May 2014.
-/// http://hpc.sagepub.com/content/28/2/196
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
 ///
 /// @ingroup heev
-int64_t heev_2stage(
+lapack::WorkSizes heev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* W )
@@ -188,10 +221,53 @@ int64_t heev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::heev_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::heev_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::heev_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::heev_2stage_work_query.
+///
+/// @ingroup heev
+int64_t heev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heev_2stage", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::heev_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double) );
     LAPACK_zheev_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -208,6 +284,58 @@ int64_t heev_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @par Further Details
+///
+/// All details about the 2-stage techniques are available in:
+///
+/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
+/// Parallel reduction to condensed forms for symmetric eigenvalue problems
+/// using aggregated fine-grained and memory-aware kernels. In Proceedings
+/// of 2011 International Conference for High Performance Computing,
+/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
+/// Article 8, 11 pages.
+/// http://doi.acm.org/10.1145/2063384.2063394
+///
+/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
+/// An improved parallel singular value algorithm and its implementation
+/// for multicore hardware, In Proceedings of 2013 International Conference
+/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
+/// Denver, Colorado, USA, 2013.
+/// Article 90, 12 pages.
+/// http://doi.acm.org/10.1145/2503210.2503292
+///
+/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
+/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
+/// calculations based on fine-grained memory aware tasks.
+/// International Journal of High Performance Computing Applications.
+/// Volume 28 Issue 2, Pages 196-209, May 2014.
+/// http://hpc.sagepub.com/content/28/2/196
+///
+/// @ingroup heev
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = heev_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+
+    return heev_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
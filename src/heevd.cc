@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -21,6 +24,21 @@ int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* W )
+{
+    lapack::Workspace workspace;
+    return heevd(
+        jobz, uplo, n,
+        A, lda,
+        W, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_work_query
+/// @ingroup heev
+lapack::WorkSizes heevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,34 +51,77 @@ int64_t heevd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cheevd(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        W,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_, liwork_;
+    internal::WorkSizeKey key(
+        "cheevd", { jobz_, uplo_ }, { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cheevd(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            W,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = real(qry_rwork[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, liwork_ } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_work
+/// @ingroup heev
+int64_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "heevd", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::heevd( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cheevd(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -78,6 +139,36 @@ int64_t heevd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = heevd_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+    float* rwork = workspace.take< float >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return heevd_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes all eigenvalues and, optionally, eigenvectors of a
 // Hermitian matrix A. If eigenvectors are desired, it uses a
@@ -143,6 +234,26 @@ int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* W )
+{
+    lapack::Workspace workspace;
+    return heevd(
+        jobz, uplo, n,
+        A, lda,
+        W, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::heevd_work. Takes the same arguments as
+/// lapack::heevd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes heevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -155,34 +266,101 @@ int64_t heevd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zheevd(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        W,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_, liwork_;
+    internal::WorkSizeKey key(
+        "zheevd", { jobz_, uplo_ }, { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zheevd(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            W,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = real(qry_rwork[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, liwork_ } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::heevd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::heevd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::heevd_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::heevd_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::heevd_work_query.
+///
+/// @ingroup heev
+int64_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heevd", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::heevd( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zheevd(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -200,4 +378,34 @@ int64_t heevd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = heevd_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+    double* rwork = workspace.take< double >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return heevd_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::heevd_2stage_work_query
 /// @ingroup heev
-int64_t heevd_2stage(
+lapack::WorkSizes heevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* W )
@@ -58,11 +61,41 @@ int64_t heevd_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_2stage_work
+/// @ingroup heev
+int64_t heevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "heevd_2stage", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::heevd_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cheevd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -80,6 +113,33 @@ int64_t heevd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = heevd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return heevd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes all eigenvalues and, optionally, eigenvectors of a
 /// Hermitian matrix A using the 2-stage technique for
@@ -143,35 +203,14 @@ int64_t heevd_2stage(
 ///              mod(info,n+1).
 ///
 // -----------------------------------------------------------------------------
-/// @par Further Details
-///
-/// All details about the 2-stage techniques are available in:
+/// Workspace query for lapack::heevd_2stage_work. Takes the same arguments as
+/// lapack::heevd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
 ///
-/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
-/// Parallel reduction to condensed forms for symmetric eigenvalue problems
-/// using aggregated fine-grained and memory-aware kernels. In Proceedings
-/// of 2011 International Conference for High Performance Computing,
-/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
-/// Article 8, 11 pages.
-/// http://doi.acm.org/10.1145/2063384.2063394
-///
-/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
-/// An improved parallel singular value algorithm and its implementation
-/// for multicore hardware, In Proceedings of 2013 International Conference
-/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
-/// Denver, Colorado, USA, 2013.
-/// Article 90, 12 pages.
-/// http://doi.acm.org/10.1145/2503210.2503292
-///
-/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
-/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
-/// calculations based on fine-grained memory aware tasks.
-/// International Journal of High Performance Computing Applications.
-/// Volume 28 Issue 2, Pages 196-209, May 2014.
-/// http://hpc.sagepub.com/content/28/2/196
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
 ///
 /// @ingroup heev
-int64_t heevd_2stage(
+lapack::WorkSizes heevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* W )
@@ -210,11 +249,65 @@ int64_t heevd_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, lrwork_, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::heevd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::heevd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::heevd_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::heevd_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::heevd_2stage_work_query.
+///
+/// @ingroup heev
+int64_t heevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heevd_2stage", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::heevd_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zheevd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -232,6 +325,60 @@ int64_t heevd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @par Further Details
+///
+/// All details about the 2-stage techniques are available in:
+///
+/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
+/// Parallel reduction to condensed forms for symmetric eigenvalue problems
+/// using aggregated fine-grained and memory-aware kernels. In Proceedings
+/// of 2011 International Conference for High Performance Computing,
+/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
+/// Article 8, 11 pages.
+/// http://doi.acm.org/10.1145/2063384.2063394
+///
+/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
+/// An improved parallel singular value algorithm and its implementation
+/// for multicore hardware, In Proceedings of 2013 International Conference
+/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
+/// Denver, Colorado, USA, 2013.
+/// Article 90, 12 pages.
+/// http://doi.acm.org/10.1145/2503210.2503292
+///
+/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
+/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
+/// calculations based on fine-grained memory aware tasks.
+/// International Journal of High Performance Computing Applications.
+/// Volume 28 Issue 2, Pages 196-209, May 2014.
+/// http://hpc.sagepub.com/content/28/2/196
+///
+/// @ingroup heev
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = heevd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return heevd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
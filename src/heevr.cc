@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -24,6 +27,27 @@ int64_t heevr(
     float* W,
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz )
+{
+    lapack::Workspace workspace;
+    return heevr(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr_work_query
+/// @ingroup heev
+lapack::WorkSizes heevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,45 +66,105 @@ int64_t heevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_, liwork_;
+    internal::WorkSizeKey key(
+        "cheevr", { jobz_, range_, uplo_ }, { n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cheevr(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            isuppz_ptr,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = real(qry_rwork[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, liwork_ } );
+    }
+
+    int64_t liwork = liwork_;
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, lrwork_, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr_work
+/// @ingroup heev
+int64_t heevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // was max(1,nfound), n >= nfound
         lapack_int* isuppz_ptr = &isuppz_[0];
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cheevr(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
+    lapack_trace_block( "heevr", 'c', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cheevr(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -98,12 +182,53 @@ int64_t heevr(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::heevr( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr
+/// @ingroup heev
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = heevr_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<float>* work = workspace.take< std::complex<float> >( sizes.lwork );
+    float* rwork = workspace.take< float >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return heevr_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes selected eigenvalues and, optionally, eigenvectors
 /// of a Hermitian matrix A. Eigenvalues and eigenvectors can
@@ -306,6 +431,138 @@ int64_t heevr(
     double* W,
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
+{
+    lapack::Workspace workspace;
+    return heevr(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::heevr_work. Takes the same arguments as
+/// lapack::heevr; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes heevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    lapack_int lwork_, lrwork_, liwork_;
+    internal::WorkSizeKey key(
+        "zheevr", { jobz_, range_, uplo_ }, { n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        lrwork_ = sizes.lrwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zheevr(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            isuppz_ptr,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        lrwork_ = real(qry_rwork[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, lrwork_, liwork_ } );
+    }
+
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, lrwork_, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::heevr, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::heevr.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::heevr_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::heevr_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::heevr_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last 2 max( 1, n )
+///     elements hold a 32-bit copy of isuppz, so liwork must be the
+///     query value, not LAPACK's documented minimum.
+///
+/// @ingroup heev
+int64_t heevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -314,6 +571,9 @@ int64_t heevr(
         lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
     }
     char jobz_ = job2char( jobz );
     char range_ = range2char( range );
@@ -325,44 +585,22 @@ int64_t heevr(
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // was max(1,nfound), n >= nfound
         lapack_int* isuppz_ptr = &isuppz_[0];
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zheevr(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
+    lapack_trace_block( "heevr", 'z', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zheevr(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -380,10 +618,51 @@ int64_t heevr(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::heevr( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr
+/// @ingroup heev
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = heevr_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    workspace.reset();
+    std::complex<double>* work = workspace.take< std::complex<double> >( sizes.lwork );
+    double* rwork = workspace.take< double >( sizes.lrwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return heevr_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work, sizes.lwork,
+        rwork, sizes.lrwork,
+        iwork, sizes.liwork );
+}
+
 }  // namespace lapack
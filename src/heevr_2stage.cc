@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::heevr_2stage_work_query
 /// @ingroup heev
-int64_t heevr_2stage(
+lapack::WorkSizes heevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
@@ -44,13 +47,7 @@ int64_t heevr_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -78,11 +75,64 @@ int64_t heevr_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, lrwork_, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr_2stage_work
+/// @ingroup heev
+int64_t heevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heevr_2stage", 'c', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float),
+                       liwork*sizeof(lapack_int) );
     LAPACK_cheevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -100,12 +150,50 @@ int64_t heevr_2stage(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::heevr_2stage( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    WorkSizes sizes = heevr_2stage_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return heevr_2stage_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes selected eigenvalues and, optionally, eigenvectors
 /// of a Hermitian matrix A using the 2-stage technique for
@@ -303,35 +391,14 @@ int64_t heevr_2stage(
 /// @return > 0: Internal error
 ///
 // -----------------------------------------------------------------------------
-/// @par Further Details
+/// Workspace query for lapack::heevr_2stage_work. Takes the same arguments as
+/// lapack::heevr_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
 ///
-/// All details about the 2-stage techniques are available in:
-///
-/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
-/// Parallel reduction to condensed forms for symmetric eigenvalue problems
-/// using aggregated fine-grained and memory-aware kernels. In Proceedings
-/// of 2011 International Conference for High Performance Computing,
-/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
-/// Article 8, 11 pages.
-/// http://doi.acm.org/10.1145/2063384.2063394
-///
-/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
-/// An improved parallel singular value algorithm and its implementation
-/// for multicore hardware, In Proceedings of 2013 International Conference
-/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
-/// Denver, Colorado, USA, 2013.
-/// Article 90, 12 pages.
-/// http://doi.acm.org/10.1145/2503210.2503292
-///
-/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
-/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
-/// calculations based on fine-grained memory aware tasks.
-/// International Journal of High Performance Computing Applications.
-/// Volume 28 Issue 2, Pages 196-209, May 2014.
-/// http://hpc.sagepub.com/content/28/2/196
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
 ///
 /// @ingroup heev
-int64_t heevr_2stage(
+lapack::WorkSizes heevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
@@ -356,13 +423,7 @@ int64_t heevr_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -390,11 +451,91 @@ int64_t heevr_2stage(
     lapack_int lrwork_ = real(qry_rwork[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, lrwork_, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::heevr_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::heevr_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::heevr_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::heevr_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::heevr_2stage_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last 2 max( 1, n )
+///     elements hold a 32-bit copy of isuppz, so liwork must be the
+///     query value, not LAPACK's documented minimum.
+///
+/// @ingroup heev
+int64_t heevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "heevr_2stage", 'z', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double),
+                       liwork*sizeof(lapack_int) );
     LAPACK_zheevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -412,12 +553,77 @@ int64_t heevr_2stage(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::heevr_2stage( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @par Further Details
+///
+/// All details about the 2-stage techniques are available in:
+///
+/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
+/// Parallel reduction to condensed forms for symmetric eigenvalue problems
+/// using aggregated fine-grained and memory-aware kernels. In Proceedings
+/// of 2011 International Conference for High Performance Computing,
+/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
+/// Article 8, 11 pages.
+/// http://doi.acm.org/10.1145/2063384.2063394
+///
+/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
+/// An improved parallel singular value algorithm and its implementation
+/// for multicore hardware, In Proceedings of 2013 International Conference
+/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
+/// Denver, Colorado, USA, 2013.
+/// Article 90, 12 pages.
+/// http://doi.acm.org/10.1145/2503210.2503292
+///
+/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
+/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
+/// calculations based on fine-grained memory aware tasks.
+/// International Journal of High Performance Computing Applications.
+/// Volume 28 Issue 2, Pages 196-209, May 2014.
+/// http://hpc.sagepub.com/content/28/2/196
+///
+/// @ingroup heev
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    WorkSizes sizes = heevr_2stage_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return heevr_2stage_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
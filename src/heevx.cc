@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -79,6 +81,8 @@ int64_t heevx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "heevx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_cheevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -96,6 +100,8 @@ int64_t heevx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<float> >::heevx( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
@@ -296,6 +302,8 @@ int64_t heevx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "heevx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zheevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -313,6 +321,8 @@ int64_t heevx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop(
+        Gflop< std::complex<double> >::heevx( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -34,6 +35,7 @@ int64_t hegst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hegst", 'c', n, n, 0, 0 );
     LAPACK_chegst(
         &itype_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -68,6 +70,7 @@ int64_t hegst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hegst", 'z', n, n, 0, 0 );
     LAPACK_zhegst(
         &itype_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -61,6 +62,8 @@ int64_t hegv(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hegv", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chegv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -124,6 +127,8 @@ int64_t hegv(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hegv", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhegv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
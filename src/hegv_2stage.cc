@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +19,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hegv_2stage(
+/// @see lapack::hegv_2stage_work_query
+lapack::WorkSizes hegv_2stage_work_query(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
@@ -59,10 +61,39 @@ int64_t hegv_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::hegv_2stage_work
+int64_t hegv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    lapack_int itype_ = (lapack_int) itype;
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "hegv_2stage", 'c', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<float>), lrwork*sizeof(float) );
     LAPACK_chegv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -82,6 +113,38 @@ int64_t hegv_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = hegv_2stage_work_query(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+    lapack::vector< float > rwork( sizes.lrwork );
+
+    return hegv_2stage_work(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hegv_2stage_work. Takes the same arguments as
+/// lapack::hegv_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes hegv_2stage_work_query(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
@@ -122,10 +185,55 @@ int64_t hegv_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+    return { lwork_, max( 1, 3*n-2 ), 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::hegv_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hegv_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hegv_2stage_work_query.
+///
+/// @param[out] rwork
+///     Workspace array of length lrwork.
+///
+/// @param[in] lrwork
+///     The length of rwork; at least sizes.lrwork from
+///     lapack::hegv_2stage_work_query.
+int64_t hegv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+    lapack_int itype_ = (lapack_int) itype;
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "hegv_2stage", 'z', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(std::complex<double>), lrwork*sizeof(double) );
     LAPACK_zhegv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -143,6 +251,33 @@ int64_t hegv_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = hegv_2stage_work_query(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+    lapack::vector< double > rwork( sizes.lrwork );
+
+    return hegv_2stage_work(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W,
+        work.data(), sizes.lwork,
+        rwork.data(), sizes.lrwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
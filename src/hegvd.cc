@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t hegvd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hegvd", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chegvd(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -135,6 +138,8 @@ int64_t hegvd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hegvd", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhegvd(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
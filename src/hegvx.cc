@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -84,6 +85,8 @@ int64_t hegvx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hegvx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chegvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -179,6 +182,8 @@ int64_t hegvx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hegvx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhegvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
@@ -67,6 +68,8 @@ int64_t herfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "herfsx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cherfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -413,6 +416,8 @@ int64_t herfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "herfsx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zherfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +67,9 @@ int64_t hesv(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hesv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::hesv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_chesv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -211,6 +216,9 @@ int64_t hesv(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hesv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::hesv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zhesv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -67,6 +69,9 @@ int64_t hesv_aa(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hesv_aa", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::hesv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_chesv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -205,6 +210,9 @@ int64_t hesv_aa(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hesv_aa", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::hesv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zhesv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -82,6 +83,8 @@ int64_t hesvx(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "hesvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chesvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -307,6 +310,8 @@ int64_t hesvx(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "hesvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhesvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
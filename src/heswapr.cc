@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30301  // >= 3.3.1
 
@@ -35,6 +36,7 @@ void heswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "heswapr", 'c', n, n, 0, 0 );
     LAPACK_cheswapr(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &i1_, &i2_
@@ -93,6 +95,7 @@ void heswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "heswapr", 'z', n, n, 0, 0 );
     LAPACK_zheswapr(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &i1_, &i2_
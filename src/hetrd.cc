@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -16,8 +18,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::hetrd_work_query
 /// @ingroup heev_computational
-int64_t hetrd(
+lapack::WorkSizes hetrd_work_query(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
@@ -53,9 +56,35 @@ int64_t hetrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_work
+/// @ingroup heev_computational
+int64_t hetrd_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "hetrd", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>) );
     LAPACK_chetrd(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -73,6 +102,35 @@ int64_t hetrd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = hetrd_work_query(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+
+    return hetrd_work(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        work.data(), sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Reduces a Hermitian matrix A to real symmetric
 /// tridiagonal form T by a unitary similarity transformation:
@@ -133,6 +191,106 @@ int64_t hetrd(
 ///
 /// @return = 0: successful exit
 ///
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hetrd_work. Takes the same arguments as
+/// lapack::hetrd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev_computational
+lapack::WorkSizes hetrd_work_query(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zhetrd(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    lapack_int lwork_ = real(qry_work[0]);
+
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::hetrd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hetrd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hetrd_work_query.
+///
+/// @ingroup heev_computational
+int64_t hetrd_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hetrd", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>) );
+    LAPACK_zhetrd(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// @par Further Details
 ///
@@ -188,53 +346,24 @@ int64_t hetrd(
     double* E,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhetrd(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
+    WorkSizes sizes = hetrd_work_query(
+        uplo, n,
+        A, lda,
         D,
         E,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+        tau );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( sizes.lwork );
 
-    LAPACK_zhetrd(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
+    return hetrd_work(
+        uplo, n,
+        A, lda,
         D,
         E,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+        tau,
+        work.data(), sizes.lwork );
 }
 
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= v3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage_work_query
 /// @ingroup heev_computational
-int64_t hetrd_2stage(
+lapack::WorkSizes hetrd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
@@ -60,9 +63,39 @@ int64_t hetrd_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage_work
+/// @ingroup heev_computational
+int64_t hetrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    std::complex<float>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hetrd_2stage", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<float>) );
     LAPACK_chetrd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -81,6 +114,38 @@ int64_t hetrd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2 )
+{
+    // query for workspace size
+    WorkSizes sizes = hetrd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2 );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( sizes.lwork );
+
+    return hetrd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2,
+        work.data(), sizes.lwork );
+}
+
 // -----------------------------------------------------------------------------
 /// Reduces a Hermitian matrix A to real symmetric
 /// tridiagonal form T by a unitary similarity transformation:
@@ -164,37 +229,14 @@ int64_t hetrd_2stage(
 /// @return = 0: successful exit
 ///
 // -----------------------------------------------------------------------------
-/// @par Further Details
-///
-/// Implemented by Azzam Haidar.
+/// Workspace query for lapack::hetrd_2stage_work. Takes the same arguments as
+/// lapack::hetrd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
 ///
-/// All details are available on technical report, SC11, SC13 papers.
-///
-/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
-/// Parallel reduction to condensed forms for symmetric eigenvalue problems
-/// using aggregated fine-grained and memory-aware kernels. In Proceedings
-/// of 2011 International Conference for High Performance Computing,
-/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
-/// Article 8, 11 pages.
-/// http://doi.acm.org/10.1145/2063384.2063394
-///
-/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
-/// An improved parallel singular value algorithm and its implementation
-/// for multicore hardware, In Proceedings of 2013 International Conference
-/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
-/// Denver, Colorado, USA, 2013.
-/// Article 90, 12 pages.
-/// http://doi.acm.org/10.1145/2503210.2503292
-///
-/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
-/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
-/// calculations based on fine-grained memory aware tasks.
-/// International Journal of High Performance Computing Applications.
-/// Volume 28 Issue 2, Pages 196-209, May 2014.
-/// http://hpc.sagepub.com/content/28/2/196
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
 ///
 /// @ingroup heev_computational
-int64_t hetrd_2stage(
+lapack::WorkSizes hetrd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* D,
@@ -235,9 +277,49 @@ int64_t hetrd_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::hetrd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::hetrd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::hetrd_2stage_work_query.
+///
+/// @ingroup heev_computational
+int64_t hetrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    std::complex<double>* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "hetrd_2stage", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrd( n ) );
+    lapack_trace_work( lwork*sizeof(std::complex<double>) );
     LAPACK_zhetrd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -256,6 +338,67 @@ int64_t hetrd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @par Further Details
+///
+/// Implemented by Azzam Haidar.
+///
+/// All details are available on technical report, SC11, SC13 papers.
+///
+/// Azzam Haidar, Hatem Ltaief, and Jack Dongarra.
+/// Parallel reduction to condensed forms for symmetric eigenvalue problems
+/// using aggregated fine-grained and memory-aware kernels. In Proceedings
+/// of 2011 International Conference for High Performance Computing,
+/// Networking, Storage and Analysis (SC '11), New York, NY, USA,
+/// Article 8, 11 pages.
+/// http://doi.acm.org/10.1145/2063384.2063394
+///
+/// A. Haidar, J. Kurzak, P. Luszczek, 2013.
+/// An improved parallel singular value algorithm and its implementation
+/// for multicore hardware, In Proceedings of 2013 International Conference
+/// for High Performance Computing, Networking, Storage and Analysis (SC '13).
+/// Denver, Colorado, USA, 2013.
+/// Article 90, 12 pages.
+/// http://doi.acm.org/10.1145/2503210.2503292
+///
+/// A. Haidar, R. Solca, S. Tomov, T. Schulthess and J. Dongarra.
+/// A novel hybrid CPU-GPU generalized eigensolver for electronic structure
+/// calculations based on fine-grained memory aware tasks.
+/// International Journal of High Performance Computing Applications.
+/// Volume 28 Issue 2, Pages 196-209, May 2014.
+/// http://hpc.sagepub.com/content/28/2/196
+///
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2 )
+{
+    // query for workspace size
+    WorkSizes sizes = hetrd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2 );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( sizes.lwork );
+
+    return hetrd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.7
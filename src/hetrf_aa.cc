@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -61,6 +63,9 @@ int64_t hetrf_aa(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hetrf_aa", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrf( n ) );
+    lapack_trace_work( work );
     LAPACK_chetrf_aa(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -79,6 +84,71 @@ int64_t hetrf_aa(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup hesv_aa_computational
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_chetrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    lapack_int lwork_ = real(qry_work[0]);
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork_ );
+
+    lapack_trace_block( "hetrf_aa", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrf( n ) );
+    lapack_trace_work( work );
+    LAPACK_chetrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the factorization of a hermitian matrix A
 /// using the Aasen's algorithm. The form of the factorization is
@@ -174,6 +244,9 @@ int64_t hetrf_aa(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hetrf_aa", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrf( n ) );
+    lapack_trace_work( work );
     LAPACK_zhetrf_aa(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -192,6 +265,74 @@ int64_t hetrf_aa(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::hetrf_aa
+/// @ingroup hesv_aa_computational
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int32_t* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zhetrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    lapack_int lwork_ = real(qry_work[0]);
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork_ );
+
+    lapack_trace_block( "hetrf_aa", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrf( n ) );
+    lapack_trace_work( work );
+    LAPACK_zhetrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifdef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
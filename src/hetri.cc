@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -42,6 +44,9 @@ int64_t hetri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "hetri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_chetri(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -129,6 +134,9 @@ int64_t hetri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "hetri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_zhetri(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30301  // >= 3.3.1
@@ -61,6 +63,9 @@ int64_t hetri2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hetri2", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_chetri2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -166,6 +171,9 @@ int64_t hetri2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hetri2", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_zhetri2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -63,6 +65,9 @@ int64_t hetri_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hetri_rk", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_chetri_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -212,6 +217,9 @@ int64_t hetri_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hetri_rk", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_zhetri_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
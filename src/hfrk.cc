@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ void hfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    lapack_trace_block( "hfrk", 'c', n, n, k, 0 );
     LAPACK_chfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         (lapack_complex_float*) A, &lda_, &beta,
@@ -62,6 +64,7 @@ void hfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    lapack_trace_block( "hfrk", 'z', n, n, k, 0 );
     LAPACK_zhfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         (lapack_complex_double*) A, &lda_, &beta,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -76,6 +77,8 @@ int64_t hgeqz(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "hgeqz", 's', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_shgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -161,6 +164,8 @@ int64_t hgeqz(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "hgeqz", 'd', n, n, 0, 0 );
+    lapack_trace_work( alphar, alphai, work );
     LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -244,6 +249,8 @@ int64_t hgeqz(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "hgeqz", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
@@ -323,6 +330,8 @@ int64_t hgeqz(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "hgeqz", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) H, &ldh_,
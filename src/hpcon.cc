@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +41,8 @@ int64_t hpcon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "hpcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_chpcon(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -80,6 +83,8 @@ int64_t hpcon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "hpcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zhpcon(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -37,6 +39,9 @@ int64_t hpev(
     lapack::vector< std::complex<float> > work( (max( 1, 2*n-1 )) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hpev", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hpev( jobz, n ) );
+    lapack_trace_work( work, rwork );
     LAPACK_chpev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -76,6 +81,9 @@ int64_t hpev(
     lapack::vector< std::complex<double> > work( (max( 1, 2*n-1 )) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hpev", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hpev( jobz, n ) );
+    lapack_trace_work( work, rwork );
     LAPACK_zhpev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +64,9 @@ int64_t hpevd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hpevd", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hpevd( jobz, n ) );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chpevd(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -127,6 +132,9 @@ int64_t hpevd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hpevd", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hpevd( jobz, n ) );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhpevd(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -53,6 +55,8 @@ int64_t hpevx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hpevx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chpevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -70,6 +74,7 @@ int64_t hpevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< std::complex<float> >::hpevx( jobz, n, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -116,6 +121,8 @@ int64_t hpevx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hpevx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhpevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -133,6 +140,7 @@ int64_t hpevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< std::complex<double> >::hpevx( jobz, n, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +31,7 @@ int64_t hpgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hpgst", 'c', n, n, 0, 0 );
     LAPACK_chpgst(
         &itype_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -60,6 +62,7 @@ int64_t hpgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hpgst", 'z', n, n, 0, 0 );
     LAPACK_zhpgst(
         &itype_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +41,8 @@ int64_t hpgv(
     lapack::vector< std::complex<float> > work( (max( 1, 2*n-1 )) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hpgv", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chpgv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -83,6 +86,8 @@ int64_t hpgv(
     lapack::vector< std::complex<double> > work( (max( 1, 2*n-1 )) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "hpgv", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhpgv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t hpgvd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hpgvd", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chpgvd(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -136,6 +139,8 @@ int64_t hpgvd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "hpgvd", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhpgvd(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
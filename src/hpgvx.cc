@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +57,8 @@ int64_t hpgvx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hpgvx", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_chpgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -123,6 +126,8 @@ int64_t hpgvx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "hpgvx", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zhpgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +52,8 @@ int64_t hprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "hprfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -108,6 +111,8 @@ int64_t hprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "hprfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
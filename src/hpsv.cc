@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +43,8 @@ int64_t hpsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hpsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::hesv( n, nrhs ) );
     LAPACK_chpsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -85,6 +89,8 @@ int64_t hpsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hpsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::hesv( n, nrhs ) );
     LAPACK_zhpsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -53,6 +54,8 @@ int64_t hpsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "hpsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_chpsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -115,6 +118,8 @@ int64_t hpsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "hpsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zhpsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
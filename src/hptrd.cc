@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,8 @@ int64_t hptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrd", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrd( n ) );
     LAPACK_chptrd(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -62,6 +66,8 @@ int64_t hptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrd", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrd( n ) );
     LAPACK_zhptrd(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
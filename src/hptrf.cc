@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t hptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrf", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetrf( n ) );
     LAPACK_chptrf(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -74,6 +78,8 @@ int64_t hptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrf", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetrf( n ) );
     LAPACK_zhptrf(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
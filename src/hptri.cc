@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +41,9 @@ int64_t hptri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "hptri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_chptri(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -78,6 +83,9 @@ int64_t hptri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "hptri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::hetri( n ) );
+    lapack_trace_work( work );
     LAPACK_zhptri(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +43,8 @@ int64_t hptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::hetrs( n, nrhs ) );
     LAPACK_chptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -82,6 +86,8 @@ int64_t hptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "hptrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::hetrs( n, nrhs ) );
     LAPACK_zhptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
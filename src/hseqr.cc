@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t hseqr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "hseqr", 's', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work );
     LAPACK_shseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -138,6 +141,8 @@ int64_t hseqr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "hseqr", 'd', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work );
     LAPACK_dhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -205,6 +210,8 @@ int64_t hseqr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "hseqr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_chseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
@@ -394,6 +401,8 @@ int64_t hseqr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "hseqr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) H, &ldh_,
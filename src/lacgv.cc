@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ void lacgv(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "lacgv", 'c', n, n, 0, 0 );
     LAPACK_clacgv(
         &n_,
         (lapack_complex_float*) x, &incx_ );
@@ -65,6 +67,7 @@ void lacgv(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "lacgv", 'z', n, n, 0, 0 );
     LAPACK_zlacgv(
         &n_,
         (lapack_complex_double*) x, &incx_ );
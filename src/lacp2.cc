@@ -4,7 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/trace.hh"
+#include "memory_common.hh"
 
 #include <vector>
 
@@ -14,33 +15,59 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Native lacp2, which copies real A to complex B. Converted values go
+// through a small buffer, so large copies can use non-temporal stores.
+// See memory_common.hh for how columns are split over threads.
+template <typename real_t>
+void lacp2(
+    lapack::Uplo uplo, int64_t m, int64_t n,
+    real_t const* A, int64_t lda,
+    std::complex<real_t>* B, int64_t ldb )
+{
+    using scalar_t = std::complex<real_t>;
+
+    MatrixType type = (uplo == Uplo::Upper ? MatrixType::Upper
+                    :  uplo == Uplo::Lower ? MatrixType::Lower
+                    :                        MatrixType::General);
+    bool stream = m * n * int64_t( sizeof(scalar_t) ) >= memory_stream_min;
+    bool contiguous = type == MatrixType::General && lda == m && ldb == m;
+
+    memory_for(
+        type, 0, 0, m, n, contiguous, sizeof(scalar_t),
+        [=]( int64_t j, int64_t first, int64_t last ) {
+            real_t const* Aj = &A[ j*lda ];
+            scalar_t* Bj = &B[ j*ldb ];
+            if (! stream) {
+                for (int64_t i = first; i < last; ++i)
+                    Bj[ i ] = Aj[ i ];
+                return;
+            }
+            scalar_t buffer[ memory_chunk ];
+            for (int64_t i = first; i < last; i += memory_chunk) {
+                int64_t ib = min( memory_chunk, last - i );
+                for (int64_t k = 0; k < ib; ++k)
+                    buffer[ k ] = Aj[ i + k ];
+                memory_copy( ib, buffer, &Bj[ i ], true );
+            }
+        } );
+}
+
+}  // namespace internal
+
 // -----------------------------------------------------------------------------
 void lacp2(
     lapack::Uplo uplo, int64_t m, int64_t n,
     float const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
 
-    LAPACK_clacp2(
-        &uplo_, &m_, &n_,
-        A, &lda_,
-        (lapack_complex_float*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_trace_block( "lacp2", 'c', m, n, 0, 0 );
+    internal::lacp2( uplo, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -49,27 +76,11 @@ void lacp2(
     double const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
 
-    LAPACK_zlacp2(
-        &uplo_, &m_, &n_,
-        A, &lda_,
-        (lapack_complex_double*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_trace_block( "lacp2", 'z', m, n, 0, 0 );
+    internal::lacp2( uplo, m, n, A, lda, B, ldb );
 }
 
 }  // namespace lapack
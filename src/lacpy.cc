@@ -4,7 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/trace.hh"
+#include "memory_common.hh"
 
 #include <vector>
 
@@ -14,6 +15,35 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Native lacpy. Upper and Lower copy the trapezoid including the
+// diagonal, as in the reference lacpy; any other type copies all of A.
+// See memory_common.hh for how columns are split over threads.
+template <typename scalar_t>
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (matrixtype != MatrixType::Upper && matrixtype != MatrixType::Lower)
+        matrixtype = MatrixType::General;
+
+    bool stream = m * n * int64_t( sizeof(scalar_t) ) >= memory_stream_min;
+    bool contiguous = matrixtype == MatrixType::General
+                      && lda == m && ldb == m;
+
+    memory_for(
+        matrixtype, 0, 0, m, n, contiguous, sizeof(scalar_t),
+        [=]( int64_t j, int64_t first, int64_t last ) {
+            memory_copy( last - first, &A[ first + j*lda ],
+                         &B[ first + j*ldb ], stream );
+        } );
+}
+
+}  // namespace internal
+
 // -----------------------------------------------------------------------------
 /// @ingroup initialize
 void lacpy(
@@ -21,27 +51,11 @@ void lacpy(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_slacpy(
-        &matrixtype_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
+
+    lapack_trace_block( "lacpy", 's', m, n, 0, 0 );
+    internal::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -51,27 +65,11 @@ void lacpy(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_dlacpy(
-        &matrixtype_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
+
+    lapack_trace_block( "lacpy", 'd', m, n, 0, 0 );
+    internal::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -81,27 +79,11 @@ void lacpy(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_clacpy(
-        &matrixtype_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
+
+    lapack_trace_block( "lacpy", 'c', m, n, 0, 0 );
+    internal::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -139,33 +121,21 @@ void lacpy(
 /// @param[in] ldb
 ///     The leading dimension of the array B. ldb >= max(1,m).
 ///
+/// This is a native implementation: columns are split over OpenMP threads
+/// in tiles of about equal size, so triangular copies are balanced, and
+/// copies larger than the last level cache use non-temporal stores.
+///
 /// @ingroup initialize
 void lacpy(
     lapack::MatrixType matrixtype, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_zlacpy(
-        &matrixtype_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+    lapack_error_if( ldb < m );
+
+    lapack_trace_block( "lacpy", 'z', m, n, 0, 0 );
+    internal::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 }  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -32,6 +33,7 @@ int64_t laed4(
     lapack_int i_ = (lapack_int) i + 1;  // change to 1-based
     lapack_int info_ = 0;
 
+    lapack_trace_block( "laed4", 's', n, n, 0, 0 );
     LAPACK_slaed4(
         &n_, &i_,
         d,
@@ -113,6 +115,7 @@ int64_t laed4(
     lapack_int i_ = (lapack_int) i + 1;  // change to 1-based
     lapack_int info_ = 0;
 
+    lapack_trace_block( "laed4", 'd', n, n, 0, 0 );
     LAPACK_dlaed4(
         &n_, &i_,
         d,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t lag2d(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lag2d", 's', m, n, 0, 0 );
     LAPACK_slag2d(
         &m_, &n_,
         SA, &ldsa_,
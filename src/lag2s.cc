@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t lag2s(
     lapack_int ldsa_ = (lapack_int) ldsa;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lag2s", 'd', m, n, 0, 0 );
     LAPACK_dlag2s(
         &m_, &n_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t lag2z(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lag2z", 'c', m, n, 0, 0 );
     LAPACK_clag2z(
         &m_, &n_,
         (lapack_complex_float*) SA, &ldsa_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_MATGEN
@@ -49,6 +50,8 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< float > work( (m+n) );
 
+    lapack_trace_block( "lagge", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_slagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -96,6 +99,8 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< double > work( (m+n) );
 
+    lapack_trace_block( "lagge", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dlagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -143,6 +148,8 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m+n) );
 
+    lapack_trace_block( "lagge", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_clagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -190,6 +197,8 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m+n) );
 
+    lapack_trace_block( "lagge", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zlagge(
         &m_, &n_, &kl_, &ku_,
         D,
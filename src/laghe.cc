@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_MATGEN
@@ -45,6 +46,8 @@ int64_t laghe(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "laghe", 'c', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_claghe(
         &n_, &k_,
         D,
@@ -88,6 +91,8 @@ int64_t laghe(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "laghe", 'z', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zlaghe(
         &n_, &k_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_MATGEN
@@ -45,6 +46,8 @@ int64_t lagsy(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "lagsy", 's', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_slagsy(
         &n_, &k_,
         D,
@@ -88,6 +91,8 @@ int64_t lagsy(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "lagsy", 'd', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dlagsy(
         &n_, &k_,
         D,
@@ -131,6 +136,8 @@ int64_t lagsy(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "lagsy", 'c', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_clagsy(
         &n_, &k_,
         D,
@@ -174,6 +181,8 @@ int64_t lagsy(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "lagsy", 'z', n, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zlagsy(
         &n_, &k_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +41,8 @@ float langb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "langb", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_slangb(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -75,6 +78,8 @@ double langb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "langb", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlangb(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -110,6 +115,8 @@ float langb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "langb", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_clangb(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -179,6 +186,8 @@ double langb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "langb", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlangb(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -4,8 +4,9 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
+#include "norm_common.hh"
 
 #include <vector>
 
@@ -21,31 +22,14 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_slange(
-        &norm_, &m_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "lange", 's', m, n, 0,
+                        Gflop< float >::lange( norm, m, n ) );
+    return internal::norm_trapezoid(
+        norm, Uplo::General, Diag::NonUnit, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -54,31 +38,14 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
-
-    return LAPACK_dlange(
-        &norm_, &m_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "lange", 'd', m, n, 0,
+                        Gflop< double >::lange( norm, m, n ) );
+    return internal::norm_trapezoid(
+        norm, Uplo::General, Diag::NonUnit, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -87,31 +54,14 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_clange(
-        &norm_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "lange", 'c', m, n, 0,
+                        Gflop< std::complex<float> >::lange( norm, m, n ) );
+    return internal::norm_trapezoid(
+        norm, Uplo::General, Diag::NonUnit, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -122,6 +72,11 @@ float lange(
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
+/// This is a native implementation, vectorized and multithreaded with
+/// OpenMP. The Frobenius norm uses the scaled sum of squares of
+/// lapack::lassq, so it doesn't overflow or underflow unless the norm does.
+/// Results don't depend on the number of threads.
+///
 /// @param[in] norm
 ///     The value to be returned:
 ///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
@@ -147,31 +102,14 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
-
-    return LAPACK_zlange(
-        &norm_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "lange", 'z', m, n, 0,
+                        Gflop< std::complex<double> >::lange( norm, m, n ) );
+    return internal::norm_trapezoid(
+        norm, Uplo::General, Diag::NonUnit, m, n, A, lda );
 }
 
 }  // namespace lapack
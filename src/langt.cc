@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -29,6 +30,7 @@ float langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "langt", 's', n, n, 0, 0 );
     return LAPACK_slangt(
         &norm_, &n_,
         DL,
@@ -55,6 +57,7 @@ double langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "langt", 'd', n, n, 0, 0 );
     return LAPACK_dlangt(
         &norm_, &n_,
         DL,
@@ -81,6 +84,7 @@ float langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "langt", 'c', n, n, 0, 0 );
     return LAPACK_clangt(
         &norm_, &n_,
         (lapack_complex_float*) DL,
@@ -137,6 +141,7 @@ double langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "langt", 'z', n, n, 0, 0 );
     return LAPACK_zlangt(
         &norm_, &n_,
         (lapack_complex_double*) DL,
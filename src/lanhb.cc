@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,8 @@ float lanhb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhb", 'c', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_clanhb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -116,6 +119,8 @@ double lanhb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhb", 'z', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlanhb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
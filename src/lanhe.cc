@@ -4,8 +4,9 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
+#include "norm_common.hh"
 
 #include <vector>
 
@@ -21,30 +22,12 @@ float lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_clanhe(
-        &norm_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lanhe", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::lanhe( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, true );
 }
 
 // -----------------------------------------------------------------------------
@@ -57,6 +40,11 @@ float lanhe(
 /// For real matrices, this is an alias for `lapack::lansy`.
 /// For complex symmetric matrices, see `lapack::lansy`.
 ///
+/// This is a native implementation, vectorized and multithreaded with
+/// OpenMP. The Frobenius norm uses the scaled sum of squares of
+/// lapack::lassq, so it doesn't overflow or underflow unless the norm does.
+/// Results don't depend on the number of threads.
+///
 /// @param[in] norm
 ///     The value to be returned:
 ///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
@@ -98,30 +86,12 @@ double lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    return LAPACK_zlanhe(
-        &norm_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lanhe", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::lanhe( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, true );
 }
 
 }  // namespace lapack
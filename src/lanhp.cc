@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ float lanhp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhp", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_clanhp(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -101,6 +104,8 @@ double lanhp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhp", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlanhp(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) AP,
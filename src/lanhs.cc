@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +37,8 @@ float lanhs(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhs", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_slanhs(
         &norm_, &n_,
         A, &lda_,
@@ -67,6 +70,8 @@ double lanhs(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhs", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlanhs(
         &norm_, &n_,
         A, &lda_,
@@ -98,6 +103,8 @@ float lanhs(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhs", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_clanhs(
         &norm_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -155,6 +162,8 @@ double lanhs(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lanhs", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlanhs(
         &norm_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ float lanht(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "lanht", 'c', n, n, 0, 0 );
     return LAPACK_clanht(
         &norm_, &n_,
         D,
@@ -80,6 +82,7 @@ double lanht(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "lanht", 'z', n, n, 0, 0 );
     return LAPACK_zlanht(
         &norm_, &n_,
         D,
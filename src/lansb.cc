@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,8 @@ float lansb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lansb", 's', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_slansb(
         &norm_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -73,6 +76,8 @@ double lansb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lansb", 'd', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlansb(
         &norm_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -107,6 +112,8 @@ float lansb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lansb", 'c', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_clansb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -182,6 +189,8 @@ double lansb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lansb", 'z', n, n, kd, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlansb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
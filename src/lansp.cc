@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ float lansp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lansp", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_slansp(
         &norm_, &uplo_, &n_,
         AP,
@@ -65,6 +68,8 @@ double lansp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lansp", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlansp(
         &norm_, &uplo_, &n_,
         AP,
@@ -95,6 +100,8 @@ float lansp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lansp", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_clansp(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -159,6 +166,8 @@ double lansp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lansp", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlansp(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) AP,
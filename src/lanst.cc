@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ float lanst(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "lanst", 's', n, n, 0, 0 );
     return LAPACK_slanst( &norm_, &n_, D, E
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
@@ -77,6 +79,7 @@ double lanst(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "lanst", 'd', n, n, 0, 0 );
     return LAPACK_dlanst( &norm_, &n_, D, E
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
@@ -4,8 +4,9 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
+#include "norm_common.hh"
 
 #include <vector>
 
@@ -21,30 +22,12 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_slansy(
-        &norm_, &uplo_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lansy", 's', n, n, 0,
+                        Gflop< float >::lansy( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, false );
 }
 
 // -----------------------------------------------------------------------------
@@ -53,30 +36,12 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
-
-    return LAPACK_dlansy(
-        &norm_, &uplo_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lansy", 'd', n, n, 0,
+                        Gflop< double >::lansy( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, false );
 }
 
 // -----------------------------------------------------------------------------
@@ -85,30 +50,12 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_clansy(
-        &norm_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lansy", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::lansy( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, false );
 }
 
 // -----------------------------------------------------------------------------
@@ -121,6 +68,11 @@ float lansy(
 /// For real matrices, `lapack::lanhe` is an alias for this.
 /// For complex Hermitian matrices, see `lapack::lanhe`.
 ///
+/// This is a native implementation, vectorized and multithreaded with
+/// OpenMP. The Frobenius norm uses the scaled sum of squares of
+/// lapack::lassq, so it doesn't overflow or underflow unless the norm does.
+/// Results don't depend on the number of threads.
+///
 /// @param[in] norm
 ///     The value to be returned:
 ///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
@@ -159,30 +111,12 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf || norm == Norm::One ? n : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < n );
 
-    return LAPACK_zlansy(
-        &norm_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
+    lapack_trace_block( "lansy", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::lansy( norm, n ) );
+    return internal::norm_symmetric( norm, uplo, n, A, lda, false );
 }
 
 }  // namespace lapack
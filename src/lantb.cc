@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +41,8 @@ float lantb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lantb", 's', n, n, k, 0 );
+    lapack_trace_work( work );
     return LAPACK_slantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         AB, &ldab_,
@@ -75,6 +78,8 @@ double lantb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lantb", 'd', n, n, k, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         AB, &ldab_,
@@ -110,6 +115,8 @@ float lantb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lantb", 'c', n, n, k, 0 );
+    lapack_trace_work( work );
     return LAPACK_clantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         (lapack_complex_float*) AB, &ldab_,
@@ -192,6 +199,8 @@ double lantb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lantb", 'z', n, n, k, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         (lapack_complex_double*) AB, &ldab_,
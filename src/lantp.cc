@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +37,8 @@ float lantp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lantp", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_slantp(
         &norm_, &uplo_, &diag_, &n_,
         AP,
@@ -67,6 +70,8 @@ double lantp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lantp", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_dlantp(
         &norm_, &uplo_, &diag_, &n_,
         AP,
@@ -98,6 +103,8 @@ float lantp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    lapack_trace_block( "lantp", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_clantp(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP,
@@ -168,6 +175,8 @@ double lantp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    lapack_trace_block( "lantp", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     return LAPACK_zlantp(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP,
@@ -4,8 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "lapack/trace.hh"
+#include "norm_common.hh"
 
 #include <vector>
 
@@ -29,33 +29,8 @@ float lantr(
     else
         m = min( m, n );
 
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    char diag_ = diag2char( diag );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_slantr(
-        &norm_, &uplo_, &diag_, &m_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
+    lapack_trace_block( "lantr", 's', m, n, 0, 0 );
+    return internal::norm_trapezoid( norm, uplo, diag, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -72,33 +47,8 @@ double lantr(
     else
         m = min( m, n );
 
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    char diag_ = diag2char( diag );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
-
-    return LAPACK_dlantr(
-        &norm_, &uplo_, &diag_, &m_, &n_,
-        A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
+    lapack_trace_block( "lantr", 'd', m, n, 0, 0 );
+    return internal::norm_trapezoid( norm, uplo, diag, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -115,33 +65,8 @@ float lantr(
     else
         m = min( m, n );
 
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    char diag_ = diag2char( diag );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< float > work( max( 1, lwork ) );
-
-    return LAPACK_clantr(
-        &norm_, &uplo_, &diag_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
+    lapack_trace_block( "lantr", 'c', m, n, 0, 0 );
+    return internal::norm_trapezoid( norm, uplo, diag, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -152,6 +77,11 @@ float lantr(
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
+/// This is a native implementation, vectorized and multithreaded with
+/// OpenMP. The Frobenius norm uses the scaled sum of squares of
+/// lapack::lassq, so it doesn't overflow or underflow unless the norm does.
+/// Results don't depend on the number of threads.
+///
 /// @param[in] norm
 ///     The value to be returned:
 ///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
@@ -215,33 +145,8 @@ double lantr(
     else
         m = min( m, n );
 
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char norm_ = norm2char( norm );
-    char uplo_ = uplo2char( uplo );
-    char diag_ = diag2char( diag );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    // from docs
-    int64_t lwork = (norm == Norm::Inf ? m : 1);
-
-    // allocate workspace
-    lapack::vector< double > work( max( 1, lwork ) );
-
-    return LAPACK_zlantr(
-        &norm_, &uplo_, &diag_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        &work[0]
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
+    lapack_trace_block( "lantr", 'z', m, n, 0, 0 );
+    return internal::norm_trapezoid( norm, uplo, diag, m, n, A, lda );
 }
 
 }  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
@@ -41,6 +42,7 @@ void lapmr(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmr", 's', m, n, 0, 0 );
     LAPACK_slapmr(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -74,6 +76,7 @@ void lapmr(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmr", 'd', m, n, 0, 0 );
     LAPACK_dlapmr(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -107,6 +110,7 @@ void lapmr(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmr", 'c', m, n, 0, 0 );
     LAPACK_clapmr(
         &forwrd_, &m_, &n_,
         (lapack_complex_float*) X, &ldx_,
@@ -140,6 +144,7 @@ void lapmr(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmr", 'z', m, n, 0, 0 );
     LAPACK_zlapmr(
         &forwrd_, &m_, &n_,
         (lapack_complex_double*) X, &ldx_,
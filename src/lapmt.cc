@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,7 @@ void lapmt(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmt", 's', m, n, 0, 0 );
     LAPACK_slapmt(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -72,6 +74,7 @@ void lapmt(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmt", 'd', m, n, 0, 0 );
     LAPACK_dlapmt(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -105,6 +108,7 @@ void lapmt(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmt", 'c', m, n, 0, 0 );
     LAPACK_clapmt(
         &forwrd_, &m_, &n_,
         (lapack_complex_float*) X, &ldx_,
@@ -138,6 +142,7 @@ void lapmt(
         lapack_int* K_ptr = K;
     #endif
 
+    lapack_trace_block( "lapmt", 'z', m, n, 0, 0 );
     LAPACK_zlapmt(
         &forwrd_, &m_, &n_,
         (lapack_complex_double*) X, &ldx_,
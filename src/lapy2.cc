@@ -4,9 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-
-#include <vector>
+#include "lapack/safe_scaling.hh"
+#include "lapack/trace.hh"
 
 namespace lapack {
 
@@ -19,12 +18,14 @@ using blas::real;
 float lapy2(
     float x, float y )
 {
-    return LAPACK_slapy2( &x, &y );
+    lapack_trace_block( "lapy2", 's', 0, 0, 0, 0 );
+    return safe::lapy2( x, y );
 }
 
 // -----------------------------------------------------------------------------
 /// Returns $\sqrt{ x^2 + y^2 },$ taking care not to cause unnecessary
 /// overflow.
+/// This is a native implementation, using safe::lapy2.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
@@ -38,7 +39,8 @@ float lapy2(
 double lapy2(
     double x, double y )
 {
-    return LAPACK_dlapy2( &x, &y );
+    lapack_trace_block( "lapy2", 'd', 0, 0, 0, 0 );
+    return safe::lapy2( x, y );
 }
 
 }  // namespace lapack
@@ -4,9 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-
-#include <vector>
+#include "lapack/safe_scaling.hh"
+#include "lapack/trace.hh"
 
 namespace lapack {
 
@@ -19,7 +18,8 @@ using blas::real;
 float lapy3(
     float x, float y, float z )
 {
-    return LAPACK_slapy3( &x, &y, &z );
+    lapack_trace_block( "lapy3", 's', 0, 0, 0, 0 );
+    return safe::lapy3( x, y, z );
 }
 
 // -----------------------------------------------------------------------------
@@ -40,7 +40,8 @@ float lapy3(
 double lapy3(
     double x, double y, double z )
 {
-    return LAPACK_dlapy3( &x, &y, &z );
+    lapack_trace_block( "lapy3", 'd', 0, 0, 0, 0 );
+    return safe::lapy3( x, y, z );
 }
 
 }  // namespace lapack
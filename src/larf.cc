@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +42,8 @@ void larf(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "larf", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_slarf(
         &side_, &m_, &n_,
         v, &incv_, &tau,
@@ -78,6 +81,8 @@ void larf(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "larf", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dlarf(
         &side_, &m_, &n_,
         v, &incv_, &tau,
@@ -115,6 +120,8 @@ void larf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork );
 
+    lapack_trace_block( "larf", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_clarf(
         &side_, &m_, &n_,
         (lapack_complex_float*) v, &incv_, (lapack_complex_float*) &tau,
@@ -197,6 +204,8 @@ void larf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork );
 
+    lapack_trace_block( "larf", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zlarf(
         &side_, &m_, &n_,
         (lapack_complex_double*) v, &incv_, (lapack_complex_double*) &tau,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +52,8 @@ void larfb(
     // allocate workspace
     lapack::vector< float > work( ldwork_ * k );
 
+    lapack_trace_block( "larfb", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_slarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         V, &ldv_,
@@ -98,6 +101,8 @@ void larfb(
     // allocate workspace
     lapack::vector< double > work( ldwork_ * k );
 
+    lapack_trace_block( "larfb", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dlarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         V, &ldv_,
@@ -146,6 +151,8 @@ void larfb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( ldwork_ * k );
 
+    lapack_trace_block( "larfb", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_clarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         (lapack_complex_float*) V, &ldv_,
@@ -290,6 +297,8 @@ void larfb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( ldwork_ * k );
 
+    lapack_trace_block( "larfb", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zlarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         (lapack_complex_double*) V, &ldv_,
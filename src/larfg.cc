@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfg", 's', n, n, 0, Gflop< float >::larfg( n ) );
     LAPACK_slarfg(
         &n_, alpha,
         X, &incx_, tau );
@@ -51,6 +54,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfg", 'd', n, n, 0, Gflop< double >::larfg( n ) );
     LAPACK_dlarfg(
         &n_, alpha,
         X, &incx_, tau );
@@ -72,6 +76,8 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfg", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::larfg( n ) );
     LAPACK_clarfg(
         &n_, (lapack_complex_float*) alpha,
         (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
@@ -149,6 +155,8 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfg", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::larfg( n ) );
     LAPACK_zlarfg(
         &n_, (lapack_complex_double*) alpha,
         (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30202  // >= 3.2.2
 
@@ -32,6 +33,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfgp", 's', n, n, 0, 0 );
     LAPACK_slarfgp(
         &n_, alpha,
         X, &incx_, tau );
@@ -53,6 +55,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfgp", 'd', n, n, 0, 0 );
     LAPACK_dlarfgp(
         &n_, alpha,
         X, &incx_, tau );
@@ -74,6 +77,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfgp", 'c', n, n, 0, 0 );
     LAPACK_clarfgp(
         &n_, (lapack_complex_float*) alpha,
         (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
@@ -151,6 +155,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    lapack_trace_block( "larfgp", 'z', n, n, 0, 0 );
     LAPACK_zlarfgp(
         &n_, (lapack_complex_double*) alpha,
         (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -37,6 +38,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    lapack_trace_block( "larft", 's', n, n, k, 0 );
     LAPACK_slarft(
         &direction_, &storev_, &n_, &k_,
         V, &ldv_,
@@ -71,6 +73,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    lapack_trace_block( "larft", 'd', n, n, k, 0 );
     LAPACK_dlarft(
         &direction_, &storev_, &n_, &k_,
         V, &ldv_,
@@ -105,6 +108,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    lapack_trace_block( "larft", 'c', n, n, k, 0 );
     LAPACK_clarft(
         &direction_, &storev_, &n_, &k_,
         (lapack_complex_float*) V, &ldv_,
@@ -231,6 +235,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    lapack_trace_block( "larft", 'z', n, n, k, 0 );
     LAPACK_zlarft(
         &direction_, &storev_, &n_, &k_,
         (lapack_complex_double*) V, &ldv_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,8 @@ void larfx(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "larfx", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_slarfx(
         &side_, &m_, &n_,
         v, &tau,
@@ -74,6 +77,8 @@ void larfx(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "larfx", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dlarfx(
         &side_, &m_, &n_,
         v, &tau,
@@ -109,6 +114,8 @@ void larfx(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork );
 
+    lapack_trace_block( "larfx", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_clarfx(
         &side_, &m_, &n_,
         (lapack_complex_float*) v, (lapack_complex_float*) &tau,
@@ -185,6 +192,8 @@ void larfx(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork );
 
+    lapack_trace_block( "larfx", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zlarfx(
         &side_, &m_, &n_,
         (lapack_complex_double*) v, (lapack_complex_double*) &tau,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
@@ -38,6 +39,8 @@ void larfy(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "larfy", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_slarfy(
         &uplo_, &n_,
         V, &incv_, &tau,
@@ -70,6 +73,8 @@ void larfy(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "larfy", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dlarfy(
         &uplo_, &n_,
         V, &incv_, &tau,
@@ -102,6 +107,8 @@ void larfy(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "larfy", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_clarfy(
         &uplo_, &n_,
         (lapack_complex_float*) V, &incv_, (lapack_complex_float*) &tau,
@@ -177,6 +184,8 @@ void larfy(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "larfy", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zlarfy(
         &uplo_, &n_,
         (lapack_complex_double*) V, &incv_, (lapack_complex_double*) &tau,
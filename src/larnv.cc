@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -36,6 +37,7 @@ void larnv(
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "larnv", 's', n, n, 0, 0 );
     LAPACK_slarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -67,6 +69,7 @@ void larnv(
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "larnv", 'd', n, n, 0, 0 );
     LAPACK_dlarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -98,6 +101,7 @@ void larnv(
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "larnv", 'c', n, n, 0, 0 );
     LAPACK_clarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -165,6 +169,7 @@ void larnv(
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    lapack_trace_block( "larnv", 'z', n, n, 0, 0 );
     LAPACK_zlarnv(
         &idist_,
         iseed_ptr, &n_,
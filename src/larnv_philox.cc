@@ -0,0 +1,432 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/trace.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+// Philox4x32 multipliers and Weyl key increments, from Salmon et al.,
+// "Parallel random numbers: as easy as 1, 2, 3", SC 2011.
+const uint32_t philox_m0 = 0xD2511F53;
+const uint32_t philox_m1 = 0xCD9E8D57;
+const uint32_t philox_w0 = 0x9E3779B9;
+const uint32_t philox_w1 = 0xBB67AE85;
+
+// Blocks of 4 random words per chunk; a chunk's words and values fit in
+// L1 cache.
+const int64_t philox_chunk = 256;
+
+// Real values per piece done by one thread. Pieces depend only on the
+// size, so results don't depend on the number of threads.
+const int64_t philox_piece = 64*1024;
+
+//------------------------------------------------------------------------------
+// Computes Philox4x32-10 of counters first, ..., first + nb - 1, with the
+// 64-bit key. Counter i is the 128-bit ( low word, high word, 0, 0 ).
+// Words of block i are stored in x[ 0 ][ i ], ..., x[ 3 ][ i ], so the
+// loop over i vectorizes, using 32 x 32 => 64-bit products.
+void philox_blocks(
+    uint64_t first, int64_t nb, uint64_t key,
+    uint32_t x[ 4 ][ philox_chunk ] )
+{
+    for (int64_t i = 0; i < nb; ++i) {
+        uint64_t ctr = first + i;
+        uint32_t c0 = uint32_t( ctr );
+        uint32_t c1 = uint32_t( ctr >> 32 );
+        uint32_t c2 = 0;
+        uint32_t c3 = 0;
+        uint32_t k0 = uint32_t( key );
+        uint32_t k1 = uint32_t( key >> 32 );
+        for (int round = 0; round < 10; ++round) {
+            uint64_t p0 = uint64_t( philox_m0 ) * c0;
+            uint64_t p1 = uint64_t( philox_m1 ) * c2;
+            c0 = uint32_t( p1 >> 32 ) ^ c1 ^ k0;
+            c2 = uint32_t( p0 >> 32 ) ^ c3 ^ k1;
+            c1 = uint32_t( p1 );
+            c3 = uint32_t( p0 );
+            k0 += philox_w0;
+            k1 += philox_w1;
+        }
+        x[ 0 ][ i ] = c0;
+        x[ 1 ][ i ] = c1;
+        x[ 2 ][ i ] = c2;
+        x[ 3 ][ i ] = c3;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Converts random words to uniform (0, 1) values, (2 k + 1) / 2^(p + 1)
+// for a random p-bit integer k, where p + 1 is the precision. Hence 0 and 1
+// are excluded, as in larnv, and conversions are exact. The integer
+// bits go into the mantissa of a value in [1, 2), which vectorizes better
+// than integer to floating point conversion.
+// Floats use one word each, so there are 4 floats per block.
+void philox_uniform( int64_t nb, uint32_t x[ 4 ][ philox_chunk ], float* u )
+{
+    const float half_ulp = 1.0f / float( 1 << 24 );
+    for (int64_t i = 0; i < nb; ++i) {
+        for (int l = 0; l < 4; ++l) {
+            uint32_t bits = 0x3F800000u | (x[ l ][ i ] >> 9);
+            float one_x;
+            std::memcpy( &one_x, &bits, sizeof( float ) );
+            u[ 4*i + l ] = (one_x - 1) + half_ulp;
+        }
+    }
+}
+
+// Doubles use two words each, so there are 2 doubles per block.
+void philox_uniform( int64_t nb, uint32_t x[ 4 ][ philox_chunk ], double* u )
+{
+    const double half_ulp = 1.0 / double( uint64_t( 1 ) << 53 );
+    for (int64_t i = 0; i < nb; ++i) {
+        for (int l = 0; l < 2; ++l) {
+            uint64_t k = (uint64_t( x[ 2*l ][ i ] ) << 32) | x[ 2*l + 1 ][ i ];
+            uint64_t bits = 0x3FF0000000000000ull | (k >> 12);
+            double one_x;
+            std::memcpy( &one_x, &bits, sizeof( double ) );
+            u[ 2*i + l ] = (one_x - 1) + half_ulp;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Transforms len uniform (0, 1) values u, in place, to distribution idist,
+// as in larnv. Normal (3), disc (4), and circle (5) values use pairs
+// ( u[ 2i ], u[ 2i+1 ] ), so len is even and u starts a pair.
+template <typename real_t>
+void philox_transform( int64_t idist, int64_t len, real_t* u )
+{
+    const real_t twopi = real_t( 6.2831853071795864769252867665590 );
+    switch (idist) {
+        case 1:
+            // uniform (0, 1)
+            break;
+
+        case 2:
+            // uniform (-1, 1)
+            for (int64_t i = 0; i < len; ++i)
+                u[ i ] = 2*u[ i ] - 1;
+            break;
+
+        case 3:
+            // normal (0, 1), by the Box-Muller method
+            for (int64_t i = 0; i < len; i += 2) {
+                real_t r = std::sqrt( -2 * std::log( u[ i ] ) );
+                real_t t = twopi * u[ i+1 ];
+                u[ i   ] = r * std::cos( t );
+                u[ i+1 ] = r * std::sin( t );
+            }
+            break;
+
+        case 4:
+            // complex uniform on the disc abs(z) < 1
+            for (int64_t i = 0; i < len; i += 2) {
+                real_t r = std::sqrt( u[ i ] );
+                real_t t = twopi * u[ i+1 ];
+                u[ i   ] = r * std::cos( t );
+                u[ i+1 ] = r * std::sin( t );
+            }
+            break;
+
+        case 5:
+            // complex uniform on the circle abs(z) = 1
+            for (int64_t i = 0; i < len; i += 2) {
+                real_t t = twopi * u[ i+1 ];
+                u[ i   ] = std::cos( t );
+                u[ i+1 ] = std::sin( t );
+            }
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Sets x to values first, ..., first + len - 1 of the real stream for
+// idist and seed, a chunk of Philox blocks at a time.
+template <typename real_t>
+void philox_fill(
+    int64_t idist, uint64_t seed, uint64_t first, int64_t len, real_t* x )
+{
+    // values per block
+    const int64_t per = 4 / (sizeof( real_t ) / sizeof( uint32_t ));
+
+    uint32_t w[ 4 ][ philox_chunk ];
+    real_t u[ 4*philox_chunk ];
+    uint64_t end = first + len;
+    uint64_t k = first;
+    while (k < end) {
+        uint64_t block = k / per;
+        uint64_t k0 = block * per;
+        int64_t nb = min( philox_chunk, int64_t( (end - k0 + per - 1) / per ) );
+        philox_blocks( block, nb, seed, w );
+        philox_uniform( nb, w, u );
+        philox_transform( idist, nb*per, u );
+
+        int64_t i0 = int64_t( k - k0 );
+        int64_t i1 = min( nb*per, int64_t( end - k0 ) );
+        std::copy( u + i0, u + i1, &x[ k - first ] );
+        k = k0 + i1;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Vector version; complex values are pairs of real values in the stream.
+template <typename scalar_t>
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    scalar_t* X )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const int64_t r = blas::is_complex< scalar_t >::value ? 2 : 1;
+    real_t* x = reinterpret_cast< real_t* >( X );
+    uint64_t first = r * offset;
+    int64_t len = r * n;
+    int64_t npieces = (len + philox_piece - 1) / philox_piece;
+
+    #if defined(_OPENMP)
+    #pragma omp parallel for schedule( static ) if (npieces > 1)
+    #endif
+    for (int64_t p = 0; p < npieces; ++p) {
+        int64_t k = p * philox_piece;
+        philox_fill( idist, seed, first + k, min( philox_piece, len - k ),
+                     &x[ k ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Matrix version. A(i, j) is value offset + i + j*m of the stream.
+template <typename scalar_t>
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (lda == m) {
+        larnv_philox( idist, seed, offset, m*n, A );
+        return;
+    }
+
+    // whole columns per piece
+    const int64_t r = blas::is_complex< scalar_t >::value ? 2 : 1;
+    int64_t nb = max( 1, philox_piece / max( 1, r*m ) );
+    int64_t npieces = (n + nb - 1) / nb;
+
+    #if defined(_OPENMP)
+    #pragma omp parallel for schedule( static ) if (npieces > 1)
+    #endif
+    for (int64_t p = 0; p < npieces; ++p) {
+        int64_t jend = min( (p + 1)*nb, n );
+        for (int64_t j = p*nb; j < jend; ++j) {
+            philox_fill( idist, seed, r*(offset + j*m), r*m,
+                         reinterpret_cast< real_t* >( &A[ j*lda ] ) );
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    float* X )
+{
+    lapack_error_if( idist < 1 || idist > 3 );
+    lapack_error_if( n < 0 );
+
+    lapack_trace_block( "larnv_philox", 's', n, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, n, X );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    double* X )
+{
+    lapack_error_if( idist < 1 || idist > 3 );
+    lapack_error_if( n < 0 );
+
+    lapack_trace_block( "larnv_philox", 'd', n, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, n, X );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    std::complex<float>* X )
+{
+    lapack_error_if( idist < 1 || idist > 5 );
+    lapack_error_if( n < 0 );
+
+    lapack_trace_block( "larnv_philox", 'c', n, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, n, X );
+}
+
+// -----------------------------------------------------------------------------
+/// Returns a vector of n random numbers from a uniform or normal
+/// distribution, like lapack::larnv, using the counter-based Philox4x32-10
+/// generator [1] instead of larnv's sequential generator.
+///
+/// The stream for (idist, seed) is an infinite sequence of values, and
+/// $X_i$ is value offset + i of it. Each value depends only on seed and its
+/// index, so a stream can be filled in any order, in parallel; results
+/// don't depend on the number of threads. For example, filling x[ 0 : n-1 ]
+/// with offset 0, or x[ 0 : k-1 ] with offset 0 and x[ k : n-1 ] with
+/// offset k, gives the same x. Unlike larnv, there is no seed to update;
+/// the next call can continue the stream with offset + n.
+///
+/// Large vectors are filled in parallel with OpenMP, and the
+/// generator is vectorized.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] idist
+///     The distribution of the random numbers, as in lapack::larnv:
+///     - 1: real and imaginary parts each uniform (0,1)
+///     - 2: real and imaginary parts each uniform (-1,1)
+///     - 3: real and imaginary parts each normal (0,1)
+///     - 4: uniformly distributed on the disc abs(z) < 1 (complex only)
+///     - 5: uniformly distributed on the circle abs(z) = 1 (complex only)
+///
+/// @param[in] seed
+///     The key of the generator. Different seeds give independent streams.
+///
+/// @param[in] offset
+///     Index in the stream of $X_0$.
+///
+/// @param[in] n
+///     The number of random numbers to be generated.
+///
+/// @param[out] X
+///     The vector X of length n.
+///     The generated random numbers.
+///
+/// @par Further Details
+///
+/// Each Philox block yields 128 random bits: 4 floats or 2 doubles, with
+/// complex values taking two reals. Normal values use the Box-Muller
+/// method on pairs of uniform values.
+///
+/// [1] J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw,
+/// "Parallel random numbers: as easy as 1, 2, 3," SC 2011.
+///
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t n,
+    std::complex<double>* X )
+{
+    lapack_error_if( idist < 1 || idist > 5 );
+    lapack_error_if( n < 0 );
+
+    lapack_trace_block( "larnv_philox", 'z', n, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, n, X );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    float* A, int64_t lda )
+{
+    lapack_error_if( idist < 1 || idist > 3 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    lapack_trace_block( "larnv_philox", 's', m, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, m, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    double* A, int64_t lda )
+{
+    lapack_error_if( idist < 1 || idist > 3 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    lapack_trace_block( "larnv_philox", 'd', m, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, m, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda )
+{
+    lapack_error_if( idist < 1 || idist > 5 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    lapack_trace_block( "larnv_philox", 'c', m, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, m, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Fills the m-by-n matrix A with random numbers, like the vector version
+/// of lapack::larnv_philox, with A(i, j) = value offset + i + j*m of the
+/// stream. Hence A doesn't depend on lda or the number of threads, and
+/// the matrix version with lda = m matches the vector version of
+/// length m*n. Columns are filled in parallel with OpenMP.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] idist
+///     The distribution of the random numbers; see the vector version.
+///
+/// @param[in] seed
+///     The key of the generator.
+///
+/// @param[in] offset
+///     Index in the stream of A(0, 0).
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     The generated random numbers.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @ingroup initialize
+void larnv_philox(
+    int64_t idist, uint64_t seed, uint64_t offset, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda )
+{
+    lapack_error_if( idist < 1 || idist > 5 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    lapack_trace_block( "larnv_philox", 'z', m, n, 0, 0 );
+    internal::larnv_philox( idist, seed, offset, m, n, A, lda );
+}
+
+}  // namespace lapack
@@ -3,7 +3,9 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "lapack/fortran.h"
+#include "lapack.hh"
+#include "lapack/safe_scaling.hh"
+#include "lapack/trace.hh"
 
 namespace lapack {
 
@@ -14,9 +16,8 @@ void lartg(
     float* sn,
     float* r )
 {
-
-    LAPACK_slartg(
-        &f, &g, cs, sn, r );
+    lapack_trace_block( "lartg", 's', 0, 0, 0, 0 );
+    safe::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -26,9 +27,8 @@ void lartg(
     double* sn,
     double* r )
 {
-
-    LAPACK_dlartg(
-        &f, &g, cs, sn, r );
+    lapack_trace_block( "lartg", 'd', 0, 0, 0, 0 );
+    safe::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -38,13 +38,8 @@ void lartg(
     std::complex<float>* sn,
     std::complex<float>* r )
 {
-
-    LAPACK_clartg(
-        (lapack_complex_float*) &f,
-        (lapack_complex_float*) &g,
-        cs,
-        (lapack_complex_float*) sn,
-        (lapack_complex_float*) r );
+    lapack_trace_block( "lartg", 'c', 0, 0, 0, 0 );
+    safe::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -54,13 +49,8 @@ void lartg(
     std::complex<double>* sn,
     std::complex<double>* r )
 {
-
-    LAPACK_zlartg(
-        (lapack_complex_double*) &f,
-        (lapack_complex_double*) &g,
-        cs,
-        (lapack_complex_double*) sn,
-        (lapack_complex_double*) r );
+    lapack_trace_block( "lartg", 'z', 0, 0, 0, 0 );
+    safe::lartg( f, g, cs, sn, r );
 }
 
 }  // namespace lapack
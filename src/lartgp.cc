@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
 
@@ -24,6 +25,7 @@ void lartgp(
     float* r )
 {
 
+    lapack_trace_block( "lartgp", 's', 0, 0, 0, 0 );
     LAPACK_slartgp(
         &f, &g, cs, sn, r );
 }
@@ -36,6 +38,7 @@ void lartgp(
     double* r )
 {
 
+    lapack_trace_block( "lartgp", 'd', 0, 0, 0, 0 );
     LAPACK_dlartgp(
         &f, &g, cs, sn, r );
 }
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
 
@@ -23,6 +24,7 @@ void lartgs(
     float* sn )
 {
 
+    lapack_trace_block( "lartgs", 's', 0, 0, 0, 0 );
     LAPACK_slartgs(
         &x, &y, &sigma, cs, sn );
 }
@@ -34,6 +36,7 @@ void lartgs(
     double* sn )
 {
 
+    lapack_trace_block( "lartgs", 'd', 0, 0, 0, 0 );
     LAPACK_dlartgs(
         &x, &y, &sigma, cs, sn );
 }
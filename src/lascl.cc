@@ -4,8 +4,11 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/trace.hh"
+#include "memory_common.hh"
 
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace lapack {
@@ -14,39 +17,119 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Native lascl. Computes the same sequence of multipliers as the
+// reference lascl, but applies all of them to a chunk of each column
+// while it is in cache, instead of sweeping over A once per multiplier.
+// Each element gets the same products in the same order, so results are
+// identical. See memory_common.hh for how columns are split over threads.
+template <typename scalar_t>
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku,
+    blas::real_type<scalar_t> cfrom, blas::real_type<scalar_t> cto,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type<scalar_t>;
+    const real_t one = 1;
+
+    // Multipliers, as in the reference lascl. If cfrom is infinite,
+    // multiply by a correctly signed zero for finite cto, or NaN if cto
+    // is infinite. If cto is 0 or infinite, it is the multiplier.
+    const real_t smlnum = std::numeric_limits<real_t>::min();
+    const real_t bignum = one / smlnum;
+    std::vector<real_t> mul;
+    real_t cfromc = cfrom;
+    real_t ctoc = cto;
+    bool done = false;
+    while (! done) {
+        real_t cfrom1 = cfromc * smlnum;
+        real_t mul_k;
+        done = true;
+        if (cfrom1 == cfromc) {
+            mul_k = ctoc / cfromc;
+        }
+        else {
+            real_t cto1 = ctoc / bignum;
+            if (cto1 == ctoc) {
+                mul_k = ctoc;
+            }
+            else if (std::abs( cfrom1 ) > std::abs( ctoc ) && ctoc != 0) {
+                mul_k = smlnum;
+                done = false;
+                cfromc = cfrom1;
+            }
+            else if (std::abs( cto1 ) > std::abs( cfromc )) {
+                mul_k = bignum;
+                done = false;
+                ctoc = cto1;
+            }
+            else {
+                mul_k = ctoc / cfromc;
+                if (mul_k == one)
+                    break;
+            }
+        }
+        mul.push_back( mul_k );
+    }
+    if (mul.empty())
+        return 0;
+
+    // complex elements are scaled as pairs of reals
+    const int64_t p = sizeof(scalar_t) / sizeof(real_t);
+    bool contiguous = type == MatrixType::General && lda == m;
+    int64_t nmul = mul.size();
+    real_t const* mul_ = mul.data();
+
+    memory_for(
+        type, kl, ku, m, n, contiguous, sizeof(scalar_t),
+        [=]( int64_t j, int64_t first, int64_t last ) {
+            real_t* x = (real_t*) &A[ first + j*lda ];
+            int64_t len = p * (last - first);
+            for (int64_t i = 0; i < len; i += memory_chunk) {
+                int64_t ib = min( memory_chunk, len - i );
+                for (int64_t k = 0; k < nmul; ++k) {
+                    real_t mul_k = mul_[ k ];
+                    for (int64_t ii = i; ii < i + ib; ++ii)
+                        x[ ii ] *= mul_k;
+                }
+            }
+        } );
+    return 0;
+}
+
+}  // namespace internal
+
 // -----------------------------------------------------------------------------
 /// @ingroup auxiliary
 int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     float* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    lapack_error_if( std::isnan( cfrom ) || cfrom == 0 );
+    lapack_error_if( std::isnan( cto ) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( (matrixtype == MatrixType::LowerBand
+                      || matrixtype == MatrixType::UpperBand) && n != m );
+    if (matrixtype == MatrixType::LowerBand
+        || matrixtype == MatrixType::UpperBand
+        || matrixtype == MatrixType::Band) {
+        lapack_error_if( kl < 0 || kl > max( m - 1, 0 ) );
+        lapack_error_if( ku < 0 || ku > max( n - 1, 0 ) );
+        lapack_error_if( matrixtype != MatrixType::Band && kl != ku );
+        lapack_error_if( matrixtype == MatrixType::LowerBand && lda < kl + 1 );
+        lapack_error_if( matrixtype == MatrixType::UpperBand && lda < ku + 1 );
+        lapack_error_if( matrixtype == MatrixType::Band && lda < 2*kl + ku + 1 );
     }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int kl_ = (lapack_int) kl;
-    lapack_int ku_ = (lapack_int) ku;
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_slascl(
-        &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
-        A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    else {
+        lapack_error_if( lda < max( 1, m ) );
     }
-    return info_;
+
+    lapack_trace_block( "lascl", 's', m, n, 0, 0 );
+    return internal::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -55,33 +138,28 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     double* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    lapack_error_if( std::isnan( cfrom ) || cfrom == 0 );
+    lapack_error_if( std::isnan( cto ) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( (matrixtype == MatrixType::LowerBand
+                      || matrixtype == MatrixType::UpperBand) && n != m );
+    if (matrixtype == MatrixType::LowerBand
+        || matrixtype == MatrixType::UpperBand
+        || matrixtype == MatrixType::Band) {
+        lapack_error_if( kl < 0 || kl > max( m - 1, 0 ) );
+        lapack_error_if( ku < 0 || ku > max( n - 1, 0 ) );
+        lapack_error_if( matrixtype != MatrixType::Band && kl != ku );
+        lapack_error_if( matrixtype == MatrixType::LowerBand && lda < kl + 1 );
+        lapack_error_if( matrixtype == MatrixType::UpperBand && lda < ku + 1 );
+        lapack_error_if( matrixtype == MatrixType::Band && lda < 2*kl + ku + 1 );
     }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int kl_ = (lapack_int) kl;
-    lapack_int ku_ = (lapack_int) ku;
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_dlascl(
-        &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
-        A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    else {
+        lapack_error_if( lda < max( 1, m ) );
     }
-    return info_;
+
+    lapack_trace_block( "lascl", 'd', m, n, 0, 0 );
+    return internal::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -90,33 +168,28 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    lapack_error_if( std::isnan( cfrom ) || cfrom == 0 );
+    lapack_error_if( std::isnan( cto ) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( (matrixtype == MatrixType::LowerBand
+                      || matrixtype == MatrixType::UpperBand) && n != m );
+    if (matrixtype == MatrixType::LowerBand
+        || matrixtype == MatrixType::UpperBand
+        || matrixtype == MatrixType::Band) {
+        lapack_error_if( kl < 0 || kl > max( m - 1, 0 ) );
+        lapack_error_if( ku < 0 || ku > max( n - 1, 0 ) );
+        lapack_error_if( matrixtype != MatrixType::Band && kl != ku );
+        lapack_error_if( matrixtype == MatrixType::LowerBand && lda < kl + 1 );
+        lapack_error_if( matrixtype == MatrixType::UpperBand && lda < ku + 1 );
+        lapack_error_if( matrixtype == MatrixType::Band && lda < 2*kl + ku + 1 );
     }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int kl_ = (lapack_int) kl;
-    lapack_int ku_ = (lapack_int) ku;
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_clascl(
-        &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
-        (lapack_complex_float*) A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    else {
+        lapack_error_if( lda < max( 1, m ) );
     }
-    return info_;
+
+    lapack_trace_block( "lascl", 'c', m, n, 0, 0 );
+    return internal::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -193,38 +266,38 @@ int64_t lascl(
 ///
 /// @return = 0: successful exit
 ///
+/// This is a native implementation: when scaling takes several steps to
+/// avoid over/underflow, all steps are applied to each column while it is
+/// in cache, rather than one pass over A per step, and columns are split
+/// over OpenMP threads in tiles of about equal size.
+///
 /// @ingroup auxiliary
 int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    lapack_error_if( std::isnan( cfrom ) || cfrom == 0 );
+    lapack_error_if( std::isnan( cto ) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( (matrixtype == MatrixType::LowerBand
+                      || matrixtype == MatrixType::UpperBand) && n != m );
+    if (matrixtype == MatrixType::LowerBand
+        || matrixtype == MatrixType::UpperBand
+        || matrixtype == MatrixType::Band) {
+        lapack_error_if( kl < 0 || kl > max( m - 1, 0 ) );
+        lapack_error_if( ku < 0 || ku > max( n - 1, 0 ) );
+        lapack_error_if( matrixtype != MatrixType::Band && kl != ku );
+        lapack_error_if( matrixtype == MatrixType::LowerBand && lda < kl + 1 );
+        lapack_error_if( matrixtype == MatrixType::UpperBand && lda < ku + 1 );
+        lapack_error_if( matrixtype == MatrixType::Band && lda < 2*kl + ku + 1 );
     }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int kl_ = (lapack_int) kl;
-    lapack_int ku_ = (lapack_int) ku;
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_zlascl(
-        &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
-        (lapack_complex_double*) A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    else {
+        lapack_error_if( lda < max( 1, m ) );
     }
-    return info_;
+
+    lapack_trace_block( "lascl", 'z', m, n, 0, 0 );
+    return internal::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda );
 }
 
 }  // namespace lapack
@@ -4,7 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/trace.hh"
+#include "memory_common.hh"
 
 #include <vector>
 
@@ -14,30 +15,60 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Native laset. Upper and Lower set the trapezoid including the diagonal;
+// any other type sets all of A, as in the reference laset.
+// See memory_common.hh for how columns are split over threads.
+template <typename scalar_t>
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t offdiag, scalar_t diag,
+    scalar_t* A, int64_t lda )
+{
+    if (matrixtype != MatrixType::Upper && matrixtype != MatrixType::Lower)
+        matrixtype = MatrixType::General;
+
+    int64_t mn = min( m, n );
+    bool stream = m * n * int64_t( sizeof(scalar_t) ) >= memory_stream_min;
+    bool contiguous = matrixtype == MatrixType::General && lda == m;
+
+    memory_for(
+        matrixtype, 0, 0, m, n, contiguous, sizeof(scalar_t),
+        [=]( int64_t j, int64_t first, int64_t last ) {
+            // Fill around the diagonal elements in rows [ first, last ):
+            // element j of column j, or, in one contiguous column, every
+            // (m+1)-th element, starting with diagonal k.
+            scalar_t* Aj = &A[ j*lda ];
+            int64_t i = first;
+            int64_t k = contiguous ? (first + m) / (m + 1) : j;
+            for (; k < mn; ++k) {
+                int64_t d = contiguous ? k*(m + 1) : j;
+                if (d >= last)
+                    break;
+                memory_fill( d - i, offdiag, &Aj[ i ], stream );
+                Aj[ d ] = diag;
+                i = d + 1;
+                if (! contiguous)
+                    break;
+            }
+            memory_fill( last - i, offdiag, &Aj[ i ], stream );
+        } );
+}
+
+}  // namespace internal
+
 // -----------------------------------------------------------------------------
 /// @ingroup initialize
 void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, float offdiag, float diag,
     float* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_slaset(
-        &matrixtype_, &m_, &n_, &offdiag, &diag,
-        A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "laset", 's', m, n, 0, 0 );
+    internal::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -46,24 +77,10 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, double offdiag, double diag,
     double* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_dlaset(
-        &matrixtype_, &m_, &n_, &offdiag, &diag,
-        A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "laset", 'd', m, n, 0, 0 );
+    internal::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -72,24 +89,10 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<float> offdiag, std::complex<float> diag,
     std::complex<float>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_claset(
-        &matrixtype_, &m_, &n_, (lapack_complex_float*) &offdiag, (lapack_complex_float*) &diag,
-        (lapack_complex_float*) A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "laset", 'c', m, n, 0, 0 );
+    internal::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -132,29 +135,20 @@ void laset(
 /// @param[in] lda
 ///     The leading dimension of the array A. lda >= max(1,m).
 ///
+/// This is a native implementation, parallel over columns with OpenMP.
+/// Large matrices are filled with non-temporal stores. For the same
+/// shape and matrixtype, each thread sets the columns that lapack::lacpy
+/// and lapack::lascl give it, so first-touch page placement suits them.
+///
 /// @ingroup initialize
 void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<double> offdiag, std::complex<double> diag,
     std::complex<double>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_zlaset(
-        &matrixtype_, &m_, &n_, (lapack_complex_double*) &offdiag, (lapack_complex_double*) &diag,
-        (lapack_complex_double*) A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack_error_if( lda < m );
+
+    lapack_trace_block( "laset", 'z', m, n, 0, 0 );
+    internal::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 }  // namespace lapack
@@ -4,9 +4,8 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
-
-#include <vector>
+#include "lapack/safe_scaling.hh"
+#include "lapack/trace.hh"
 
 namespace lapack {
 
@@ -22,17 +21,8 @@ void lassq(
     float* scale,
     float* sumsq )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_slassq(
-        &n_,
-        x, &incx_, scale, sumsq );
+    lapack_trace_block( "lassq", 's', n, n, 0, 0 );
+    safe::lassq( n, x, incx, scale, sumsq );
 }
 
 // -----------------------------------------------------------------------------
@@ -43,17 +33,8 @@ void lassq(
     double* scale,
     double* sumsq )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_dlassq(
-        &n_,
-        x, &incx_, scale, sumsq );
+    lapack_trace_block( "lassq", 'd', n, n, 0, 0 );
+    safe::lassq( n, x, incx, scale, sumsq );
 }
 
 // -----------------------------------------------------------------------------
@@ -64,17 +45,8 @@ void lassq(
     float* scale,
     float* sumsq )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_classq(
-        &n_,
-        (lapack_complex_float*) x, &incx_, scale, sumsq );
+    lapack_trace_block( "lassq", 'c', n, n, 0, 0 );
+    safe::lassq( n, x, incx, scale, sumsq );
 }
 
 // -----------------------------------------------------------------------------
@@ -98,6 +70,9 @@ void lassq(
 ///
 /// The routine makes only one pass through the vector x.
 ///
+/// This is a native implementation, using safe::lassq: the safe scaling
+/// algorithm of LAPACK 3.10, with vectorized loops for incx = 1.
+///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
@@ -126,17 +101,8 @@ void lassq(
     double* scale,
     double* sumsq )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_zlassq(
-        &n_,
-        (lapack_complex_double*) x, &incx_, scale, sumsq );
+    lapack_trace_block( "lassq", 'z', n, n, 0, 0 );
+    safe::lassq( n, x, incx, scale, sumsq );
 }
 
 }  // namespace lapack
@@ -4,9 +4,13 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "batch_common.hh"
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 namespace lapack {
@@ -15,38 +19,137 @@ using blas::max;
 using blas::min;
 using blas::real;
 
-// -----------------------------------------------------------------------------
-/// @ingroup gesv_computational
+namespace internal {
+
+// Tiles have as many columns as fit in about an L2 cache, counting only
+// the rows between the smallest and largest row interchanged.
+const int64_t laswp_tile_bytes = 256*1024;
+
+// Auto composes the pivots into a permutation when there are at least
+// this many interchanges.
+const int64_t laswp_permute_min = 64;
+
+// Tiles are applied in parallel only if the rows interchanged hold at
+// least this many elements, so small calls don't pay for a thread team.
+const int64_t laswp_parallel_min = 64*1024;
+
+//------------------------------------------------------------------------------
+// Native laswp. Splits A into tiles of columns, applies all interchanges
+// to one tile before moving to the next, and spreads tiles over OpenMP
+// threads. Unlike the reference laswp, which does each interchange across
+// 32 columns at a time, a tile stays in cache for the whole sequence.
+template <typename scalar_t>
 void laswp(
     int64_t n,
-    float* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx )
+    scalar_t* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx,
+    LaswpMethod method )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    if (n <= 0 || incx == 0 || k2 < k1)
+        return;
+
+    // Gather interchanges in the order they are applied, 0-based,
+    // skipping those that swap a row with itself. As in the reference
+    // laswp, a negative incx applies them in reverse order.
+    int64_t ix = (incx > 0 ? k1 - 1 : k1 - 1 + (k1 - k2)*incx);
+    int64_t i_first = (incx > 0 ? k1 : k2) - 1;
+    int64_t i_inc   = (incx > 0 ? 1 : -1);
+    std::vector< std::pair< int64_t, int64_t > > swaps;
+    swaps.reserve( k2 - k1 + 1 );
+    int64_t rlo = std::numeric_limits<int64_t>::max();
+    int64_t rhi = -1;
+    for (int64_t k = 0, i = i_first; k < k2 - k1 + 1; ++k, i += i_inc) {
+        int64_t p = ipiv[ ix ] - 1;
+        ix += incx;
+        if (p != i) {
+            swaps.push_back( { i, p } );
+            rlo = min( rlo, min( i, p ) );
+            rhi = max( rhi, max( i, p ) );
+        }
     }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int k1_ = (lapack_int) k1;
-    lapack_int k2_ = (lapack_int) k2;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
+    if (swaps.empty())
+        return;
+
+    int64_t nswaps = swaps.size();
+    int64_t span = rhi - rlo + 1;
+    if (method == LaswpMethod::Auto) {
+        method = nswaps >= laswp_permute_min
+               ? LaswpMethod::Permute
+               : LaswpMethod::Swap;
+    }
+
+    // Permute: compose interchanges into a permutation of rows rlo:rhi,
+    // then list the rows that move. Row dst[ k ] gets old row src[ k ].
+    std::vector< int64_t > src, dst;
+    if (method == LaswpMethod::Permute) {
+        std::vector< int64_t > perm( span );
+        std::iota( perm.begin(), perm.end(), rlo );
+        for (auto const& s : swaps)
+            std::swap( perm[ s.first - rlo ], perm[ s.second - rlo ] );
+        for (int64_t r = 0; r < span; ++r) {
+            if (perm[ r ] != rlo + r) {
+                dst.push_back( rlo + r );
+                src.push_back( perm[ r ] );
+            }
+        }
+    }
+    int64_t nmoved = dst.size();
+
+    // tile width; with threads, at least one tile per thread
+    bool parallel = span * n >= laswp_parallel_min;
+    int nthreads = parallel ? batch_num_threads() : 1;
+    int64_t nb = laswp_tile_bytes / (span * int64_t( sizeof(scalar_t) ));
+    nb = max( 1, min( nb, (n + nthreads - 1) / nthreads ) );
+    int64_t ntiles = (n + nb - 1) / nb;
+    parallel = parallel && ntiles > 1;
+
+    // one row buffer per thread, for Permute
+    lapack::vector< scalar_t > buffer( nthreads * nmoved );
+
+    #if defined(_OPENMP)
+    #pragma omp parallel for schedule( static ) if (parallel)
     #endif
-    lapack_int incx_ = (lapack_int) incx;
+    for (int64_t t = 0; t < ntiles; ++t) {
+        int64_t j0 = t*nb;
+        int64_t jb = min( nb, n - j0 );
+        scalar_t* At = &A[ j0*lda ];
 
-    LAPACK_slaswp(
-        &n_,
-        A, &lda_, &k1_, &k2_,
-        ipiv_ptr, &incx_ );
+        if (method == LaswpMethod::Swap) {
+            // each interchange across the tile; the independent swaps
+            // in different columns overlap their memory accesses
+            for (auto const& s : swaps) {
+                scalar_t* Ai = &At[ s.first  ];
+                scalar_t* Ap = &At[ s.second ];
+                for (int64_t j = 0; j < jb; ++j)
+                    std::swap( Ai[ j*lda ], Ap[ j*lda ] );
+            }
+        }
+        else {
+            // each moved row is read once and written once per column
+            scalar_t* tmp = &buffer[ batch_thread_num() * nmoved ];
+            for (int64_t j = 0; j < jb; ++j) {
+                scalar_t* Aj = &At[ j*lda ];
+                for (int64_t k = 0; k < nmoved; ++k)
+                    tmp[ k ] = Aj[ src[ k ] ];
+                for (int64_t k = 0; k < nmoved; ++k)
+                    Aj[ dst[ k ] ] = tmp[ k ];
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method )
+{
+    lapack_trace_block( "laswp", 's', n, n, 0, 0 );
+    internal::laswp( n, A, lda, k1, k2, ipiv, incx, method );
 }
 
 // -----------------------------------------------------------------------------
@@ -54,33 +157,70 @@ void laswp(
 void laswp(
     int64_t n,
     double* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method )
+{
+    lapack_trace_block( "laswp", 'd', n, n, 0, 0 );
+    internal::laswp( n, A, lda, k1, k2, ipiv, incx, method );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method )
+{
+    lapack_trace_block( "laswp", 'c', n, n, 0, 0 );
+    internal::laswp( n, A, lda, k1, k2, ipiv, incx, method );
+}
+
+// -----------------------------------------------------------------------------
+/// Performs a series of row interchanges on the matrix A, using the
+/// given method. Arguments are as in the lapack::laswp overload without
+/// method, which uses LaswpMethod::Auto.
+///
+/// For long pivot sequences, e.g., applying all pivots of getrf to a
+/// wide matrix, LaswpMethod::Permute moves each row only once per
+/// column, instead of once per interchange that touches it.
+/// The result is the same for every method.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] method
+///     How to apply the interchanges; see lapack::LaswpMethod.
+///
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx,
+    lapack::LaswpMethod method )
+{
+    lapack_trace_block( "laswp", 'z', n, n, 0, 0 );
+    internal::laswp( n, A, lda, k1, k2, ipiv, incx, method );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int k1_ = (lapack_int) k1;
-    lapack_int k2_ = (lapack_int) k2;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
-    lapack_int incx_ = (lapack_int) incx;
+    laswp( n, A, lda, k1, k2, ipiv, incx, LaswpMethod::Auto );
+}
 
-    LAPACK_dlaswp(
-        &n_,
-        A, &lda_, &k1_, &k2_,
-        ipiv_ptr, &incx_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    double* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx )
+{
+    laswp( n, A, lda, k1, k2, ipiv, incx, LaswpMethod::Auto );
 }
 
 // -----------------------------------------------------------------------------
@@ -90,31 +230,7 @@ void laswp(
     std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int k1_ = (lapack_int) k1;
-    lapack_int k2_ = (lapack_int) k2;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_claswp(
-        &n_,
-        (lapack_complex_float*) A, &lda_, &k1_, &k2_,
-        ipiv_ptr, &incx_ );
+    laswp( n, A, lda, k1, k2, ipiv, incx, LaswpMethod::Auto );
 }
 
 // -----------------------------------------------------------------------------
@@ -156,37 +272,18 @@ void laswp(
 ///     The increment between successive values of ipiv. If incx
 ///     is negative, the pivots are applied in reverse order.
 ///
+/// This is a native implementation: columns are split into cache-sized
+/// tiles, which are processed in parallel with OpenMP, and long pivot
+/// sequences are composed into a permutation first.
+/// See the overload with lapack::LaswpMethod to choose the method.
+///
 /// @ingroup gesv_computational
 void laswp(
     int64_t n,
     std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int k1_ = (lapack_int) k1;
-    lapack_int k2_ = (lapack_int) k2;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_zlaswp(
-        &n_,
-        (lapack_complex_double*) A, &lda_, &k1_, &k2_,
-        ipiv_ptr, &incx_ );
+    laswp( n, A, lda, k1, k2, ipiv, incx, LaswpMethod::Auto );
 }
 
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lauum", 's', n, n, 0, Gflop< float >::lauum( n ) );
     LAPACK_slauum(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -59,6 +62,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lauum", 'd', n, n, 0, Gflop< double >::lauum( n ) );
     LAPACK_dlauum(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -88,6 +92,8 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lauum", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::lauum( n ) );
     LAPACK_clauum(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -155,6 +161,8 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "lauum", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::lauum( n ) );
     LAPACK_zlauum(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -0,0 +1,335 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/memory.hh"
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+#   include <malloc.h>  // _aligned_malloc, _aligned_free
+#else
+#   include <stdlib.h>  // posix_memalign, free
+#   include <sys/mman.h>
+#   include <unistd.h>
+#   if defined( __linux__ )
+#       include <sys/syscall.h>
+#   endif
+#endif
+
+namespace lapack {
+
+// Global policy, read on every allocation without a lock.
+// set_alloc_policy publishes a new immutable version; versions are never
+// freed, so a reader can use the one it loaded even if the policy changes.
+static const AllocPolicy g_default_policy {};
+static std::atomic< AllocPolicy const* > g_policy( &g_default_policy );
+static std::mutex g_policy_mutex;  // serializes set_alloc_policy
+
+// Innermost AllocPolicyScope on this thread, or null.
+static thread_local AllocPolicy const* t_policy = nullptr;
+
+//------------------------------------------------------------------------------
+void set_alloc_policy( AllocPolicy const& policy )
+{
+    lapack_error_if( policy.alignment < 64 );
+    lapack_error_if( (policy.alignment & (policy.alignment - 1)) != 0 );
+
+    std::lock_guard< std::mutex > lock( g_policy_mutex );
+    static std::list< AllocPolicy > versions;
+    versions.push_back( policy );
+    g_policy.store( &versions.back(), std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
+AllocPolicy get_alloc_policy()
+{
+    if (t_policy != nullptr)
+        return *t_policy;
+
+    return *g_policy.load( std::memory_order_acquire );
+}
+
+//------------------------------------------------------------------------------
+AllocPolicyScope::AllocPolicyScope( AllocPolicy const& policy )
+    : prev_( t_policy ),
+      policy_( policy )
+{
+    lapack_error_if( policy.alignment < 64 );
+    lapack_error_if( (policy.alignment & (policy.alignment - 1)) != 0 );
+
+    t_policy = &policy_;
+}
+
+AllocPolicyScope::~AllocPolicyScope()
+{
+    t_policy = prev_;
+}
+
+//------------------------------------------------------------------------------
+// Default allocator, which follows the AllocPolicy.
+class DefaultAllocator: public Allocator
+{
+public:
+    void* allocate( size_t bytes, size_t alignment ) override
+    {
+        AllocPolicy policy = get_alloc_policy();
+        policy.alignment = alignment;
+        return internal::allocate( bytes, policy );
+    }
+
+    void deallocate( void* ptr, size_t bytes ) noexcept override
+    {
+        internal::deallocate( ptr, bytes );
+    }
+};
+
+static DefaultAllocator g_default_allocator;
+static std::atomic< Allocator* > g_allocator( nullptr );
+
+// Innermost AllocatorScope on this thread, or null.
+static thread_local Allocator* t_allocator = nullptr;
+
+//------------------------------------------------------------------------------
+void set_allocator( Allocator* allocator )
+{
+    g_allocator.store( allocator );
+}
+
+//------------------------------------------------------------------------------
+Allocator* get_allocator()
+{
+    if (t_allocator != nullptr)
+        return t_allocator;
+
+    Allocator* allocator = g_allocator.load();
+    return allocator != nullptr ? allocator : &g_default_allocator;
+}
+
+//------------------------------------------------------------------------------
+AllocatorScope::AllocatorScope( Allocator* allocator )
+    : prev_( t_allocator )
+{
+    t_allocator = allocator;
+}
+
+AllocatorScope::~AllocatorScope()
+{
+    t_allocator = prev_;
+}
+
+//------------------------------------------------------------------------------
+LimitAllocator::LimitAllocator( size_t limit )
+    : upstream_( get_allocator() ),
+      limit_( limit ),
+      used_( 0 ),
+      peak_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+void* LimitAllocator::allocate( size_t bytes, size_t alignment )
+{
+    // reserve bytes first, so concurrent allocations can't exceed limit
+    size_t used = used_.load();
+    do {
+        if (bytes > limit_ - used)
+            throw std::bad_alloc();
+    } while (! used_.compare_exchange_weak( used, used + bytes ));
+
+    void* ptr;
+    try {
+        ptr = upstream_->allocate( bytes, alignment );
+    }
+    catch (...) {
+        used_ -= bytes;
+        throw;
+    }
+
+    size_t peak = peak_.load();
+    while (used + bytes > peak
+           && ! peak_.compare_exchange_weak( peak, used + bytes )) {}
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+void LimitAllocator::deallocate( void* ptr, size_t bytes ) noexcept
+{
+    upstream_->deallocate( ptr, bytes );
+    used_ -= bytes;
+}
+
+namespace internal {
+
+#if ! defined( _WIN32 ) && ! defined( _WIN64 )
+
+// Size of transparent and explicit huge pages. 2 MiB is the default
+// huge page size on x86-64, and a multiple of it on other platforms.
+static const size_t huge_page_size = size_t( 2 ) << 20;
+
+// Arrays mapped by map_pages, keyed by address, with their length.
+// g_mapped_count lets deallocate skip the lookup when there are none.
+static std::mutex g_mapped_mutex;
+static std::unordered_map< void*, size_t > g_mapped;
+static std::atomic< size_t > g_mapped_count( 0 );
+
+//------------------------------------------------------------------------------
+// Sets NUMA policy of pages in [ptr, ptr + length) before they are touched.
+// Uses the mbind system call directly, to not depend on libnuma.
+// Failure is ignored, since the policy is only a performance hint.
+static void bind_pages( void* ptr, size_t length, Numa numa )
+{
+    #if defined( __linux__ ) && defined( SYS_mbind ) \
+        && defined( SYS_get_mempolicy )
+        // from <numaif.h>
+        const int mpol_preferred      = 1;
+        const int mpol_interleave     = 3;
+        const int mpol_f_mems_allowed = 1 << 2;
+
+        if (numa == Numa::Interleave) {
+            // interleave across all nodes this process may use
+            const unsigned long maxnode = 1024;
+            unsigned long mask[ maxnode / (8 * sizeof(unsigned long)) ] = { 0 };
+            int mode = 0;
+            if (syscall( SYS_get_mempolicy, &mode, mask, maxnode,
+                         nullptr, mpol_f_mems_allowed ) == 0) {
+                syscall( SYS_mbind, ptr, length, mpol_interleave,
+                         mask, maxnode, 0 );
+            }
+        }
+        else if (numa == Numa::Local) {
+            // preferred with an empty node mask means the local node
+            syscall( SYS_mbind, ptr, length, mpol_preferred,
+                     nullptr, 0, 0 );
+        }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Maps bytes of anonymous memory with the page size and NUMA policy
+// in policy, aligned to the larger of policy.alignment and the page size.
+// @return pointer, or null on failure.
+static void* map_pages( size_t bytes, AllocPolicy const& policy )
+{
+    size_t page = size_t( sysconf( _SC_PAGESIZE ) );
+    size_t align = std::max( policy.alignment, page );
+    if (policy.huge_pages != HugePages::None)
+        align = std::max( align, huge_page_size );
+    size_t length = (bytes + align - 1) / align * align;
+
+    void* ptr = MAP_FAILED;
+    #if defined( MAP_HUGETLB )
+        if (policy.huge_pages == HugePages::Explicit
+            && align == huge_page_size) {
+            // huge page mappings are aligned to the huge page size;
+            // fails if the pool of reserved huge pages is too small
+            ptr = mmap( nullptr, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+        }
+    #endif
+
+    if (ptr == MAP_FAILED) {
+        // Over-allocate by align, then unmap the unaligned head and tail.
+        size_t extra = align - page;
+        char* base = (char*) mmap( nullptr, length + extra,
+                                   PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if (base == MAP_FAILED)
+            return nullptr;
+
+        uintptr_t addr = reinterpret_cast< uintptr_t >( base );
+        char* start = base + ((align - addr % align) % align);
+        if (start > base)
+            munmap( base, start - base );
+        if (base + length + extra > start + length)
+            munmap( start + length, (base + length + extra) - (start + length) );
+        ptr = start;
+
+        #if defined( MADV_HUGEPAGE )
+            if (policy.huge_pages != HugePages::None)
+                madvise( ptr, length, MADV_HUGEPAGE );
+        #endif
+    }
+
+    if (policy.numa != Numa::Default)
+        bind_pages( ptr, length, policy.numa );
+
+    std::lock_guard< std::mutex > lock( g_mapped_mutex );
+    g_mapped[ ptr ] = length;
+    ++g_mapped_count;
+    return ptr;
+}
+
+#endif  // not _WIN32
+
+//------------------------------------------------------------------------------
+void* allocate( size_t bytes )
+{
+    return allocate( bytes, get_alloc_policy() );
+}
+
+//------------------------------------------------------------------------------
+void* allocate( Allocator* allocator, size_t bytes )
+{
+    AllocPolicy policy = get_alloc_policy();
+    if (allocator == &g_default_allocator)
+        return allocate( bytes, policy );
+    else
+        return allocator->allocate( bytes, policy.alignment );
+}
+
+//------------------------------------------------------------------------------
+void* allocate( size_t bytes, AllocPolicy const& policy )
+{
+    void* ptr = nullptr;
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        ptr = _aligned_malloc( bytes, policy.alignment );
+        if (ptr != nullptr)
+            return ptr;
+    #else
+        if ((policy.huge_pages != HugePages::None
+             || policy.numa != Numa::Default)
+            && bytes >= policy.huge_threshold)
+        {
+            ptr = map_pages( bytes, policy );
+            if (ptr != nullptr)
+                return ptr;
+            // else fall back to posix_memalign
+        }
+
+        int err = posix_memalign( &ptr, policy.alignment, bytes );
+        if (err == 0)
+            return ptr;
+    #endif
+
+    throw std::bad_alloc();
+}
+
+//------------------------------------------------------------------------------
+void deallocate( void* ptr, size_t bytes ) noexcept
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        _aligned_free( ptr );
+    #else
+        if (ptr != nullptr && g_mapped_count.load() > 0) {
+            std::lock_guard< std::mutex > lock( g_mapped_mutex );
+            auto iter = g_mapped.find( ptr );
+            if (iter != g_mapped.end()) {
+                munmap( ptr, iter->second );
+                g_mapped.erase( iter );
+                --g_mapped_count;
+                return;
+            }
+        }
+        free( ptr );
+    #endif
+}
+
+}  // namespace internal
+}  // namespace lapack
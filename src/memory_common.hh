@@ -0,0 +1,251 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MEMORY_COMMON_HH
+#define LAPACK_MEMORY_COMMON_HH
+
+#include "lapack/util.hh"
+#include "batch_common.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+// Native kernels for lacpy, lacp2, laset, and lascl.
+//
+// Each routine touches every element of its part of the matrix once, so
+// it is bound by memory bandwidth. The columns are split into one tile
+// per thread holding about the same number of elements, which balances
+// triangular and band shapes, and tiles are assigned to threads
+// statically. For the same shape, a thread gets the same columns in each
+// call, so pages stay near the thread that first touched them, e.g., in
+// laset, on NUMA systems. Copies and fills larger than the last level
+// cache use non-temporal stores, which bypass the cache and avoid reading
+// the destination before writing it.
+
+namespace lapack {
+namespace internal {
+
+// Tiles are done in parallel only if they hold at least this many bytes.
+const int64_t memory_parallel_min = 512*1024;
+
+// Copies and fills with a destination of at least this many bytes use
+// non-temporal stores.
+const int64_t memory_stream_min = 8*1024*1024;
+
+// Elements per chunk when converting before a non-temporal store.
+const int64_t memory_chunk = 256;
+
+//------------------------------------------------------------------------------
+// Rows [ first, last ) of column j in the part of an m-by-n matrix
+// selected by type, as in the reference lascl. kl and ku are referenced
+// only for band types; there, rows index the band storage.
+inline void memory_rows(
+    lapack::MatrixType type, int64_t kl, int64_t ku, int64_t m, int64_t n,
+    int64_t j, int64_t* first, int64_t* last )
+{
+    switch (type) {
+        case MatrixType::General:
+            *first = 0;
+            *last  = m;
+            break;
+        case MatrixType::Lower:
+            *first = j;
+            *last  = m;
+            break;
+        case MatrixType::Upper:
+            *first = 0;
+            *last  = blas::min( m, j + 1 );
+            break;
+        case MatrixType::Hessenberg:
+            *first = 0;
+            *last  = blas::min( m, j + 2 );
+            break;
+        case MatrixType::LowerBand:
+            *first = 0;
+            *last  = blas::min( kl + 1, n - j );
+            break;
+        case MatrixType::UpperBand:
+            *first = blas::max( ku - j, 0 );
+            *last  = ku + 1;
+            break;
+        case MatrixType::Band:
+            *first = blas::max( kl + ku - j, kl );
+            *last  = blas::min( 2*kl + ku + 1, kl + ku + m - j );
+            break;
+    }
+    *last = blas::max( *first, *last );
+}
+
+//------------------------------------------------------------------------------
+// Orders non-temporal stores by the calling thread before later stores,
+// so other threads see them after the next barrier.
+inline void memory_fence()
+{
+    #if defined(__SSE2__)
+        _mm_sfence();
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Number of leading elements of x to store normally, so the rest is
+// 16-byte aligned for non-temporal stores; or n if x can't be aligned.
+template <typename T>
+inline int64_t memory_peel( T const* x, int64_t n )
+{
+    uintptr_t misalign = (16 - uintptr_t( x ) % 16) % 16;
+    if (misalign % sizeof(T) != 0)
+        return n;
+    return blas::min( n, int64_t( misalign / sizeof(T) ) );
+}
+
+//------------------------------------------------------------------------------
+// Copies n contiguous elements of x to y; with stream, using
+// non-temporal stores where possible.
+template <typename T>
+void memory_copy( int64_t n, T const* x, T* y, bool stream )
+{
+    #if defined(__SSE2__)
+        if (stream && 16 % sizeof(T) == 0) {
+            int64_t i = memory_peel( y, n );
+            std::copy( x, x + i, y );
+            const int64_t step = 16 / sizeof(T);
+            for (; i + step <= n; i += step) {
+                __m128i v = _mm_loadu_si128( (__m128i const*) &x[ i ] );
+                _mm_stream_si128( (__m128i*) &y[ i ], v );
+            }
+            std::copy( x + i, x + n, y + i );
+            return;
+        }
+    #endif
+    std::copy( x, x + n, y );
+}
+
+//------------------------------------------------------------------------------
+// Sets n contiguous elements of x to value; with stream, using
+// non-temporal stores where possible.
+template <typename T>
+void memory_fill( int64_t n, T value, T* x, bool stream )
+{
+    #if defined(__SSE2__)
+        if (stream && 16 % sizeof(T) == 0) {
+            int64_t i = memory_peel( x, n );
+            std::fill( x, x + i, value );
+            // after peeling, each 16 bytes start on an element
+            const int64_t step = 16 / sizeof(T);
+            T pattern[ 16 / sizeof(T) ];
+            std::fill( pattern, pattern + step, value );
+            __m128i v = _mm_loadu_si128( (__m128i const*) pattern );
+            for (; i + step <= n; i += step) {
+                _mm_stream_si128( (__m128i*) &x[ i ], v );
+            }
+            std::fill( x + i, x + n, value );
+            return;
+        }
+    #endif
+    std::fill( x, x + n, value );
+}
+
+//------------------------------------------------------------------------------
+// Calls f( j, first, last ) for rows [ first, last ) of each column j in
+// the part of the m-by-n matrix selected by type; see memory_rows.
+// Columns are split into tiles of about equal numbers of elements, one
+// per thread, and each thread calls memory_fence after its tile.
+//
+// If contiguous, type must be General, and column j+1 must follow column
+// j in every array f accesses, i.e., lda = m. The matrix is then done as
+// one column of m*n rows, so threads split it regardless of n.
+template <typename func_t>
+void memory_for(
+    lapack::MatrixType type, int64_t kl, int64_t ku, int64_t m, int64_t n,
+    bool contiguous, int64_t elem_bytes, func_t&& f )
+{
+    if (m <= 0 || n <= 0)
+        return;
+
+    // with contiguous, the matrix is one column of m*n rows
+    int64_t total = 0;
+    if (contiguous) {
+        total = m*n;
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t first, last;
+            memory_rows( type, kl, ku, m, n, j, &first, &last );
+            total += last - first;
+        }
+    }
+    if (total == 0)
+        return;
+
+    // Does columns [ j1, j2 ); with contiguous, rows [ j1, j2 ).
+    auto tile = [&]( int64_t j1, int64_t j2 ) {
+        if (contiguous) {
+            if (j1 < j2)
+                f( 0, j1, j2 );
+        }
+        else {
+            for (int64_t j = j1; j < j2; ++j) {
+                int64_t first, last;
+                memory_rows( type, kl, ku, m, n, j, &first, &last );
+                if (first < last)
+                    f( j, first, last );
+            }
+        }
+        memory_fence();
+    };
+
+    bool parallel = total * elem_bytes >= memory_parallel_min;
+    int64_t ntiles = parallel ? batch_num_threads() : 1;
+    ntiles = blas::min( ntiles, contiguous ? total : n );
+    if (ntiles == 1) {
+        tile( 0, contiguous ? total : n );
+        return;
+    }
+
+    // count[ j ] is the number of elements before column j
+    lapack::vector< int64_t > count( contiguous ? 0 : n + 1 );
+    if (! contiguous) {
+        count[ 0 ] = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t first, last;
+            memory_rows( type, kl, ku, m, n, j, &first, &last );
+            count[ j+1 ] = count[ j ] + last - first;
+        }
+    }
+
+    // column boundaries of tiles with about total / ntiles elements each;
+    // with contiguous, boundaries are rows of the single column
+    lapack::vector< int64_t > bound( ntiles + 1 );
+    bound[ 0 ] = 0;
+    for (int64_t t = 1; t < ntiles; ++t) {
+        int64_t target = (total * t) / ntiles;
+        if (contiguous) {
+            bound[ t ] = target;
+        }
+        else {
+            // first column whose elements start at or after target
+            bound[ t ] = std::lower_bound( count.begin(), count.end(), target )
+                       - count.begin();
+        }
+    }
+    bound[ ntiles ] = contiguous ? total : n;
+
+    #if defined(_OPENMP)
+    #pragma omp parallel for schedule( static, 1 )
+    #endif
+    for (int64_t t = 0; t < ntiles; ++t) {
+        tile( bound[ t ], bound[ t+1 ] );
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_MEMORY_COMMON_HH
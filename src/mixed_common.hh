@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MIXED_COMMON_HH
+#define LAPACK_MIXED_COMMON_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Maximum number of refinement iterations, as in dsgesv and dsposv.
+const int64_t mixed_itermax = 30;
+
+//------------------------------------------------------------------------------
+/// Lower precision type used for the factorization:
+/// float for double, std::complex<float> for std::complex<double>.
+template <typename scalar_t>
+struct mixed_low_type;
+
+template <>
+struct mixed_low_type< double > { using type = float; };
+
+template <>
+struct mixed_low_type< std::complex<double> > { using type = std::complex<float>; };
+
+//------------------------------------------------------------------------------
+/// Converts to lower precision. Returns 1 on overflow, else 0.
+inline int64_t lag2_low(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    float* SA, int64_t ldsa )
+{
+    return lapack::lag2s( m, n, A, lda, SA, ldsa );
+}
+
+inline int64_t lag2_low(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<float>* SA, int64_t ldsa )
+{
+    return lapack::lag2c( m, n, A, lda, SA, ldsa );
+}
+
+//------------------------------------------------------------------------------
+/// Converts back to higher precision.
+inline void lag2_high(
+    int64_t m, int64_t n,
+    float const* SA, int64_t ldsa,
+    double* A, int64_t lda )
+{
+    lapack::lag2d( m, n, SA, ldsa, A, lda );
+}
+
+inline void lag2_high(
+    int64_t m, int64_t n,
+    std::complex<float> const* SA, int64_t ldsa,
+    std::complex<double>* A, int64_t lda )
+{
+    lapack::lag2z( m, n, SA, ldsa, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Converts the uplo triangle of A to lower precision, as LAPACK's
+/// dlat2s and zlat2c do; the other triangle of SA is not referenced.
+/// Returns 1 on overflow, else 0.
+template <typename scalar_t, typename low_t>
+int64_t lat2_low(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda,
+    low_t* SA, int64_t ldsa )
+{
+    using blas::real;
+    using blas::imag;
+    using low_real_t = blas::real_type< low_t >;
+
+    const double rmax = std::numeric_limits< low_real_t >::max();
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t ibegin = (uplo == Uplo::Upper ? 0 : j);
+        int64_t iend   = (uplo == Uplo::Upper ? j+1 : n);
+        for (int64_t i = ibegin; i < iend; ++i) {
+            scalar_t a = A[ i + j*lda ];
+            if (std::abs( real( a ) ) > rmax || std::abs( imag( a ) ) > rmax)
+                return 1;
+            SA[ i + j*ldsa ] = low_t( a );
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Returns true if every column of the residual R satisfies
+///     max_i |R(i,j)| <= max_i |X(i,j)| * cte,
+/// using |re| + |im| for complex, the same test as dsgesv.
+template <typename scalar_t>
+bool mixed_converged(
+    int64_t n, int64_t nrhs,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* R, int64_t ldr,
+    blas::real_type< scalar_t > cte )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::real;
+    using blas::imag;
+
+    for (int64_t j = 0; j < nrhs; ++j) {
+        real_t xnrm = 0, rnrm = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t x = X[ i + j*ldx ];
+            scalar_t r = R[ i + j*ldr ];
+            xnrm = blas::max( xnrm, std::abs( real( x ) ) + std::abs( imag( x ) ) );
+            rnrm = blas::max( rnrm, std::abs( real( r ) ) + std::abs( imag( r ) ) );
+        }
+        // Written so a NaN residual fails the test.
+        if (! (rnrm <= xnrm * cte))
+            return false;
+    }
+    return true;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_MIXED_COMMON_HH
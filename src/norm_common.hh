@@ -0,0 +1,438 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_NORM_COMMON_HH
+#define LAPACK_NORM_COMMON_HH
+
+#include "lapack/util.hh"
+#include "lapack/safe_scaling.hh"
+#include "NoConstructAllocator.hh"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+// Native kernels for lange, lansy, lanhe, and lantr.
+//
+// Inner loops keep norm_lanes independent partial results, in the style
+// of the interleaved batch kernels, so the compiler vectorizes them
+// without reassociating floating point operations. The matrix is split
+// into tiles whose shape depends only on m and n; tiles are spread over
+// OpenMP threads, and their partial results are combined in tile order.
+// Hence results don't depend on the number of threads.
+
+namespace lapack {
+namespace internal {
+
+// Partial results per inner loop.
+const int64_t norm_lanes = 8;
+
+// Elements per tile.
+const int64_t norm_tile_elems = 64*1024;
+
+// Rows per block for row sums; long enough that each column segment
+// streams efficiently.
+const int64_t norm_block_rows = 1024;
+
+// Tiles are done in parallel only for at least this many elements.
+const int64_t norm_parallel_min = 256*1024;
+
+//------------------------------------------------------------------------------
+// @return true if x is NaN. Written as x != x, which compilers vectorize.
+template <typename real_t>
+inline bool norm_isnan( real_t x )
+{
+    return x != x;
+}
+
+//------------------------------------------------------------------------------
+// @return larger of a and b, or NaN if either is NaN, so NaN propagates
+// as in the reference lange.
+template <typename real_t>
+inline real_t norm_max( real_t a, real_t b )
+{
+    return (b > a || norm_isnan( b )) ? b : a;
+}
+
+//------------------------------------------------------------------------------
+// Blue's scaled sum of squares, shared with safe::lassq.
+using safe::internal::SumSquares;
+
+//------------------------------------------------------------------------------
+// @return max_i |x_i| of n contiguous values, or NaN if any is NaN.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_max_abs( int64_t n, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t L = norm_lanes;
+    real_t v[ L ] = {};
+
+    int64_t i = 0;
+    for (; i + L <= n; i += L) {
+        for (int64_t l = 0; l < L; ++l)
+            v[ l ] = norm_max( v[ l ], real_t( std::abs( x[ i + l ] ) ) );
+    }
+    for (; i < n; ++i)
+        v[ 0 ] = norm_max( v[ 0 ], real_t( std::abs( x[ i ] ) ) );
+
+    real_t value = 0;
+    for (int64_t l = 0; l < L; ++l)
+        value = norm_max( value, v[ l ] );
+    return value;
+}
+
+//------------------------------------------------------------------------------
+// @return sum_i |x_i| of n contiguous values.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_sum_abs( int64_t n, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t L = norm_lanes;
+    real_t v[ L ] = {};
+
+    int64_t i = 0;
+    for (; i + L <= n; i += L) {
+        for (int64_t l = 0; l < L; ++l)
+            v[ l ] += std::abs( x[ i + l ] );
+    }
+    for (; i < n; ++i)
+        v[ 0 ] += std::abs( x[ i ] );
+
+    real_t sum = 0;
+    for (int64_t l = 0; l < L; ++l)
+        sum += v[ l ];
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+// Rows [ first, last ) of column j that are in the part of an m-by-n
+// matrix selected by uplo: all of it for General, or the strictly upper
+// or strictly lower trapezoid. Diagonals are handled by the callers.
+inline void norm_rows(
+    lapack::Uplo uplo, int64_t m, int64_t j, int64_t* first, int64_t* last )
+{
+    if (uplo == Uplo::Upper) {
+        *first = 0;
+        *last  = blas::min( m, j );
+    }
+    else if (uplo == Uplo::Lower) {
+        *first = blas::min( m, j + 1 );
+        *last  = m;
+    }
+    else {
+        *first = 0;
+        *last  = m;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Calls func( t ) for tiles t = 0, ..., ntiles-1, in parallel if there
+// are at least norm_parallel_min elements. func must not throw.
+template <typename Func>
+void norm_for( int64_t ntiles, int64_t elems, Func&& func )
+{
+    #if defined(_OPENMP)
+    bool parallel = ntiles > 1 && elems >= norm_parallel_min;
+    #pragma omp parallel for schedule( dynamic ) if (parallel)
+    #endif
+    for (int64_t t = 0; t < ntiles; ++t)
+        func( t );
+}
+
+//------------------------------------------------------------------------------
+// Calls func( t, &max, &sum ) for tiles t = 0, ..., ntiles-1, as in
+// norm_for, then combines each tile's max and sum of squares in tile
+// order. With one tile, which is usual for small matrices, func writes
+// directly to value and sum, and no memory is allocated.
+template <typename real_t, typename Func>
+void norm_reduce(
+    int64_t ntiles, int64_t elems, Func&& func,
+    real_t* value, SumSquares< real_t >* sum )
+{
+    *value = 0;
+    *sum = SumSquares< real_t >();
+    if (ntiles == 1) {
+        func( 0, value, sum );
+        return;
+    }
+
+    lapack::vector< real_t > maxs( ntiles );
+    lapack::vector< SumSquares< real_t > > sums( ntiles );
+    norm_for( ntiles, elems, [&]( int64_t t ) {
+        // lapack::vector doesn't initialize its elements
+        maxs[ t ] = 0;
+        sums[ t ] = SumSquares< real_t >();
+        func( t, &maxs[ t ], &sums[ t ] );
+    });
+
+    for (int64_t t = 0; t < ntiles; ++t) {
+        *value = norm_max( *value, maxs[ t ] );
+        sum->add( sums[ t ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Tiles of mb-by-nb elements, covering an m-by-n matrix in column-major
+// order of tiles. Tall matrices are split by rows, too.
+struct NormTiles
+{
+    NormTiles( int64_t m, int64_t n, bool split_rows )
+    {
+        mb = split_rows ? blas::max( 1, blas::min( m, norm_tile_elems ) ) : blas::max( 1, m );
+        nb = blas::max( 1, norm_tile_elems / mb );
+        mt = (m + mb - 1) / mb;
+        nt = (n + nb - 1) / nb;
+    }
+
+    int64_t mb, nb, mt, nt;
+};
+
+//------------------------------------------------------------------------------
+// Max norm or sum of squares of the part of an m-by-n matrix selected by
+// uplo, excluding the diagonal for Upper and Lower. Tiles are reduced in
+// parallel, then combined in tile order.
+template <typename scalar_t>
+void norm_max_sumsq(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* value,
+    SumSquares< blas::real_type< scalar_t > >* sum )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    NormTiles tiles( m, n, true );
+    int64_t ntiles = tiles.mt * tiles.nt;
+
+    auto tile = [&]( int64_t t, real_t* tile_max,
+                     SumSquares< real_t >* tile_sum ) {
+        int64_t i0 = (t % tiles.mt) * tiles.mb;
+        int64_t i1 = blas::min( i0 + tiles.mb, m );
+        int64_t j0 = (t / tiles.mt) * tiles.nb;
+        int64_t j1 = blas::min( j0 + tiles.nb, n );
+        for (int64_t j = j0; j < j1; ++j) {
+            int64_t first, last;
+            norm_rows( uplo, m, j, &first, &last );
+            first = blas::max( first, i0 );
+            last  = blas::min( last,  i1 );
+            if (first >= last)
+                continue;
+            if (norm == Norm::Max) {
+                *tile_max = norm_max(
+                    *tile_max, norm_max_abs( last - first, &A[ first + j*lda ] ) );
+            }
+            else {
+                tile_sum->add( last - first, &A[ first + j*lda ] );
+            }
+        }
+    };
+    norm_reduce( ntiles, m*n, tile, value, sum );
+}
+
+//------------------------------------------------------------------------------
+// Native norm of the part of an m-by-n matrix selected by uplo and diag:
+// General for lange, or a trapezoid for lantr, with an implicit unit
+// diagonal if diag is Unit.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_trapezoid(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag,
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf
+                     && norm != Norm::Fro && norm != Norm::Max );
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    // diagonal, which for General is part of the selected region
+    bool has_diag = uplo != Uplo::General;
+    bool unit = has_diag && diag == Diag::Unit;
+    int64_t mn = blas::min( m, n );
+    auto diag_abs = [&]( int64_t i ) -> real_t {
+        return unit ? real_t( 1 ) : real_t( std::abs( A[ i + i*lda ] ) );
+    };
+
+    real_t value = 0;
+    if (norm == Norm::Max || norm == Norm::Fro) {
+        SumSquares< real_t > sum;
+        norm_max_sumsq( norm, uplo, m, n, A, lda, &value, &sum );
+        if (norm == Norm::Max) {
+            if (has_diag) {
+                for (int64_t i = 0; i < mn; ++i)
+                    value = norm_max( value, diag_abs( i ) );
+            }
+        }
+        else {
+            if (unit) {
+                sum.med += mn;
+            }
+            else if (has_diag) {
+                SumSquares< real_t > dsum;
+                for (int64_t i = 0; i < mn; ++i)
+                    dsum.add( 1, &A[ i + i*lda ] );
+                sum.add( dsum );
+            }
+            value = sum.norm();
+        }
+    }
+    else if (norm == Norm::One) {
+        // max column sum, by tiles of columns
+        NormTiles tiles( m, n, false );
+        auto tile = [&]( int64_t t, real_t* tile_max, SumSquares< real_t >* ) {
+            int64_t j0 = t * tiles.nb;
+            int64_t j1 = blas::min( j0 + tiles.nb, n );
+            for (int64_t j = j0; j < j1; ++j) {
+                int64_t first, last;
+                norm_rows( uplo, m, j, &first, &last );
+                real_t colsum = first < last
+                              ? norm_sum_abs( last - first, &A[ first + j*lda ] )
+                              : real_t( 0 );
+                if (has_diag && j < mn)
+                    colsum += diag_abs( j );
+                *tile_max = norm_max( *tile_max, colsum );
+            }
+        };
+        SumSquares< real_t > unused;
+        norm_reduce( tiles.nt, m*n, tile, &value, &unused );
+    }
+    else {
+        // max row sum, by blocks of rows; within a block, the loop over
+        // rows is contiguous and vectorizes, and each row sums in column
+        // order. Row sums of a block are on the stack.
+        int64_t mb = norm_block_rows;
+        int64_t mt = (m + mb - 1) / mb;
+        auto tile = [&]( int64_t t, real_t* tile_max, SumSquares< real_t >* ) {
+            real_t rowsum[ norm_block_rows ];
+            int64_t i0 = t * mb;
+            int64_t i1 = blas::min( i0 + mb, m );
+            for (int64_t i = i0; i < i1; ++i)
+                rowsum[ i - i0 ] = (has_diag && i < mn) ? diag_abs( i ) : real_t( 0 );
+            for (int64_t j = 0; j < n; ++j) {
+                int64_t first, last;
+                norm_rows( uplo, m, j, &first, &last );
+                first = blas::max( first, i0 );
+                last  = blas::min( last,  i1 );
+                scalar_t const* Aj = &A[ j*lda + i0 ];
+                for (int64_t i = first - i0; i < last - i0; ++i)
+                    rowsum[ i ] += std::abs( Aj[ i ] );
+            }
+            for (int64_t i = 0; i < i1 - i0; ++i)
+                *tile_max = norm_max( *tile_max, rowsum[ i ] );
+        };
+        SumSquares< real_t > unused;
+        norm_reduce( mt, m*n, tile, &value, &unused );
+    }
+    return value;
+}
+
+//------------------------------------------------------------------------------
+// Native norm of an n-by-n symmetric (lansy) or Hermitian (lanhe) matrix,
+// stored in the triangle given by uplo. For Hermitian matrices, the
+// imaginary parts of the diagonal are assumed zero and not referenced.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_symmetric(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda, bool hermitian )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf
+                     && norm != Norm::Fro && norm != Norm::Max );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+
+    if (n == 0)
+        return 0;
+
+    auto diag_abs = [&]( int64_t i ) -> real_t {
+        return hermitian ? real_t( std::abs( blas::real( A[ i + i*lda ] ) ) )
+                         : real_t( std::abs( A[ i + i*lda ] ) );
+    };
+
+    real_t value = 0;
+    if (norm == Norm::Max || norm == Norm::Fro) {
+        // strictly upper or lower triangle, then the diagonal
+        SumSquares< real_t > sum;
+        norm_max_sumsq( norm, uplo, n, n, A, lda, &value, &sum );
+        if (norm == Norm::Max) {
+            for (int64_t i = 0; i < n; ++i)
+                value = norm_max( value, diag_abs( i ) );
+        }
+        else {
+            // off-diagonal elements appear twice
+            sum.big *= 2;
+            sum.med *= 2;
+            sum.sml *= 2;
+
+            SumSquares< real_t > dsum;
+            for (int64_t i = 0; i < n; ++i) {
+                if (hermitian) {
+                    real_t d = blas::real( A[ i + i*lda ] );
+                    dsum.add( 1, &d );
+                }
+                else {
+                    dsum.add( 1, &A[ i + i*lda ] );
+                }
+            }
+            sum.add( dsum );
+            value = sum.norm();
+        }
+    }
+    else {
+        // One and Inf norms are equal. The sum for index k is the sum of
+        // the stored part of column k plus the stored part of row k,
+        // computed by column tiles and row blocks, respectively.
+        // Sums for up to norm_block_rows indices are on the stack.
+        bool small = n <= norm_block_rows;
+        real_t colsum_stack[ norm_block_rows ], rowsum_stack[ norm_block_rows ];
+        lapack::vector< real_t > colsum_heap( small ? 0 : n );
+        lapack::vector< real_t > rowsum_heap( small ? 0 : n );
+        real_t* colsum = small ? colsum_stack : colsum_heap.data();
+        real_t* rowsum = small ? rowsum_stack : rowsum_heap.data();
+
+        NormTiles tiles( n, n, false );
+        norm_for( tiles.nt, n*n, [&]( int64_t t ) {
+            int64_t j0 = t * tiles.nb;
+            int64_t j1 = blas::min( j0 + tiles.nb, n );
+            for (int64_t j = j0; j < j1; ++j) {
+                int64_t first, last;
+                norm_rows( uplo, n, j, &first, &last );
+                colsum[ j ] = diag_abs( j );
+                if (first < last)
+                    colsum[ j ] += norm_sum_abs( last - first, &A[ first + j*lda ] );
+            }
+        });
+
+        int64_t mb = norm_block_rows;
+        int64_t mt = (n + mb - 1) / mb;
+        norm_for( mt, n*n, [&]( int64_t t ) {
+            int64_t i0 = t * mb;
+            int64_t i1 = blas::min( i0 + mb, n );
+            for (int64_t i = i0; i < i1; ++i)
+                rowsum[ i ] = 0;
+            // row i of the stored triangle, excluding the diagonal,
+            // is column i of the other triangle
+            for (int64_t j = 0; j < n; ++j) {
+                int64_t first, last;
+                norm_rows( uplo, n, j, &first, &last );
+                first = blas::max( first, i0 );
+                last  = blas::min( last,  i1 );
+                scalar_t const* Aj = &A[ j*lda ];
+                for (int64_t i = first; i < last; ++i)
+                    rowsum[ i ] += std::abs( Aj[ i ] );
+            }
+        });
+
+        for (int64_t k = 0; k < n; ++k)
+            value = norm_max( value, colsum[ k ] + rowsum[ k ] );
+    }
+    return value;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_NORM_COMMON_HH
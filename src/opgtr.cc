@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t opgtr(
     // allocate workspace
     lapack::vector< float > work( (n-1) );
 
+    lapack_trace_block( "opgtr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sopgtr(
         &uplo_, &n_,
         AP,
@@ -71,6 +74,8 @@ int64_t opgtr(
     // allocate workspace
     lapack::vector< double > work( (n-1) );
 
+    lapack_trace_block( "opgtr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dopgtr(
         &uplo_, &n_,
         AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -46,6 +47,8 @@ int64_t opmtr(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "opmtr", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sopmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         AP,
@@ -93,6 +96,8 @@ int64_t opmtr(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "opmtr", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dopmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         AP,
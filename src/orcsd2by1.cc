@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30500  // >= 3.5
@@ -78,6 +79,8 @@ int64_t orcsd2by1(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
 
+    lapack_trace_block( "orcsd2by1", 's', m, 0, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
@@ -159,6 +162,8 @@ int64_t orcsd2by1(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
 
+    lapack_trace_block( "orcsd2by1", 'd', m, 0, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +57,8 @@ int64_t orgbr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "orgbr", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_sorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
@@ -113,6 +116,8 @@ int64_t orgbr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "orgbr", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
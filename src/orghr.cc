@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -50,6 +51,8 @@ int64_t orghr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "orghr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -96,6 +99,8 @@ int64_t orghr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "orghr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
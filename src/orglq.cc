@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +53,9 @@ int64_t orglq(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "orglq", 's', m, n, k,
+                        Gflop< float >::orglq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_sorglq(
         &m_, &n_, &k_,
         A, &lda_,
@@ -99,6 +104,9 @@ int64_t orglq(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "orglq", 'd', m, n, k,
+                        Gflop< double >::orglq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_dorglq(
         &m_, &n_, &k_,
         A, &lda_,
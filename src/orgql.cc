@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +53,9 @@ int64_t orgql(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "orgql", 's', m, n, k,
+                        Gflop< float >::orgql( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_sorgql(
         &m_, &n_, &k_,
         A, &lda_,
@@ -99,6 +104,9 @@ int64_t orgql(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "orgql", 'd', m, n, k,
+                        Gflop< double >::orgql( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_dorgql(
         &m_, &n_, &k_,
         A, &lda_,
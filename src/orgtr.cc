@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -52,6 +53,8 @@ int64_t orgtr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "orgtr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sorgtr(
         &uplo_, &n_,
         A, &lda_,
@@ -105,6 +108,8 @@ int64_t orgtr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "orgtr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dorgtr(
         &uplo_, &n_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30900  // >= 3.9.0
 
@@ -40,6 +41,7 @@ int64_t orhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "orhr_col", 's', m, n, 0, 0 );
     LAPACK_sorhr_col(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -159,6 +161,7 @@ int64_t orhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "orhr_col", 'd', m, n, 0, 0 );
     LAPACK_dorhr_col(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t ormbr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormbr", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_sormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -134,6 +137,8 @@ int64_t ormbr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormbr", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t ormhr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormhr", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -133,6 +136,8 @@ int64_t ormhr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormhr", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
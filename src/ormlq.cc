@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +67,9 @@ int64_t ormlq(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormlq", 's', m, n, k,
+                        Gflop< float >::ormlq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_sormlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -132,6 +137,9 @@ int64_t ormlq(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormlq", 'd', m, n, k,
+                        Gflop< double >::ormlq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_dormlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +67,9 @@ int64_t ormql(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormql", 's', m, n, k,
+                        Gflop< float >::ormql( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_sormql(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -132,6 +137,9 @@ int64_t ormql(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormql", 'd', m, n, k,
+                        Gflop< double >::ormql( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_dormql(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
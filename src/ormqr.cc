@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -16,8 +18,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::ormqr_work_query
 /// @ingroup geqrf
-int64_t ormqr(
+lapack::WorkSizes ormqr_work_query(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
     float const* tau,
@@ -62,9 +65,45 @@ int64_t ormqr(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::ormqr_work
+/// @ingroup geqrf
+int64_t ormqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "ormqr", 's', m, n, k,
+                        Gflop< float >::ormqr( side, m, n, k ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_sormqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -82,9 +121,40 @@ int64_t ormqr(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::unmqr
 /// @ingroup geqrf
 int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    // query for workspace size
+    WorkSizes sizes = ormqr_work_query(
+        side, trans, m, n, k,
+        A, lda,
+        tau,
+        C, ldc );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return ormqr_work(
+        side, trans, m, n, k,
+        A, lda,
+        tau,
+        C, ldc,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ormqr_work. Takes the same arguments as
+/// lapack::ormqr; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup geqrf
+lapack::WorkSizes ormqr_work_query(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
     double const* tau,
@@ -129,9 +199,55 @@ int64_t ormqr(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::ormqr, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::ormqr.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::ormqr_work_query.
+///
+/// @ingroup geqrf
+int64_t ormqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "ormqr", 'd', m, n, k,
+                        Gflop< double >::ormqr( side, m, n, k ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dormqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -148,4 +264,31 @@ int64_t ormqr(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::unmqr
+/// @ingroup geqrf
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    // query for workspace size
+    WorkSizes sizes = ormqr_work_query(
+        side, trans, m, n, k,
+        A, lda,
+        tau,
+        C, ldc );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return ormqr_work(
+        side, trans, m, n, k,
+        A, lda,
+        tau,
+        C, ldc,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +67,9 @@ int64_t ormrq(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormrq", 's', m, n, k,
+                        Gflop< float >::ormrq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_sormrq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -132,6 +137,9 @@ int64_t ormrq(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormrq", 'd', m, n, k,
+                        Gflop< double >::ormrq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_dormrq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
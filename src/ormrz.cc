@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -66,6 +67,8 @@ int64_t ormrz(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormrz", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_sormrz(
         &side_, &trans_, &m_, &n_, &k_, &l_,
         A, &lda_,
@@ -133,6 +136,8 @@ int64_t ormrz(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormrz", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dormrz(
         &side_, &trans_, &m_, &n_, &k_, &l_,
         A, &lda_,
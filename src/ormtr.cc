@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -64,6 +65,8 @@ int64_t ormtr(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "ormtr", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sormtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         A, &lda_,
@@ -130,6 +133,8 @@ int64_t ormtr(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "ormtr", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dormtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         A, &lda_,
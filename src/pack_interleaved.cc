@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Copies a batch of m-by-n matrices, stored column-major at a fixed
+/// stride, into interleaved layout. Padding matrices in the last chunk
+/// are set to the identity, so kernels compute on well-defined values.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] A
+///     Matrix A_i is the m-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] stride_A
+///     Distance between consecutive A_i. stride_A >= lda*n.
+///
+/// @param[out] Ai
+///     Array of length interleaved_size( m, n, batch ).
+///     On exit, the batch in interleaved layout.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @see lapack::interleaved_size
+/// @ingroup initialize
+template <typename scalar_t>
+void pack_interleaved(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda, int64_t stride_A,
+    scalar_t* Ai,
+    size_t batch )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( stride_A < lda*n );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+    const int64_t stride_chunk = m*n*W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        scalar_t* Ac = &Ai[ c*stride_chunk ];
+        int64_t lanes = std::min( W, int64_t( batch ) - int64_t( c )*W );
+        for (int64_t l = 0; l < W; ++l) {
+            if (l < lanes) {
+                scalar_t const* A_l = &A[ (c*W + l)*stride_A ];
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < m; ++i)
+                        Ac[ (i + j*m)*W + l ] = A_l[ i + j*lda ];
+            }
+            else {
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < m; ++i)
+                        Ac[ (i + j*m)*W + l ] = (i == j ? 1 : 0);
+            }
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Copies a batch of m-by-n matrices from interleaved layout to
+/// column-major matrices stored at a fixed stride.
+/// Padding matrices are not copied.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] Ai
+///     Array of length interleaved_size( m, n, batch ),
+///     holding the batch in interleaved layout.
+///
+/// @param[out] A
+///     Matrix A_i is the m-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] stride_A
+///     Distance between consecutive A_i. stride_A >= lda*n.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @see lapack::pack_interleaved
+/// @ingroup initialize
+template <typename scalar_t>
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    scalar_t const* Ai,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    size_t batch )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( stride_A < lda*n );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+    const int64_t stride_chunk = m*n*W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        scalar_t const* Ac = &Ai[ c*stride_chunk ];
+        int64_t lanes = std::min( W, int64_t( batch ) - int64_t( c )*W );
+        for (int64_t l = 0; l < lanes; ++l) {
+            scalar_t* A_l = &A[ (c*W + l)*stride_A ];
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    A_l[ i + j*lda ] = Ac[ (i + j*m)*W + l ];
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void pack_interleaved(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda, int64_t stride_A,
+    float* Ai,
+    size_t batch );
+
+template
+void pack_interleaved(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda, int64_t stride_A,
+    double* Ai,
+    size_t batch );
+
+template
+void pack_interleaved(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda, int64_t stride_A,
+    std::complex<float>* Ai,
+    size_t batch );
+
+template
+void pack_interleaved(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda, int64_t stride_A,
+    std::complex<double>* Ai,
+    size_t batch );
+
+//--------------------
+template
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    float const* Ai,
+    float* A, int64_t lda, int64_t stride_A,
+    size_t batch );
+
+template
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    double const* Ai,
+    double* A, int64_t lda, int64_t stride_A,
+    size_t batch );
+
+template
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    std::complex<float> const* Ai,
+    std::complex<float>* A, int64_t lda, int64_t stride_A,
+    size_t batch );
+
+template
+void unpack_interleaved(
+    int64_t m, int64_t n,
+    std::complex<double> const* Ai,
+    std::complex<double>* A, int64_t lda, int64_t stride_A,
+    size_t batch );
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -38,6 +39,8 @@ int64_t pbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbcon", 's', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_spbcon(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &anorm, rcond,
@@ -76,6 +79,8 @@ int64_t pbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbcon", 'd', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dpbcon(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &anorm, rcond,
@@ -114,6 +119,8 @@ int64_t pbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "pbcon", 'c', n, n, kd, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cpbcon(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, &anorm, rcond,
@@ -197,6 +204,8 @@ int64_t pbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "pbcon", 'z', n, n, kd, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zpbcon(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, &anorm, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -35,6 +36,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbequ", 's', n, n, kd, 0 );
     LAPACK_spbequ(
         &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -70,6 +72,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbequ", 'd', n, n, kd, 0 );
     LAPACK_dpbequ(
         &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -105,6 +108,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbequ", 'c', n, n, kd, 0 );
     LAPACK_cpbequ(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -192,6 +196,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbequ", 'z', n, n, kd, 0 );
     LAPACK_zpbequ(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
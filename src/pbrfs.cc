@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -50,6 +51,8 @@ int64_t pbrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_spbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -105,6 +108,8 @@ int64_t pbrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -160,6 +165,8 @@ int64_t pbrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "pbrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -293,6 +300,8 @@ int64_t pbrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "pbrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -32,6 +33,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbstf", 's', n, n, kd, 0 );
     LAPACK_spbstf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -63,6 +65,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbstf", 'd', n, n, kd, 0 );
     LAPACK_dpbstf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -94,6 +97,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbstf", 'c', n, n, kd, 0 );
     LAPACK_cpbstf(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, &info_
@@ -221,6 +225,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbstf", 'z', n, n, kd, 0 );
     LAPACK_zpbstf(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, &info_
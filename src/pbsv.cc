@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -37,6 +39,8 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbsv", 's', n, n, nrhs,
+                        Gflop< float >::pbsv( n, nrhs, kd ) );
     LAPACK_spbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -74,6 +78,8 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbsv", 'd', n, n, nrhs,
+                        Gflop< double >::pbsv( n, nrhs, kd ) );
     LAPACK_dpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -111,6 +117,8 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::pbsv( n, nrhs, kd ) );
     LAPACK_cpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -236,6 +244,8 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::pbsv( n, nrhs, kd ) );
     LAPACK_zpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -55,6 +56,8 @@ int64_t pbsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_spbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -118,6 +121,8 @@ int64_t pbsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pbsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -181,6 +186,8 @@ int64_t pbsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "pbsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -442,6 +449,8 @@ int64_t pbsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "pbsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
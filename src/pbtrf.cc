@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -32,6 +34,8 @@ int64_t pbtrf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrf", 's', n, n, kd,
+                        Gflop< float >::pbtrf( n, kd ) );
     LAPACK_spbtrf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -63,6 +67,8 @@ int64_t pbtrf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrf", 'd', n, n, kd,
+                        Gflop< double >::pbtrf( n, kd ) );
     LAPACK_dpbtrf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -94,6 +100,8 @@ int64_t pbtrf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrf", 'c', n, n, kd,
+                        Gflop< std::complex<float> >::pbtrf( n, kd ) );
     LAPACK_cpbtrf(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, &info_
@@ -191,6 +199,8 @@ int64_t pbtrf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrf", 'z', n, n, kd,
+                        Gflop< std::complex<double> >::pbtrf( n, kd ) );
     LAPACK_zpbtrf(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, &info_
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -37,6 +39,8 @@ int64_t pbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrs", 's', n, n, nrhs,
+                        Gflop< float >::pbtrs( n, nrhs, kd ) );
     LAPACK_spbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -74,6 +78,8 @@ int64_t pbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrs", 'd', n, n, nrhs,
+                        Gflop< double >::pbtrs( n, nrhs, kd ) );
     LAPACK_dpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -111,6 +117,8 @@ int64_t pbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::pbtrs( n, nrhs, kd ) );
     LAPACK_cpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -193,6 +201,8 @@ int64_t pbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pbtrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::pbtrs( n, nrhs, kd ) );
     LAPACK_zpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrf", 's', n, n, 0, 0 );
     LAPACK_spftrf(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -55,6 +57,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrf", 'd', n, n, 0, 0 );
     LAPACK_dpftrf(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -82,6 +85,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrf", 'c', n, n, 0, 0 );
     LAPACK_cpftrf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &info_
@@ -109,6 +113,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrf", 'z', n, n, 0, 0 );
     LAPACK_zpftrf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &info_
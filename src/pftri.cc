@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftri", 's', n, n, 0, 0 );
     LAPACK_spftri(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -55,6 +57,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftri", 'd', n, n, 0, 0 );
     LAPACK_dpftri(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -82,6 +85,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftri", 'c', n, n, 0, 0 );
     LAPACK_cpftri(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &info_
@@ -109,6 +113,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftri", 'z', n, n, 0, 0 );
     LAPACK_zpftri(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &info_
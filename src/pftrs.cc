@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrs", 's', n, n, nrhs, 0 );
     LAPACK_spftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         A,
@@ -66,6 +68,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrs", 'd', n, n, nrhs, 0 );
     LAPACK_dpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         A,
@@ -99,6 +102,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrs", 'c', n, n, nrhs, 0 );
     LAPACK_cpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A,
@@ -132,6 +136,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pftrs", 'z', n, n, nrhs, 0 );
     LAPACK_zpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +37,8 @@ int64_t pocon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pocon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_spocon(
         &uplo_, &n_,
         A, &lda_, &anorm, rcond,
@@ -72,6 +75,8 @@ int64_t pocon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pocon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dpocon(
         &uplo_, &n_,
         A, &lda_, &anorm, rcond,
@@ -108,6 +113,8 @@ int64_t pocon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "pocon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cpocon(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &anorm, rcond,
@@ -179,6 +186,8 @@ int64_t pocon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "pocon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zpocon(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &anorm, rcond,
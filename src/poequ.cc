@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -32,6 +33,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequ", 's', n, n, 0, 0 );
     LAPACK_spoequ(
         &n_,
         A, &lda_,
@@ -60,6 +62,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequ", 'd', n, n, 0, 0 );
     LAPACK_dpoequ(
         &n_,
         A, &lda_,
@@ -88,6 +91,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequ", 'c', n, n, 0, 0 );
     LAPACK_cpoequ(
         &n_,
         (lapack_complex_float*) A, &lda_,
@@ -157,6 +161,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequ", 'z', n, n, 0, 0 );
     LAPACK_zpoequ(
         &n_,
         (lapack_complex_double*) A, &lda_,
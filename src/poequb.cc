@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -32,6 +33,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequb", 's', n, n, 0, 0 );
     LAPACK_spoequb(
         &n_,
         A, &lda_,
@@ -60,6 +62,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequb", 'd', n, n, 0, 0 );
     LAPACK_dpoequb(
         &n_,
         A, &lda_,
@@ -88,6 +91,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequb", 'c', n, n, 0, 0 );
     LAPACK_cpoequb(
         &n_,
         (lapack_complex_float*) A, &lda_,
@@ -163,6 +167,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "poequb", 'z', n, n, 0, 0 );
     LAPACK_zpoequb(
         &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +49,8 @@ int64_t porfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "porfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sporfs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -101,6 +104,8 @@ int64_t porfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "porfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dporfs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -154,6 +159,8 @@ int64_t porfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "porfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cporfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -284,6 +291,8 @@ int64_t porfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "porfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zporfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
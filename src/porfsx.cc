@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
@@ -59,6 +60,8 @@ int64_t porfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "porfsx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -124,6 +127,8 @@ int64_t porfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "porfsx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -189,6 +194,8 @@ int64_t porfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "porfsx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -514,6 +521,8 @@ int64_t porfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "porfsx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "posv", 's', n, n, nrhs,
+                        Gflop< float >::posv( n, nrhs ) );
     LAPACK_sposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -71,6 +75,8 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "posv", 'd', n, n, nrhs,
+                        Gflop< double >::posv( n, nrhs ) );
     LAPACK_dposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -106,6 +112,8 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "posv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::posv( n, nrhs ) );
     LAPACK_cposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -200,6 +208,8 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "posv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::posv( n, nrhs ) );
     LAPACK_zposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -243,6 +253,9 @@ int64_t posv(
     lapack::vector< double > work( (n)*(nrhs) );
     lapack::vector< float > swork( (n*(n+nrhs)) );
 
+    lapack_trace_block( "posv", 'd', n, n, nrhs,
+                        Gflop< double >::posv( n, nrhs ) );
+    lapack_trace_work( work, swork );
     LAPACK_dsposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -291,6 +304,9 @@ int64_t posv(
     lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "posv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::posv( n, nrhs ) );
+    lapack_trace_work( work, swork, rwork );
     LAPACK_zcposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,129 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// where each A_i is an n-by-n Hermitian positive definite matrix and
+/// X_i and B_i are n-by-nrhs, with the matrices stored at fixed strides.
+/// Arguments are checked once for the whole batch; then each system is
+/// solved by lapack::posv, with the batch distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] A
+///     Matrix A_i is the n-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///     On successful exit, the factor U or L from the Cholesky
+///     factorization of A_i.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] stride_A
+///     Distance between consecutive A_i. stride_A >= lda*n.
+///
+/// @param[in,out] B
+///     Matrix B_i is the n-by-nrhs matrix starting at B + i*stride_B,
+///     stored in an ldb-by-nrhs array.
+///     On successful exit, the solution X_i.
+///
+/// @param[in] ldb
+///     Leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] stride_B
+///     Distance between consecutive B_i. stride_B >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::posv
+///     return value for system i.
+///
+/// @see lapack::potrf_batch_strided
+/// @ingroup posv
+template <typename scalar_t>
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    scalar_t* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( stride_A < lda*n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( stride_B < ldb*nrhs );
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        info[ i ] = posv( uplo, n, nrhs, &A[ i*stride_A ], lda,
+                          &B[ i*stride_B ], ldb );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t stride_A,
+    float* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t stride_A,
+    double* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t stride_A,
+    std::complex<float>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t stride_A,
+    std::complex<double>* B, int64_t ldb, int64_t stride_B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
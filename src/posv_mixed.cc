@@ -0,0 +1,212 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "mixed_common.hh"
+#include "NoConstructAllocator.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using low_t  = typename mixed_low_type< scalar_t >::type;
+
+    const scalar_t one = 1.0;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    *iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    // Stopping criterion of dsposv: ||r||_max <= ||x||_max ||A||_inf sqrt(n) eps,
+    // with eps = dlamch( 'E' ), the unit roundoff.
+    const real_t eps = std::numeric_limits< real_t >::epsilon() / 2;
+    real_t Anorm = lapack::lanhe( Norm::Inf, uplo, n, A, lda );
+    real_t cte = Anorm * eps * std::sqrt( real_t( n ) );
+
+    int64_t ldr = n;
+    lapack::vector< scalar_t > R( n * nrhs );
+    lapack::vector< low_t > SA( n * n );
+    lapack::vector< low_t > SX( n * nrhs );
+
+    // R = B - A X
+    auto residual = [&]() {
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, &R[0], ldr );
+        blas::hemm( Layout::ColMajor, Side::Left, uplo, n, nrhs,
+                    -one, A, lda,
+                          X, ldx,
+                    one,  &R[0], ldr );
+    };
+
+    int64_t iiter = 0;
+    if (lag2_low( n, nrhs, B, ldb, &SX[0], n ) != 0) {
+        *iter = -2;
+    }
+    else if (lat2_low( uplo, n, A, lda, &SA[0], n ) != 0) {
+        *iter = -2;
+    }
+    else if (lapack::potrf( uplo, n, &SA[0], n ) != 0) {
+        *iter = -3;
+    }
+    else {
+        // Initial solve in low precision.
+        lapack::potrs( uplo, n, nrhs, &SA[0], n, &SX[0], n );
+        lag2_high( n, nrhs, &SX[0], n, X, ldx );
+        residual();
+
+        for (iiter = 0; iiter <= mixed_itermax; ++iiter) {
+            if (mixed_converged( n, nrhs, X, ldx, &R[0], ldr, cte )) {
+                *iter = iiter;
+                return 0;
+            }
+            if (iiter == mixed_itermax) {
+                *iter = -(mixed_itermax + 1);
+                break;
+            }
+            // Correction: solve A C = R in low precision; X += C.
+            if (lag2_low( n, nrhs, &R[0], ldr, &SX[0], n ) != 0) {
+                *iter = -2;
+                break;
+            }
+            lapack::potrs( uplo, n, nrhs, &SA[0], n, &SX[0], n );
+            lag2_high( n, nrhs, &SX[0], n, &R[0], ldr );
+            for (int64_t j = 0; j < nrhs; ++j) {
+                blas::axpy( n, one, &R[ j*ldr ], 1, &X[ j*ldx ], 1 );
+            }
+            residual();
+        }
+    }
+
+    // Fall back to factoring and solving in full precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    int64_t info = lapack::potrf( uplo, n, A, lda );
+    if (info == 0) {
+        lapack::potrs( uplo, n, nrhs, A, lda, X, ldx );
+    }
+    return info;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n Hermitian positive definite matrix and X and B
+/// are n-by-nrhs matrices, using mixed-precision iterative refinement.
+///
+/// A is factored in single precision with lapack::potrf, and the
+/// solution is refined in double precision until its backward error
+/// matches that of a double precision solve. If refinement does not
+/// converge, or single precision fails (overflow or a factor that is
+/// not positive definite), A is refactored in double precision and the
+/// system solved directly, so the result is always as accurate as
+/// lapack::posv.
+///
+/// Unlike lapack::posv with iter, which calls LAPACK's dsposv or zcposv,
+/// this is implemented in C++ on top of this library's routines.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle of A is referenced.
+///     On exit, if iterative refinement has been successfully used
+///     (info = 0 and iter >= 0), then A is unchanged. If double
+///     precision factorization has been used (info = 0 and iter < 0),
+///     then the uplo triangle of A contains the factor U or L from the
+///     Cholesky factorization $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs array X, stored in an ldx-by-nrhs array.
+///     If info = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - < 0: iterative refinement has failed, double precision
+///            factorization has been performed
+///         - -2: overflow converting to single precision
+///         - -3: failure of single precision lapack::potrf
+///         - -31: refinement did not converge in 30 iterations
+///     - > 0: iterative refinement has been successfully used.
+///            Returns the number of refinement iterations.
+///     - = 0: the single precision solve was already accurate.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of
+///     (double precision) A is not positive definite, so the
+///     factorization could not be completed, and the solution
+///     has not been computed.
+///
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter )
+{
+    return internal::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::posv_mixed
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter )
+{
+    return internal::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+}  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potf2", 's', n, n, 0, Gflop< float >::potrf( n ) );
     LAPACK_spotf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -59,6 +62,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potf2", 'd', n, n, 0, Gflop< double >::potrf( n ) );
     LAPACK_dpotf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -88,6 +92,8 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potf2", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::potrf( n ) );
     LAPACK_cpotf2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -162,6 +168,8 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potf2", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::potrf( n ) );
     LAPACK_zpotf2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -32,6 +34,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrf2", 's', n, n, 0, Gflop< float >::potrf( n ) );
     LAPACK_spotrf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -61,6 +64,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrf2", 'd', n, n, 0, Gflop< double >::potrf( n ) );
     LAPACK_dpotrf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -90,6 +94,8 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrf2", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::potrf( n ) );
     LAPACK_cpotrf2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -176,6 +182,8 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrf2", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::potrf( n ) );
     LAPACK_zpotrf2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
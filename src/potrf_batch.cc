@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite matrices.
+/// Each matrix is factored by lapack::potrf; matrices are distributed
+/// over OpenMP threads. For best throughput on small matrices,
+/// use a single-threaded LAPACK library.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Vector of length 1 or batch.
+///     - lapack::Uplo::Upper: Upper triangle of A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A_i is stored.
+///
+/// @param[in] n
+///     Vector of length 1 or batch. The order of each matrix A_i.
+///
+/// @param[in,out] Aarray
+///     Vector of length batch. Aarray[i] is the n_i-by-n_i matrix A_i,
+///     stored in an lda_i-by-n_i array.
+///     On successful exit, the factor U or L from the Cholesky
+///     factorization of A_i.
+///
+/// @param[in] lda
+///     Vector of length 1 or batch. Leading dimension of each A_i.
+///     lda_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::potrf
+///     return value for A_i.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<scalar_t*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    using internal::extract;
+
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_check_batch_arg( uplo, batch );
+    lapack_check_batch_arg( n, batch );
+    lapack_check_batch_array( Aarray, batch );
+    lapack_check_batch_arg( lda, batch );
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Uplo uplo_i = extract( uplo, i );
+        int64_t n_i = extract( n, i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( extract( lda, i ) < max( 1, n_i ) );
+    }
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        info[ i ] = potrf( extract( uplo, i ), extract( n, i ),
+                           Aarray[ i ], extract( lda, i ) );
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite matrices, stored at a fixed stride.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     Matrix A_i is the n-by-n matrix starting at A + i*stride_A,
+///     stored in an lda-by-n array.
+///     On successful exit, the factor U or L from the Cholesky
+///     factorization of A_i.
+///
+/// @param[in] lda
+///     Leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] stride_A
+///     Distance between consecutive matrices. stride_A >= lda*n.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is the lapack::potrf
+///     return value for A_i.
+///
+/// @see lapack::potrf_batch
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( stride_A < lda*n );
+
+    internal::batch_for( batch, [&]( size_t i ) {
+        info[ i ] = potrf( uplo, n, &A[ i*stride_A ], lda );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<float*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<double*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<std::complex<float>*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch(
+    std::vector<lapack::Uplo> const& uplo,
+    std::vector<int64_t> const& n,
+    std::vector<std::complex<double>*> const& Aarray,
+    std::vector<int64_t> const& lda,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+//--------------------
+template
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t stride_A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
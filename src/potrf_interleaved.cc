@@ -0,0 +1,195 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+#include <cmath>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Cholesky factorization of one chunk of W interleaved n-by-n matrices.
+// Loops over lanes l have the constant trip count W, so the compiler
+// vectorizes across matrices. Once a lane fails, its remaining entries
+// are left unchanged, as potrf would leave them.
+template <typename scalar_t>
+void potrf_interleaved_chunk(
+    lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    constexpr int64_t W = interleaved_width;
+
+    real_t ajj[ W ];
+    real_t rcp[ W ];
+    bool okay[ W ];
+
+    for (int64_t l = 0; l < W; ++l) {
+        info[ l ] = 0;
+        okay[ l ] = true;
+    }
+
+    for (int64_t j = 0; j < n; ++j) {
+        // compute diagonal entry
+        scalar_t* Ajj = &A[ (j + j*n)*W ];
+        for (int64_t l = 0; l < W; ++l)
+            ajj[ l ] = real( Ajj[ l ] );
+        for (int64_t k = 0; k < j; ++k) {
+            // Upper: A(k, j); Lower: A(j, k)
+            scalar_t const* Ak = (uplo == Uplo::Upper)
+                               ? &A[ (k + j*n)*W ]
+                               : &A[ (j + k*n)*W ];
+            for (int64_t l = 0; l < W; ++l)
+                ajj[ l ] -= real( conj( Ak[ l ] ) * Ak[ l ] );
+        }
+        for (int64_t l = 0; l < W; ++l) {
+            if (okay[ l ]) {
+                if (ajj[ l ] <= 0 || std::isnan( ajj[ l ] )) {
+                    Ajj[ l ] = ajj[ l ];
+                    info[ l ] = j + 1;
+                    okay[ l ] = false;
+                }
+                else {
+                    ajj[ l ] = std::sqrt( ajj[ l ] );
+                    Ajj[ l ] = ajj[ l ];
+                }
+            }
+            rcp[ l ] = okay[ l ] ? 1 / ajj[ l ] : 0;
+        }
+
+        // compute row j of U or column j of L
+        for (int64_t i = j+1; i < n; ++i) {
+            if (uplo == Uplo::Upper) {
+                // A(j, i) = (A(j, i) - A(0:j-1, j)^H A(0:j-1, i)) / ajj
+                scalar_t* Aji = &A[ (j + i*n)*W ];
+                scalar_t sum[ W ];
+                for (int64_t l = 0; l < W; ++l)
+                    sum[ l ] = Aji[ l ];
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* Akj = &A[ (k + j*n)*W ];
+                    scalar_t const* Aki = &A[ (k + i*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        sum[ l ] -= conj( Akj[ l ] ) * Aki[ l ];
+                }
+                for (int64_t l = 0; l < W; ++l)
+                    Aji[ l ] = okay[ l ] ? sum[ l ] * rcp[ l ] : Aji[ l ];
+            }
+            else {
+                // A(i, j) = (A(i, j) - A(i, 0:j-1) A(j, 0:j-1)^H) / ajj
+                scalar_t* Aij = &A[ (i + j*n)*W ];
+                scalar_t sum[ W ];
+                for (int64_t l = 0; l < W; ++l)
+                    sum[ l ] = Aij[ l ];
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* Aik = &A[ (i + k*n)*W ];
+                    scalar_t const* Ajk = &A[ (j + k*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        sum[ l ] -= Aik[ l ] * conj( Ajk[ l ] );
+                }
+                for (int64_t l = 0; l < W; ++l)
+                    Aij[ l ] = okay[ l ] ? sum[ l ] * rcp[ l ] : Aij[ l ];
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite n-by-n matrices stored in interleaved layout,
+/// \[
+///     A_i = U_i^H U_i  \text{ or }  A_i = L_i L_i^H.
+/// \]
+/// Intended for large batches of tiny matrices (n up to about 16),
+/// where factoring one matrix at a time leaves SIMD lanes idle.
+/// The kernel vectorizes across interleaved_width matrices at once,
+/// and chunks are distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     Array of length interleaved_size( n, n, batch ),
+///     holding the batch in interleaved layout.
+///     On successful exit, the factors U_i or L_i.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is as returned by lapack::potrf
+///     for A_i.
+///
+/// @see lapack::pack_interleaved
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        int64_t info_c[ interleaved_width ];
+        internal::potrf_interleaved_chunk( uplo, n, &A[ c*n*n*W ], info_c );
+        int64_t lanes = std::min( W, int64_t( batch ) - int64_t( c )*W );
+        std::copy( info_c, info_c + lanes, &info[ c*W ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    float* A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    double* A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
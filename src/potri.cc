@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ int64_t potri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potri", 's', n, n, 0, Gflop< float >::potri( n ) );
     LAPACK_spotri(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -59,6 +62,7 @@ int64_t potri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potri", 'd', n, n, 0, Gflop< double >::potri( n ) );
     LAPACK_dpotri(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -88,6 +92,8 @@ int64_t potri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::potri( n ) );
     LAPACK_cpotri(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -146,6 +152,8 @@ int64_t potri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::potri( n ) );
     LAPACK_zpotri(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -35,6 +37,8 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrs", 's', n, n, nrhs,
+                        Gflop< float >::potrs( n, nrhs ) );
     LAPACK_spotrs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -70,6 +74,8 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrs", 'd', n, n, nrhs,
+                        Gflop< double >::potrs( n, nrhs ) );
     LAPACK_dpotrs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -105,6 +111,8 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::potrs( n, nrhs ) );
     LAPACK_cpotrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -176,6 +184,8 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "potrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::potrs( n, nrhs ) );
     LAPACK_zpotrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch_common.hh"
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Solves with the Cholesky factors of one chunk of W interleaved n-by-n
+// matrices. Loops over lanes l have the constant trip count W, so the
+// compiler vectorizes across matrices.
+template <typename scalar_t>
+void potrs_interleaved_chunk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, scalar_t* B )
+{
+    using blas::conj;
+    constexpr int64_t W = interleaved_width;
+
+    for (int64_t r = 0; r < nrhs; ++r) {
+        scalar_t* b = &B[ r*n*W ];
+        if (uplo == Uplo::Upper) {
+            // solve U^H y = b
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ j*W + l ] -= conj( Aij[ l ] ) * b[ i*W + l ];
+                }
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= conj( Ajj[ l ] );
+            }
+            // solve U x = y
+            for (int64_t j = n-1; j >= 0; --j) {
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= Ajj[ l ];
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ i*W + l ] -= Aij[ l ] * b[ j*W + l ];
+                }
+            }
+        }
+        else {
+            // solve L y = b
+            for (int64_t j = 0; j < n; ++j) {
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= Ajj[ l ];
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ i*W + l ] -= Aij[ l ] * b[ j*W + l ];
+                }
+            }
+            // solve L^H x = y
+            for (int64_t j = n-1; j >= 0; --j) {
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = &A[ (i + j*n)*W ];
+                    for (int64_t l = 0; l < W; ++l)
+                        b[ j*W + l ] -= conj( Aij[ l ] ) * b[ i*W + l ];
+                }
+                scalar_t const* Ajj = &A[ (j + j*n)*W ];
+                for (int64_t l = 0; l < W; ++l)
+                    b[ j*W + l ] /= conj( Ajj[ l ] );
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// with Hermitian positive definite A_i, using the Cholesky
+/// factorizations computed by lapack::potrf_interleaved.
+/// A_i and B_i are in interleaved layout.
+/// The kernel vectorizes across interleaved_width systems at once,
+/// and chunks are distributed over OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     Array of length interleaved_size( n, n, batch ).
+///     The factors U_i or L_i from lapack::potrf_interleaved.
+///
+/// @param[in,out] B
+///     Array of length interleaved_size( n, nrhs, batch ),
+///     holding the n-by-nrhs right hand sides B_i in interleaved layout.
+///     On exit, the solutions X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     Resized to length batch. info[i] is as returned by lapack::potrs
+///     for system i.
+///
+/// @see lapack::pack_interleaved
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A,
+    scalar_t* B,
+    size_t batch,
+    std::vector<int64_t>& info )
+{
+    info.assign( batch, 0 );
+    if (batch == 0)
+        return;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t W = interleaved_width;
+    const int64_t chunks = (int64_t( batch ) + W - 1) / W;
+
+    internal::batch_for( chunks, [&]( size_t c ) {
+        internal::potrs_interleaved_chunk(
+            uplo, n, nrhs, &A[ c*n*n*W ], &B[ c*n*nrhs*W ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A,
+    float* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A,
+    double* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A,
+    std::complex<float>* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+template
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A,
+    std::complex<double>* B,
+    size_t batch,
+    std::vector<int64_t>& info );
+
+}  // namespace lapack
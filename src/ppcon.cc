@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -34,6 +35,8 @@ int64_t ppcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ppcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sppcon(
         &uplo_, &n_,
         AP, &anorm, rcond,
@@ -68,6 +71,8 @@ int64_t ppcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ppcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dppcon(
         &uplo_, &n_,
         AP, &anorm, rcond,
@@ -102,6 +107,8 @@ int64_t ppcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "ppcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cppcon(
         &uplo_, &n_,
         (lapack_complex_float*) AP, &anorm, rcond,
@@ -173,6 +180,8 @@ int64_t ppcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "ppcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zppcon(
         &uplo_, &n_,
         (lapack_complex_double*) AP, &anorm, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -31,6 +32,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppequ", 's', n, n, 0, 0 );
     LAPACK_sppequ(
         &uplo_, &n_,
         AP,
@@ -62,6 +64,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppequ", 'd', n, n, 0, 0 );
     LAPACK_dppequ(
         &uplo_, &n_,
         AP,
@@ -93,6 +96,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppequ", 'c', n, n, 0, 0 );
     LAPACK_cppequ(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -168,6 +172,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppequ", 'z', n, n, 0, 0 );
     LAPACK_zppequ(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
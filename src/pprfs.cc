@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +45,8 @@ int64_t pprfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pprfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_spprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -93,6 +96,8 @@ int64_t pprfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "pprfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dpprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -142,6 +147,8 @@ int64_t pprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "pprfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cpprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -259,6 +266,8 @@ int64_t pprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "pprfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zpprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +35,8 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppsv", 's', n, n, nrhs,
+                        Gflop< float >::posv( n, nrhs ) );
     LAPACK_sppsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -66,6 +70,8 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppsv", 'd', n, n, nrhs,
+                        Gflop< double >::posv( n, nrhs ) );
     LAPACK_dppsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -99,6 +105,8 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::posv( n, nrhs ) );
     LAPACK_cppsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -205,6 +213,8 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ppsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::posv( n, nrhs ) );
     LAPACK_zppsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
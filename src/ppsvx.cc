@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -49,6 +50,8 @@ int64_t ppsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ppsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -106,6 +109,8 @@ int64_t ppsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "ppsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -163,6 +168,8 @@ int64_t ppsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "ppsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -397,6 +404,8 @@ int64_t ppsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "ppsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
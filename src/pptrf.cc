@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +30,7 @@ int64_t pptrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrf", 's', n, n, 0, Gflop< float >::potrf( n ) );
     LAPACK_spptrf(
         &uplo_, &n_,
         AP, &info_
@@ -55,6 +58,7 @@ int64_t pptrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrf", 'd', n, n, 0, Gflop< double >::potrf( n ) );
     LAPACK_dpptrf(
         &uplo_, &n_,
         AP, &info_
@@ -82,6 +86,8 @@ int64_t pptrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrf", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::potrf( n ) );
     LAPACK_cpptrf(
         &uplo_, &n_,
         (lapack_complex_float*) AP, &info_
@@ -163,6 +169,8 @@ int64_t pptrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrf", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::potrf( n ) );
     LAPACK_zpptrf(
         &uplo_, &n_,
         (lapack_complex_double*) AP, &info_
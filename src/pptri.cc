@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +30,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptri", 's', n, n, 0, Gflop< float >::potri( n ) );
     LAPACK_spptri(
         &uplo_, &n_,
         AP, &info_
@@ -55,6 +58,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptri", 'd', n, n, 0, Gflop< double >::potri( n ) );
     LAPACK_dpptri(
         &uplo_, &n_,
         AP, &info_
@@ -82,6 +86,8 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::potri( n ) );
     LAPACK_cpptri(
         &uplo_, &n_,
         (lapack_complex_float*) AP, &info_
@@ -139,6 +145,8 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::potri( n ) );
     LAPACK_zpptri(
         &uplo_, &n_,
         (lapack_complex_double*) AP, &info_
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +35,8 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrs", 's', n, n, nrhs,
+                        Gflop< float >::potrs( n, nrhs ) );
     LAPACK_spptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -66,6 +70,8 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrs", 'd', n, n, nrhs,
+                        Gflop< double >::potrs( n, nrhs ) );
     LAPACK_dpptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -99,6 +105,8 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::potrs( n, nrhs ) );
     LAPACK_cpptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -169,6 +177,8 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pptrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::potrs( n, nrhs ) );
     LAPACK_zpptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
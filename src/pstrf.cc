@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -43,6 +44,8 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "pstrf", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_spstrf(
         &uplo_, &n_,
         A, &lda_,
@@ -90,6 +93,8 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "pstrf", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dpstrf(
         &uplo_, &n_,
         A, &lda_,
@@ -137,6 +142,8 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "pstrf", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cpstrf(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -184,6 +191,8 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "pstrf", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zpstrf(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
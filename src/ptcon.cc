@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -33,6 +34,8 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "ptcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sptcon(
         &n_,
         D,
@@ -62,6 +65,8 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "ptcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dptcon(
         &n_,
         D,
@@ -91,6 +96,8 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "ptcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_cptcon(
         &n_,
         D,
@@ -164,6 +171,8 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "ptcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( rwork );
     LAPACK_zptcon(
         &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    lapack_trace_block( "pteqr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_spteqr(
         &compz_, &n_,
         D,
@@ -71,6 +74,8 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    lapack_trace_block( "pteqr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dpteqr(
         &compz_, &n_,
         D,
@@ -107,6 +112,8 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    lapack_trace_block( "pteqr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cpteqr(
         &compz_, &n_,
         D,
@@ -143,6 +150,8 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    lapack_trace_block( "pteqr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zpteqr(
         &compz_, &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +45,8 @@ int64_t ptrfs(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "ptrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work );
     LAPACK_sptrfs(
         &n_, &nrhs_,
         D,
@@ -90,6 +93,8 @@ int64_t ptrfs(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "ptrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work );
     LAPACK_dptrfs(
         &n_, &nrhs_,
         D,
@@ -138,6 +143,8 @@ int64_t ptrfs(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "ptrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cptrfs(
         &uplo_, &n_, &nrhs_,
         D,
@@ -267,6 +274,8 @@ int64_t ptrfs(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "ptrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zptrfs(
         &uplo_, &n_, &nrhs_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ptsv", 's', n, n, nrhs, 0 );
     LAPACK_sptsv(
         &n_, &nrhs_,
         D,
@@ -63,6 +65,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ptsv", 'd', n, n, nrhs, 0 );
     LAPACK_dptsv(
         &n_, &nrhs_,
         D,
@@ -93,6 +96,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ptsv", 'c', n, n, nrhs, 0 );
     LAPACK_cptsv(
         &n_, &nrhs_,
         D,
@@ -168,6 +172,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "ptsv", 'z', n, n, nrhs, 0 );
     LAPACK_zptsv(
         &n_, &nrhs_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -46,6 +47,8 @@ int64_t ptsvx(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "ptsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work );
     LAPACK_sptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -98,6 +101,8 @@ int64_t ptsvx(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "ptsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work );
     LAPACK_dptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -151,6 +156,8 @@ int64_t ptsvx(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "ptsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -308,6 +315,8 @@ int64_t ptsvx(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "ptsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zptsvx(
         &fact_, &n_, &nrhs_,
         D,
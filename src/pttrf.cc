@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrf", 's', n, n, 0, 0 );
     LAPACK_spttrf(
         &n_,
         D,
@@ -52,6 +54,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrf", 'd', n, n, 0, 0 );
     LAPACK_dpttrf(
         &n_,
         D,
@@ -76,6 +79,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrf", 'c', n, n, 0, 0 );
     LAPACK_cpttrf(
         &n_,
         D,
@@ -130,6 +134,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrf", 'z', n, n, 0, 0 );
     LAPACK_zpttrf(
         &n_,
         D,
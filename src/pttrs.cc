@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ int64_t pttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrs", 's', n, n, nrhs, 0 );
     LAPACK_spttrs(
         &n_, &nrhs_,
         D,
@@ -63,6 +65,7 @@ int64_t pttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrs", 'd', n, n, nrhs, 0 );
     LAPACK_dpttrs(
         &n_, &nrhs_,
         D,
@@ -94,6 +97,7 @@ int64_t pttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrs", 'c', n, n, nrhs, 0 );
     LAPACK_cpttrs(
         &uplo_, &n_, &nrhs_,
         D,
@@ -179,6 +183,7 @@ int64_t pttrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "pttrs", 'z', n, n, nrhs, 0 );
     LAPACK_zpttrs(
         &uplo_, &n_, &nrhs_,
         D,
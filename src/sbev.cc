@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +42,9 @@ int64_t sbev(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "sbev", 's', n, n, kd,
+                        Gflop< float >::hbev( jobz, n, kd ) );
+    lapack_trace_work( work );
     LAPACK_ssbev(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -81,6 +86,9 @@ int64_t sbev(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 3*n-2 )) );
 
+    lapack_trace_block( "sbev", 'd', n, n, kd,
+                        Gflop< double >::hbev( jobz, n, kd ) );
+    lapack_trace_work( work );
     LAPACK_dsbev(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
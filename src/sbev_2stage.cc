@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t sbev_2stage(
+/// @see lapack::sbev_2stage_work_query
+lapack::WorkSizes sbev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* W,
@@ -57,9 +60,38 @@ int64_t sbev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::sbev_2stage_work
+int64_t sbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbev_2stage", 's', n, n, kd,
+                        Gflop< float >::hbev( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_ssbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -78,6 +110,36 @@ int64_t sbev_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = sbev_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return sbev_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sbev_2stage_work. Takes the same arguments as
+/// lapack::sbev_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes sbev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* W,
@@ -116,9 +178,47 @@ int64_t sbev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::sbev_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sbev_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sbev_2stage_work_query.
+int64_t sbev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbev_2stage", 'd', n, n, kd,
+                        Gflop< double >::hbev( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dsbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -135,6 +235,31 @@ int64_t sbev_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = sbev_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return sbev_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +64,9 @@ int64_t sbevd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sbevd", 's', n, n, kd,
+                        Gflop< float >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( work, iwork );
     LAPACK_ssbevd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -126,6 +131,9 @@ int64_t sbevd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sbevd", 'd', n, n, kd,
+                        Gflop< double >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( work, iwork );
     LAPACK_dsbevd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
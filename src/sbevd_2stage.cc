@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t sbevd_2stage(
+/// @see lapack::sbevd_2stage_work_query
+lapack::WorkSizes sbevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* W,
@@ -60,10 +63,41 @@ int64_t sbevd_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::sbevd_2stage_work
+int64_t sbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbevd_2stage", 's', n, n, kd,
+                        Gflop< float >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -83,6 +117,38 @@ int64_t sbevd_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = sbevd_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return sbevd_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sbevd_2stage_work. Takes the same arguments as
+/// lapack::sbevd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes sbevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* W,
@@ -124,10 +190,57 @@ int64_t sbevd_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::sbevd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sbevd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sbevd_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::sbevd_2stage_work_query.
+int64_t sbevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbevd_2stage", 'd', n, n, kd,
+                        Gflop< double >::hbevd( jobz, n, kd ) );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -145,6 +258,33 @@ int64_t sbevd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    // query for workspace size
+    WorkSizes sizes = sbevd_2stage_work_query(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return sbevd_2stage_work(
+        jobz, uplo, n, kd,
+        AB, ldab,
+        W,
+        Z, ldz,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
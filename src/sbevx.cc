@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -59,6 +61,8 @@ int64_t sbevx(
     lapack::vector< float > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sbevx", 's', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -76,6 +80,7 @@ int64_t sbevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< float >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -128,6 +133,8 @@ int64_t sbevx(
     lapack::vector< double > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sbevx", 'd', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -145,6 +152,7 @@ int64_t sbevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< double >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +20,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
+/// @see lapack::sbevx_2stage_work_query
+lapack::WorkSizes sbevx_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
@@ -48,13 +51,7 @@ int64_t sbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = (lapack_int*) ifail;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -79,10 +76,63 @@ int64_t sbevx_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    int64_t liwork = 5*n;
+    #ifndef LAPACK_ILP64
+        liwork += n;  // 32-bit copy of ifail
+    #endif
+    return { lwork_, 0, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::sbevx_2stage_work
+int64_t sbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < n );
+        liwork -= n;
+        lapack_int* ifail_ = &iwork[ liwork ];
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_error_if( liwork < 5*n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbevx_2stage", 's', n, n, kd, 0 );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -100,6 +150,7 @@ int64_t sbevx_2stage(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< float >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -110,6 +161,47 @@ int64_t sbevx_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    WorkSizes sizes = sbevx_2stage_work_query(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return sbevx_2stage_work(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sbevx_2stage_work. Takes the same arguments as
+/// lapack::sbevx_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes sbevx_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
@@ -139,13 +231,7 @@ int64_t sbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = (lapack_int*) ifail;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -170,10 +256,82 @@ int64_t sbevx_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    int64_t liwork = 5*n;
+    #ifndef LAPACK_ILP64
+        liwork += n;  // 32-bit copy of ifail
+    #endif
+    return { lwork_, 0, liwork };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::sbevx_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sbevx_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sbevx_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::sbevx_2stage_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last n elements
+///     hold a 32-bit copy of ifail, so liwork must be the query value,
+///     not LAPACK's documented minimum.
+int64_t sbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < n );
+        liwork -= n;
+        lapack_int* ifail_ = &iwork[ liwork ];
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_error_if( liwork < 5*n );
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "sbevx_2stage", 'd', n, n, kd, 0 );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -191,6 +349,7 @@ int64_t sbevx_2stage(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< double >::hbevx( jobz, n, kd, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -199,6 +358,42 @@ int64_t sbevx_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    WorkSizes sizes = sbevx_2stage_work_query(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return sbevx_2stage_work(
+        jobz, range, uplo, n, kd,
+        AB, ldab,
+        Q, ldq, vl, vu, il, iu, abstol,
+        m,
+        W,
+        Z, ldz,
+        ifail,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +45,8 @@ int64_t sbgst(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "sbgst", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ssbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -89,6 +92,8 @@ int64_t sbgst(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "sbgst", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dsbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
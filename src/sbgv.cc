@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -45,6 +46,8 @@ int64_t sbgv(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    lapack_trace_block( "sbgv", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ssbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -92,6 +95,8 @@ int64_t sbgv(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    lapack_trace_block( "sbgv", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dsbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -71,6 +72,8 @@ int64_t sbgvd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sbgvd", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -145,6 +148,8 @@ int64_t sbgvd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sbgvd", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
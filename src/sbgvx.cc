@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -64,6 +65,8 @@ int64_t sbgvx(
     lapack::vector< float > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sbgvx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -139,6 +142,8 @@ int64_t sbgvx(
     lapack::vector< double > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sbgvx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +42,8 @@ int64_t sbtrd(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "sbtrd", 's', n, n, kd, 0 );
+    lapack_trace_work( work );
     LAPACK_ssbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -84,6 +87,8 @@ int64_t sbtrd(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "sbtrd", 'd', n, n, kd, 0 );
+    lapack_trace_work( work );
     LAPACK_dsbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -33,6 +34,7 @@ void sfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    lapack_trace_block( "sfrk", 's', n, n, k, 0 );
     LAPACK_ssfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         A, &lda_, &beta,
@@ -62,6 +64,7 @@ void sfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    lapack_trace_block( "sfrk", 'd', n, n, k, 0 );
     LAPACK_dsfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         A, &lda_, &beta,
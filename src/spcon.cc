@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +42,8 @@ int64_t spcon(
     lapack::vector< float > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "spcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sspcon(
         &uplo_, &n_,
         AP,
@@ -83,6 +86,8 @@ int64_t spcon(
     lapack::vector< double > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "spcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dspcon(
         &uplo_, &n_,
         AP,
@@ -124,6 +129,8 @@ int64_t spcon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "spcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cspcon(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -164,6 +171,8 @@ int64_t spcon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "spcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zspcon(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,8 @@ int64_t spev(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    lapack_trace_block( "spev", 's', n, n, 0, Gflop< float >::hpev( jobz, n ) );
+    lapack_trace_work( work );
     LAPACK_sspev(
         &jobz_, &uplo_, &n_,
         AP,
@@ -73,6 +77,9 @@ int64_t spev(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    lapack_trace_block( "spev", 'd', n, n, 0,
+                        Gflop< double >::hpev( jobz, n ) );
+    lapack_trace_work( work );
     LAPACK_dspev(
         &jobz_, &uplo_, &n_,
         AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -58,6 +60,9 @@ int64_t spevd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "spevd", 's', n, n, 0,
+                        Gflop< float >::hpevd( jobz, n ) );
+    lapack_trace_work( work, iwork );
     LAPACK_sspevd(
         &jobz_, &uplo_, &n_,
         AP,
@@ -118,6 +123,9 @@ int64_t spevd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "spevd", 'd', n, n, 0,
+                        Gflop< double >::hpevd( jobz, n ) );
+    lapack_trace_work( work, iwork );
     LAPACK_dspevd(
         &jobz_, &uplo_, &n_,
         AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -52,6 +54,8 @@ int64_t spevx(
     lapack::vector< float > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "spevx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sspevx(
         &jobz_, &range_, &uplo_, &n_,
         AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -68,6 +72,7 @@ int64_t spevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< float >::hpevx( jobz, n, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -113,6 +118,8 @@ int64_t spevx(
     lapack::vector< double > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "spevx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dspevx(
         &jobz_, &range_, &uplo_, &n_,
         AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -129,6 +136,7 @@ int64_t spevx(
         throw Error();
     }
     *m = m_;
+    lapack_trace_gflop( Gflop< double >::hpevx( jobz, n, m_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +31,7 @@ int64_t spgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spgst", 's', n, n, 0, 0 );
     LAPACK_sspgst(
         &itype_, &uplo_, &n_,
         AP,
@@ -60,6 +62,7 @@ int64_t spgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spgst", 'd', n, n, 0, 0 );
     LAPACK_dspgst(
         &itype_, &uplo_, &n_,
         AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,8 @@ int64_t spgv(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    lapack_trace_block( "spgv", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sspgv(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
@@ -80,6 +83,8 @@ int64_t spgv(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    lapack_trace_block( "spgv", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dspgv(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
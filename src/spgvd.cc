@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +63,8 @@ int64_t spgvd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "spgvd", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sspgvd(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
@@ -127,6 +130,8 @@ int64_t spgvd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "spgvd", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dspgvd(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
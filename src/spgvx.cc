@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -55,6 +56,8 @@ int64_t spgvx(
     lapack::vector< float > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "spgvx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sspgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         AP,
@@ -120,6 +123,8 @@ int64_t spgvx(
     lapack::vector< double > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "spgvx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dspgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         AP,
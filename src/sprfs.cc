@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +52,8 @@ int64_t sprfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sprfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -108,6 +111,8 @@ int64_t sprfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sprfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -165,6 +170,8 @@ int64_t sprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "sprfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_csprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -222,6 +229,8 @@ int64_t sprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "sprfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zsprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +43,8 @@ int64_t spsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spsv", 's', n, n, nrhs,
+                        Gflop< float >::sysv( n, nrhs ) );
     LAPACK_sspsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -85,6 +89,8 @@ int64_t spsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spsv", 'd', n, n, nrhs,
+                        Gflop< double >::sysv( n, nrhs ) );
     LAPACK_dspsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -129,6 +135,8 @@ int64_t spsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spsv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sysv( n, nrhs ) );
     LAPACK_cspsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -173,6 +181,8 @@ int64_t spsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "spsv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sysv( n, nrhs ) );
     LAPACK_zspsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -53,6 +54,8 @@ int64_t spsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "spsvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sspsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -115,6 +118,8 @@ int64_t spsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "spsvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dspsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -177,6 +182,8 @@ int64_t spsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "spsvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_cspsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -239,6 +246,8 @@ int64_t spsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "spsvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zspsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ int64_t sptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrd", 's', n, n, 0, Gflop< float >::sytrd( n ) );
     LAPACK_ssptrd(
         &uplo_, &n_,
         AP,
@@ -62,6 +65,7 @@ int64_t sptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrd", 'd', n, n, 0, Gflop< double >::sytrd( n ) );
     LAPACK_dsptrd(
         &uplo_, &n_,
         AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -36,6 +38,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrf", 's', n, n, 0, Gflop< float >::sytrf( n ) );
     LAPACK_ssptrf(
         &uplo_, &n_,
         AP,
@@ -74,6 +77,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrf", 'd', n, n, 0, Gflop< double >::sytrf( n ) );
     LAPACK_dsptrf(
         &uplo_, &n_,
         AP,
@@ -112,6 +116,8 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrf", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::sytrf( n ) );
     LAPACK_csptrf(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -150,6 +156,8 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrf", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::sytrf( n ) );
     LAPACK_zsptrf(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +41,8 @@ int64_t sptri(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "sptri", 's', n, n, 0, Gflop< float >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_ssptri(
         &uplo_, &n_,
         AP,
@@ -78,6 +82,8 @@ int64_t sptri(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "sptri", 'd', n, n, 0, Gflop< double >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_dsptri(
         &uplo_, &n_,
         AP,
@@ -117,6 +123,9 @@ int64_t sptri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    lapack_trace_block( "sptri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_csptri(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -156,6 +165,9 @@ int64_t sptri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    lapack_trace_block( "sptri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_zsptri(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -41,6 +43,8 @@ int64_t sptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrs", 's', n, n, nrhs,
+                        Gflop< float >::sytrs( n, nrhs ) );
     LAPACK_ssptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -82,6 +86,8 @@ int64_t sptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrs", 'd', n, n, nrhs,
+                        Gflop< double >::sytrs( n, nrhs ) );
     LAPACK_dsptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -123,6 +129,8 @@ int64_t sptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrs", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sytrs( n, nrhs ) );
     LAPACK_csptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -164,6 +172,8 @@ int64_t sptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sptrs", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sytrs( n, nrhs ) );
     LAPACK_zsptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -57,6 +58,8 @@ int64_t stedc(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stedc", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstedc(
         &compz_, &n_,
         D,
@@ -116,6 +119,8 @@ int64_t stedc(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stedc", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstedc(
         &compz_, &n_,
         D,
@@ -179,6 +184,8 @@ int64_t stedc(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stedc", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_cstedc(
         &compz_, &n_,
         D,
@@ -243,6 +250,8 @@ int64_t stedc(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stedc", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork, iwork );
     LAPACK_zstedc(
         &compz_, &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -75,6 +76,8 @@ int64_t stegr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stegr", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstegr(
         &jobz_, &range_, &n_,
         D,
@@ -158,6 +161,8 @@ int64_t stegr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stegr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstegr(
         &jobz_, &range_, &n_,
         D,
@@ -241,6 +246,8 @@ int64_t stegr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stegr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_cstegr(
         &jobz_, &range_, &n_,
         D,
@@ -324,6 +331,8 @@ int64_t stegr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stegr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_zstegr(
         &jobz_, &range_, &n_,
         D,
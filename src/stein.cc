@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +63,8 @@ int64_t stein(
     lapack::vector< float > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "stein", 's', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstein(
         &n_,
         D,
@@ -129,6 +132,8 @@ int64_t stein(
     lapack::vector< double > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "stein", 'd', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstein(
         &n_,
         D,
@@ -196,6 +201,8 @@ int64_t stein(
     lapack::vector< float > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "stein", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_cstein(
         &n_,
         D,
@@ -263,6 +270,8 @@ int64_t stein(
     lapack::vector< double > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "stein", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_zstein(
         &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -79,6 +80,8 @@ int64_t stemr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stemr", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstemr(
         &jobz_, &range_, &n_,
         D,
@@ -167,6 +170,8 @@ int64_t stemr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stemr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstemr(
         &jobz_, &range_, &n_,
         D,
@@ -255,6 +260,8 @@ int64_t stemr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stemr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_cstemr(
         &jobz_, &range_, &n_,
         D,
@@ -343,6 +350,8 @@ int64_t stemr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stemr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_zstemr(
         &jobz_, &range_, &n_,
         D,
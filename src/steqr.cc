@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "steqr", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ssteqr(
         &compz_, &n_,
         D,
@@ -71,6 +74,8 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "steqr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dsteqr(
         &compz_, &n_,
         D,
@@ -107,6 +112,8 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "steqr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_csteqr(
         &compz_, &n_,
         D,
@@ -143,6 +150,8 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "steqr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zsteqr(
         &compz_, &n_,
         D,
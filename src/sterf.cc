@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -27,6 +28,7 @@ int64_t sterf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sterf", 's', n, n, 0, 0 );
     LAPACK_ssterf(
         &n_,
         D,
@@ -50,6 +52,7 @@ int64_t sterf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sterf", 'd', n, n, 0, 0 );
     LAPACK_dsterf(
         &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t stev(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "stev", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_sstev(
         &jobz_, &n_,
         D,
@@ -71,6 +74,8 @@ int64_t stev(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    lapack_trace_block( "stev", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dstev(
         &jobz_, &n_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -57,6 +58,8 @@ int64_t stevd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stevd", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstevd(
         &jobz_, &n_,
         D,
@@ -116,6 +119,8 @@ int64_t stevd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stevd", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstevd(
         &jobz_, &n_,
         D,
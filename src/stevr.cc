@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -75,6 +76,8 @@ int64_t stevr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stevr", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstevr(
         &jobz_, &range_, &n_,
         D,
@@ -158,6 +161,8 @@ int64_t stevr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "stevr", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstevr(
         &jobz_, &range_, &n_,
         D,
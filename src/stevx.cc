@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -52,6 +53,8 @@ int64_t stevx(
     lapack::vector< float > work( (5*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "stevx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_sstevx(
         &jobz_, &range_, &n_,
         D,
@@ -114,6 +117,8 @@ int64_t stevx(
     lapack::vector< double > work( (5*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "stevx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dstevx(
         &jobz_, &range_, &n_,
         D,
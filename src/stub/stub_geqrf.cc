@@ -7,14 +7,18 @@
 
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
+#include "lapack.hh"
 #include "lapack/device.hh"
 
 //==============================================================================
 namespace lapack {
 
+using blas::max;
+
 //------------------------------------------------------------------------------
 // Wrapper around workspace query.
 // dA is only for templating scalar_t; it isn't referenced.
+// The host geqrf keeps its own workspace on the worker thread.
 template <typename scalar_t>
 void geqrf_work_size_bytes(
     int64_t m, int64_t n,
@@ -27,8 +31,9 @@ void geqrf_work_size_bytes(
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Without a GPU library: runs lapack::geqrf synchronously in the calling
+// thread, on "device" memory in host memory. Nothing is enqueued on queue;
+// once this returns, the return info is in dev_info.
 template <typename scalar_t>
 void geqrf(
     int64_t m, int64_t n,
@@ -37,7 +42,13 @@ void geqrf(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < max( 1, m ) );
+
+    // Reused by all geqrf calls in this thread.
+    static thread_local lapack::Workspace workspace;
+    *dev_info = lapack::geqrf( m, n, dA, ldda, dtau, workspace );
 }
 
 //------------------------------------------------------------------------------
@@ -7,21 +7,29 @@
 
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
+#include "lapack.hh"
 #include "lapack/device.hh"
 
 //==============================================================================
 namespace lapack {
 
+using blas::max;
+
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Without a GPU library: runs lapack::potrf synchronously in the calling
+// thread, on "device" memory in host memory. Nothing is enqueued on queue;
+// once this returns, the return info is in dev_info.
 template <typename scalar_t>
 void potrf(
     lapack::Uplo uplo, int64_t n,
     scalar_t* dA, int64_t ldda,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < max( 1, n ) );
+
+    *dev_info = lapack::potrf( uplo, n, dA, ldda );
 }
 
 //------------------------------------------------------------------------------
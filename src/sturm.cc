@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "batch_common.hh"
 
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace lapack {
@@ -160,4 +163,341 @@ template
 int64_t sturm<double>(
     int64_t n, double const* diag, double const* offd, double u );
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Number of shifts evaluated together by sturm_chunk.
+constexpr int64_t sturm_width = 16;
+
+//------------------------------------------------------------------------------
+// Scaled Sturm counts for sturm_width shifts u[0:W-1] at once, using the
+// same recurrence and scaling as sturm above, so counts match it.
+// offd2[i] = offd[i]^2, computed once for all shifts.
+// Loops over lanes l have the constant trip count W, and the scaling
+// branches are written as selects, so the compiler vectorizes across shifts.
+template <typename scalar_t>
+void sturm_chunk(
+    int64_t n, scalar_t const* diag, scalar_t const* offd2,
+    scalar_t const* u, int64_t* count )
+{
+    constexpr int64_t W = sturm_width;
+    const scalar_t one = 1.0;
+    const scalar_t phi = scalar_t( int64_t( 1 ) << 34 );
+    const scalar_t upsilon = one/phi;
+
+    scalar_t Pm1_0[ W ], Pm1_1[ W ];
+    int64_t isneg[ W ];
+
+    for (int64_t l = 0; l < W; ++l) {
+        Pm1_1[ l ] = one;
+        Pm1_0[ l ] = diag[ 0 ] - u[ l ];
+        isneg[ l ] = (Pm1_0[ l ] < 0);
+    }
+    for (int64_t i = 1; i < n; ++i) {
+        scalar_t d  = diag[ i ];
+        scalar_t e2 = offd2[ i-1 ];
+        for (int64_t l = 0; l < W; ++l) {
+            scalar_t v0 = std::abs( Pm1_0[ l ] );
+            scalar_t v1 = std::abs( Pm1_1[ l ] );
+            scalar_t w = (v0 > v1 ? v0 : v1);
+
+            scalar_t p0 = (d - u[ l ])*Pm1_0[ l ] - e2*Pm1_1[ l ];
+            scalar_t p1 = Pm1_0[ l ];
+
+            // Both ratios are computed so the selects have no branches.
+            // Scaling by one is exact, so this matches sturm's branches.
+            scalar_t s_big   = phi/w;
+            scalar_t s_small = upsilon/w;
+            scalar_t s = (w > phi ? s_big : one);
+            s = (w < upsilon ? s_small : s);
+            p0 *= s;
+            p1 *= s;
+
+            // Non-short-circuit & and | avoid branches, too.
+            isneg[ l ] += ((p0 < 0) & (p1 >= 0)) | ((p0 >= 0) & (p1 < 0));
+            Pm1_0[ l ] = p0;
+            Pm1_1[ l ] = p1;
+        }
+    }
+    for (int64_t l = 0; l < W; ++l)
+        count[ l ] = isneg[ l ];
+}
+
+//------------------------------------------------------------------------------
+// Sturm counts for nshifts shifts, in chunks of sturm_width spread over
+// OpenMP threads. The last chunk is padded by repeating its last shift.
+template <typename scalar_t>
+void sturm_shifts(
+    int64_t n, scalar_t const* diag, scalar_t const* offd2,
+    int64_t nshifts, scalar_t const* u, int64_t* count )
+{
+    const int64_t W = sturm_width;
+    const int64_t chunks = (nshifts + W - 1) / W;
+
+    batch_for( chunks, [&]( size_t c ) {
+        int64_t begin = c*W;
+        int64_t lanes = std::min( W, nshifts - begin );
+        scalar_t u_c[ sturm_width ];
+        int64_t count_c[ sturm_width ];
+        for (int64_t l = 0; l < W; ++l)
+            u_c[ l ] = u[ begin + std::min( l, lanes-1 ) ];
+        sturm_chunk( n, diag, offd2, u_c, count_c );
+        std::copy( count_c, count_c + lanes, &count[ begin ] );
+    });
+}
+
+//------------------------------------------------------------------------------
+// @return vector of squared off-diagonals, offd[i]^2.
+template <typename scalar_t>
+std::vector<scalar_t> sturm_offd2( int64_t n, scalar_t const* offd )
+{
+    std::vector<scalar_t> offd2( std::max( int64_t( 0 ), n-1 ) );
+    for (int64_t i = 0; i < n-1; ++i)
+        offd2[ i ] = offd[ i ]*offd[ i ];
+    return offd2;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes scaled Sturm counts for many shifts at once,
+/// count[k] = number of eigenvalues of the symmetric tridiagonal matrix
+/// T strictly less than u[k].
+/// Counts are the same as calling lapack::sturm for each shift, but
+/// shifts are evaluated sturm_width at a time with SIMD, and groups of
+/// shifts are spread over OpenMP threads.
+/// Only single and double precision code exist.
+///
+/// @param[in] n
+///     The order of the matrix T. n >= 0.
+///
+/// @param[in] diag
+///     The n diagonal elements of T.
+///
+/// @param[in] offd
+///     The n-1 off-diagonal elements of T.
+///
+/// @param[in] nshifts
+///     The number of shifts. nshifts >= 0.
+///
+/// @param[in] u
+///     The nshifts shifts, in any order.
+///
+/// @param[out] count
+///     Array of length nshifts. count[k] is the number of eigenvalues
+///     strictly less than u[k].
+///
+/// @see lapack::sturm_slice
+/// @see lapack::sturm_bisect
+/// @ingroup heev_computational
+template <typename scalar_t>
+void sturm(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t nshifts, scalar_t const* u, int64_t* count )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nshifts < 0 );
+
+    if (n == 0) {
+        std::fill( count, count + nshifts, 0 );
+        return;
+    }
+    std::vector<scalar_t> offd2 = internal::sturm_offd2( n, offd );
+    internal::sturm_shifts( n, diag, offd2.data(), nshifts, u, count );
+}
+
+//------------------------------------------------------------------------------
+/// Counts eigenvalues of the symmetric tridiagonal matrix T in each of
+/// nslices equal slices of the interval [vl, vu).
+/// Slice k is [s_k, s_{k+1}), with s_k = vl + k (vu - vl) / nslices,
+/// and s_{nslices} = vu exactly. The nslices + 1 Sturm counts are
+/// evaluated together, as in the multi-shift lapack::sturm.
+/// Useful to partition a spectrum before computing eigenvalues or
+/// eigenvectors of each part in parallel.
+/// Only single and double precision code exist.
+///
+/// @param[in] n
+///     The order of the matrix T. n >= 0.
+///
+/// @param[in] diag
+///     The n diagonal elements of T.
+///
+/// @param[in] offd
+///     The n-1 off-diagonal elements of T.
+///
+/// @param[in] vl
+///     Lower bound of the interval.
+///
+/// @param[in] vu
+///     Upper bound of the interval. vl < vu.
+///
+/// @param[in] nslices
+///     The number of slices. nslices >= 1.
+///
+/// @param[out] count
+///     Array of length nslices. count[k] is the number of eigenvalues
+///     in slice k.
+///
+/// @ingroup heev_computational
+template <typename scalar_t>
+void sturm_slice(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    scalar_t vl, scalar_t vu, int64_t nslices, int64_t* count )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( ! (vl < vu) );
+    lapack_error_if( nslices < 1 );
+
+    std::vector<scalar_t> shifts( nslices + 1 );
+    std::vector<int64_t> below( nslices + 1 );
+    scalar_t h = (vu - vl) / nslices;
+    for (int64_t k = 0; k < nslices; ++k)
+        shifts[ k ] = vl + k*h;
+    shifts[ nslices ] = vu;
+
+    sturm( n, diag, offd, nslices + 1, shifts.data(), below.data() );
+
+    for (int64_t k = 0; k < nslices; ++k)
+        count[ k ] = below[ k+1 ] - below[ k ];
+}
+
+//------------------------------------------------------------------------------
+/// Computes eigenvalues il through iu of the symmetric tridiagonal matrix
+/// T by bisection on scaled Sturm counts. All eigenvalues are bisected
+/// together: each step evaluates the midpoints of every unconverged
+/// interval with the multi-shift lapack::sturm, which vectorizes across
+/// shifts and threads.
+/// Only single and double precision code exist.
+///
+/// @param[in] n
+///     The order of the matrix T. n >= 0.
+///
+/// @param[in] diag
+///     The n diagonal elements of T.
+///
+/// @param[in] offd
+///     The n-1 off-diagonal elements of T.
+///
+/// @param[in] il
+///     1-based index of the smallest eigenvalue to compute. il >= 1.
+///
+/// @param[in] iu
+///     1-based index of the largest eigenvalue to compute. iu <= n.
+///     If iu < il, no eigenvalues are computed.
+///
+/// @param[in] abstol
+///     Absolute tolerance. Bisection of an eigenvalue stops once its
+///     interval is no wider than max( abstol, 2 eps max( |lower|, |upper| ) ).
+///     Use abstol <= 0 for full relative accuracy.
+///
+/// @param[out] W
+///     Array of length iu - il + 1. The eigenvalues il through iu,
+///     in ascending order.
+///
+/// @ingroup heev_computational
+template <typename scalar_t>
+void sturm_bisect(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t il, int64_t iu, scalar_t abstol, scalar_t* W )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( il < 1 );
+    lapack_error_if( iu > n );
+
+    if (il > iu)
+        return;
+
+    const scalar_t eps = std::numeric_limits<scalar_t>::epsilon();
+    const scalar_t sfmin = std::numeric_limits<scalar_t>::min();
+    const scalar_t two = 2.0;
+
+    // Gershgorin bounds, padded so count( gl ) = 0 and count( gu ) = n.
+    scalar_t gl = diag[ 0 ], gu = diag[ 0 ];
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t r = (i > 0   ? std::abs( offd[ i-1 ] ) : 0)
+                   + (i < n-1 ? std::abs( offd[ i ]   ) : 0);
+        gl = std::min( gl, diag[ i ] - r );
+        gu = std::max( gu, diag[ i ] + r );
+    }
+    scalar_t pad = two*eps*n*std::max( std::abs( gl ), std::abs( gu ) ) + sfmin;
+    gl -= pad;
+    gu += pad;
+
+    // Eigenvalue j = il + k is in [lower[ k ], upper[ k ]), i.e.,
+    // count( lower[ k ] ) < j <= count( upper[ k ] ).
+    int64_t m = iu - il + 1;
+    std::vector<scalar_t> lower( m, gl ), upper( m, gu );
+    std::vector<scalar_t> mid( m );
+    std::vector<int64_t> count( m );
+    std::vector<int64_t> active( m );
+    for (int64_t k = 0; k < m; ++k)
+        active[ k ] = k;
+
+    std::vector<scalar_t> offd2 = internal::sturm_offd2( n, offd );
+
+    int64_t nactive = m;
+    while (nactive > 0) {
+        for (int64_t a = 0; a < nactive; ++a) {
+            int64_t k = active[ a ];
+            mid[ a ] = (lower[ k ] + upper[ k ]) / two;
+        }
+        internal::sturm_shifts( n, diag, offd2.data(), nactive,
+                                mid.data(), count.data() );
+
+        // Update intervals, then compact the list of active ones.
+        int64_t next = 0;
+        for (int64_t a = 0; a < nactive; ++a) {
+            int64_t k = active[ a ];
+            scalar_t lo = lower[ k ], hi = upper[ k ], mi = mid[ a ];
+            if (count[ a ] >= il + k)
+                upper[ k ] = mi;
+            else
+                lower[ k ] = mi;
+
+            scalar_t tol = std::max( abstol,
+                two*eps*std::max( std::abs( lower[ k ] ), std::abs( upper[ k ] ) ) );
+            bool done = (upper[ k ] - lower[ k ] <= tol)
+                        || mi == lo || mi == hi;  // no representable midpoint
+            if (! done)
+                active[ next++ ] = k;
+        }
+        nactive = next;
+    }
+
+    for (int64_t k = 0; k < m; ++k)
+        W[ k ] = (lower[ k ] + upper[ k ]) / two;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sturm<float>(
+    int64_t n, float const* diag, float const* offd,
+    int64_t nshifts, float const* u, int64_t* count );
+
+template
+void sturm<double>(
+    int64_t n, double const* diag, double const* offd,
+    int64_t nshifts, double const* u, int64_t* count );
+
+template
+void sturm_slice<float>(
+    int64_t n, float const* diag, float const* offd,
+    float vl, float vu, int64_t nslices, int64_t* count );
+
+template
+void sturm_slice<double>(
+    int64_t n, double const* diag, double const* offd,
+    double vl, double vu, int64_t nslices, int64_t* count );
+
+template
+void sturm_bisect<float>(
+    int64_t n, float const* diag, float const* offd,
+    int64_t il, int64_t iu, float abstol, float* W );
+
+template
+void sturm_bisect<double>(
+    int64_t n, double const* diag, double const* offd,
+    int64_t il, int64_t iu, double abstol, double* W );
+
 } // namespace lapack
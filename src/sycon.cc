@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +45,8 @@ int64_t sycon(
     lapack::vector< float > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sycon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssycon(
         &uplo_, &n_,
         A, &lda_,
@@ -89,6 +92,8 @@ int64_t sycon(
     lapack::vector< double > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sycon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsycon(
         &uplo_, &n_,
         A, &lda_,
@@ -133,6 +138,8 @@ int64_t sycon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "sycon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_csycon(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -220,6 +227,8 @@ int64_t sycon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "sycon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zsycon(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -47,6 +48,8 @@ int64_t sycon_rk(
     lapack::vector< float > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sycon_rk", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssycon_3(
         &uplo_, &n_,
         A, &lda_,
@@ -94,6 +97,8 @@ int64_t sycon_rk(
     lapack::vector< double > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sycon_rk", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsycon_3(
         &uplo_, &n_,
         A, &lda_,
@@ -140,6 +145,8 @@ int64_t sycon_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "sycon_rk", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_csycon_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -262,6 +269,8 @@ int64_t sycon_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "sycon_rk", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zsycon_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
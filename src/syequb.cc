@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -37,6 +38,8 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "syequb", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ssyequb(
         &uplo_, &n_,
         A, &lda_,
@@ -74,6 +77,8 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "syequb", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dsyequb(
         &uplo_, &n_,
         A, &lda_,
@@ -111,6 +116,8 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "syequb", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_csyequb(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -193,6 +200,8 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "syequb", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zsyequb(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
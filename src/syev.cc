@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -53,6 +55,8 @@ int64_t syev(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "syev", 's', n, n, 0, Gflop< float >::syev( jobz, n ) );
+    lapack_trace_work( work );
     LAPACK_ssyev(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -107,6 +111,9 @@ int64_t syev(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "syev", 'd', n, n, 0,
+                        Gflop< double >::syev( jobz, n ) );
+    lapack_trace_work( work );
     LAPACK_dsyev(
         &jobz_, &uplo_, &n_,
         A, &lda_,
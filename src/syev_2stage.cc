@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::syev_2stage_work_query
 /// @ingroup heev
-int64_t syev_2stage(
+lapack::WorkSizes syev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* W )
@@ -52,9 +55,34 @@ int64_t syev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::syev_2stage_work
+/// @ingroup heev
+int64_t syev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "syev_2stage", 's', n, n, 0,
+                        Gflop< float >::syev_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_ssyev_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -71,9 +99,37 @@ int64_t syev_2stage(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heev_2stage
 /// @ingroup heev
 int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = syev_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return syev_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::syev_2stage_work. Takes the same arguments as
+/// lapack::syev_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes syev_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* W )
@@ -106,9 +162,44 @@ int64_t syev_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::syev_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::syev_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::syev_2stage_work_query.
+///
+/// @ingroup heev
+int64_t syev_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "syev_2stage", 'd', n, n, 0,
+                        Gflop< double >::syev_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dsyev_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -124,6 +215,30 @@ int64_t syev_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heev_2stage
+/// @ingroup heev
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = syev_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return syev_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
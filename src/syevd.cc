@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -21,6 +24,21 @@ int64_t syevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* W )
+{
+    lapack::Workspace workspace;
+    return syevd(
+        jobz, uplo, n,
+        A, lda,
+        W, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::syevd_work_query
+/// @ingroup heev
+lapack::WorkSizes syevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,30 +51,69 @@ int64_t syevd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssyevd(
-        &jobz_, &uplo_, &n_,
-        A, &lda_,
-        W,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, liwork_;
+    internal::WorkSizeKey key(
+        "ssyevd", { jobz_, uplo_ }, { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssyevd(
+            &jobz_, &uplo_, &n_,
+            A, &lda_,
+            W,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, liwork_ } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::syevd_work
+/// @ingroup heev
+int64_t syevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "syevd", 's', n, n, 0,
+                        Gflop< float >::syevd( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssyevd(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -73,6 +130,34 @@ int64_t syevd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::syevd
+/// @ingroup heev
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = syevd_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return syevd_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @see lapack::heevd
 /// @ingroup heev
@@ -80,6 +165,26 @@ int64_t syevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* W )
+{
+    lapack::Workspace workspace;
+    return syevd(
+        jobz, uplo, n,
+        A, lda,
+        W, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::syevd_work. Takes the same arguments as
+/// lapack::syevd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes syevd_work_query(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -92,30 +197,86 @@ int64_t syevd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsyevd(
-        &jobz_, &uplo_, &n_,
-        A, &lda_,
-        W,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    lapack_int lwork_, liwork_;
+    internal::WorkSizeKey key(
+        "dsyevd", { jobz_, uplo_ }, { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsyevd(
+            &jobz_, &uplo_, &n_,
+            A, &lda_,
+            W,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, liwork_ } );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::syevd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::syevd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::syevd_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::syevd_work_query.
+///
+/// @ingroup heev
+int64_t syevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "syevd", 'd', n, n, 0,
+                        Gflop< double >::syevd( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsyevd(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -132,4 +293,32 @@ int64_t syevd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd
+/// @ingroup heev
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = syevd_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return syevd_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 }  // namespace lapack
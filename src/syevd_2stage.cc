@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::syevd_2stage_work_query
 /// @ingroup heev
-int64_t syevd_2stage(
+lapack::WorkSizes syevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* W )
@@ -55,10 +58,37 @@ int64_t syevd_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// @see lapack::syevd_2stage_work
+/// @ingroup heev
+int64_t syevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "syevd_2stage", 's', n, n, 0,
+                        Gflop< float >::syevd_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssyevd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -76,9 +106,39 @@ int64_t syevd_2stage(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heevd_2stage
 /// @ingroup heev
 int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = syevd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return syevd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::syevd_2stage_work. Takes the same arguments as
+/// lapack::syevd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes syevd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* W )
@@ -114,10 +174,54 @@ int64_t syevd_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    return { lwork_, 0, liwork_ };
+}
 
+// -----------------------------------------------------------------------------
+/// Same as lapack::syevd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::syevd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::syevd_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::syevd_2stage_work_query.
+///
+/// @ingroup heev
+int64_t syevd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    lapack_trace_block( "syevd_2stage", 'd', n, n, 0,
+                        Gflop< double >::syevd_2stage( jobz, n ) );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsyevd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -134,6 +238,32 @@ int64_t syevd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_2stage
+/// @ingroup heev
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = syevd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        W );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return syevd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        W,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,7 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
+#include "work_size_cache.hh"
 
 #include <vector>
 
@@ -24,6 +27,27 @@ int64_t syevr(
     float* W,
     float* Z, int64_t ldz,
     int64_t* isuppz )
+{
+    lapack::Workspace workspace;
+    return syevr(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::syevr_work_query
+/// @ingroup heev
+lapack::WorkSizes syevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,41 +66,97 @@ int64_t syevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    lapack_int lwork_, liwork_;
+    internal::WorkSizeKey key(
+        "ssyevr", { jobz_, range_, uplo_ }, { n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssyevr(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, liwork_ } );
+    }
+
+    int64_t liwork = liwork_;
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, 0, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::syevr_work
+/// @ingroup heev
+int64_t syevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_;  // output
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // m <= n
         lapack_int* isuppz_ptr = &isuppz_[0];
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssyevr(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
+    lapack_trace_block( "syevr", 's', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssyevr(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -93,12 +173,50 @@ int64_t syevr(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< float >::syevr( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::syevr
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = syevr_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    workspace.reset();
+    float* work = workspace.take< float >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return syevr_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 // -----------------------------------------------------------------------------
 /// @see lapack::heevr
 /// @ingroup heev
@@ -109,6 +227,126 @@ int64_t syevr(
     double* W,
     double* Z, int64_t ldz,
     int64_t* isuppz )
+{
+    lapack::Workspace workspace;
+    return syevr(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz, workspace );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::syevr_work. Takes the same arguments as
+/// lapack::syevr; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes syevr_work_query(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_;  // output
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    lapack_int lwork_, liwork_;
+    internal::WorkSizeKey key(
+        "dsyevr", { jobz_, range_, uplo_ }, { n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (internal::work_size_cache_find( key, &sizes )) {
+        lwork_  = sizes.lwork;
+        liwork_ = sizes.liwork;
+    }
+    else {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsyevr(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1, 1, 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = real(qry_work[0]);
+        liwork_ = real(qry_iwork[0]);
+        internal::work_size_cache_insert(
+            key, { lwork_, 0, liwork_ } );
+    }
+
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, 0, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::syevr, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::syevr.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::syevr_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::syevr_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last 2 max( 1, n )
+///     elements hold a 32-bit copy of isuppz, so liwork must be the
+///     query value, not LAPACK's documented minimum.
+///
+/// @ingroup heev
+int64_t syevr_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -117,6 +355,8 @@ int64_t syevr(
         lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
     }
     char jobz_ = job2char( jobz );
     char range_ = range2char( range );
@@ -128,40 +368,20 @@ int64_t syevr(
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // m <= n
         lapack_int* isuppz_ptr = &isuppz_[0];
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsyevr(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
+    lapack_trace_block( "syevr", 'd', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsyevr(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -178,10 +398,48 @@ int64_t syevr(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< double >::syevr( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    lapack::Workspace& workspace )
+{
+    // query for workspace size, unless cached
+    WorkSizes sizes = syevr_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    workspace.reset();
+    double* work = workspace.take< double >( sizes.lwork );
+    lapack_int* iwork = workspace.take< lapack_int >( sizes.liwork );
+
+    return syevr_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work, sizes.lwork,
+        iwork, sizes.liwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::syevr_2stage_work_query
 /// @ingroup heev
-int64_t syevr_2stage(
+lapack::WorkSizes syevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
@@ -44,13 +47,7 @@ int64_t syevr_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -75,10 +72,60 @@ int64_t syevr_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, 0, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::syevr_2stage_work
+/// @ingroup heev
+int64_t syevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_;  // output
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // m <= n
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "syevr_2stage", 's', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(float), liwork*sizeof(lapack_int) );
     LAPACK_ssyevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -95,16 +142,56 @@ int64_t syevr_2stage(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< float >::syevr_2stage( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heevr_2stage
 /// @ingroup heev
 int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    WorkSizes sizes = syevr_2stage_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return syevr_2stage_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::syevr_2stage_work. Takes the same arguments as
+/// lapack::syevr_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev
+lapack::WorkSizes syevr_2stage_work_query(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
@@ -129,13 +216,7 @@ int64_t syevr_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = (lapack_int*) isuppz;  // not referenced by the query
     lapack_int info_ = 0;
 
     // query for workspace size
@@ -160,10 +241,80 @@ int64_t syevr_2stage(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    int64_t liwork = liwork_;
+    #ifndef LAPACK_ILP64
+        liwork += 2*max( 1, n );  // 32-bit copy of isuppz
+    #endif
+    return { lwork_, 0, liwork };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::syevr_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::syevr_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::syevr_2stage_work_query.
+///
+/// @param[out] iwork
+///     Workspace array of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork; at least sizes.liwork from
+///     lapack::syevr_2stage_work_query.
+///     In LP64 builds, where lapack_int is 32-bit, the last 2 max( 1, n )
+///     elements hold a 32-bit copy of isuppz, so liwork must be the
+///     query value, not LAPACK's documented minimum.
+///
+/// @ingroup heev
+int64_t syevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_;  // output
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy, at end of iwork
+        lapack_error_if( liwork < 2*max( 1, n ) );
+        liwork -= 2*max( 1, n );
+        lapack_int* isuppz_ = &iwork[ liwork ];  // m <= n
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "syevr_2stage", 'd', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(double), liwork*sizeof(lapack_int) );
     LAPACK_dsyevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -180,12 +331,48 @@ int64_t syevr_2stage(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< double >::syevr_2stage( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + 2*max( 1, n ), isuppz );
     #endif
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr_2stage
+/// @ingroup heev
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    WorkSizes sizes = syevr_2stage_work_query(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+    lapack::vector< lapack_int > iwork( sizes.liwork );
+
+    return syevr_2stage_work(
+        jobz, range, uplo, n,
+        A, lda, vl, vu, il, iu, abstol,
+        nfound,
+        W,
+        Z, ldz,
+        isuppz,
+        work.data(), sizes.lwork,
+        iwork.data(), sizes.liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
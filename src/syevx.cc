@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -76,6 +78,8 @@ int64_t syevx(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "syevx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssyevx(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -92,6 +96,7 @@ int64_t syevx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< float >::syevx( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
@@ -162,6 +167,8 @@ int64_t syevx(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "syevx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsyevx(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
@@ -178,6 +185,7 @@ int64_t syevx(
         throw Error();
     }
     *nfound = nfound_;
+    lapack_trace_gflop( Gflop< double >::syevx( jobz, n, nfound_ ) );
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
             std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
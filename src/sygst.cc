@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -34,6 +35,7 @@ int64_t sygst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sygst", 's', n, n, 0, 0 );
     LAPACK_ssygst(
         &itype_, &uplo_, &n_,
         A, &lda_,
@@ -68,6 +70,7 @@ int64_t sygst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "sygst", 'd', n, n, 0, 0 );
     LAPACK_dsygst(
         &itype_, &uplo_, &n_,
         A, &lda_,
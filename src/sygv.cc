@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -58,6 +59,8 @@ int64_t sygv(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sygv", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ssygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -117,6 +120,8 @@ int64_t sygv(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sygv", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dsygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -18,7 +19,8 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t sygv_2stage(
+/// @see lapack::sygv_2stage_work_query
+lapack::WorkSizes sygv_2stage_work_query(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
@@ -57,9 +59,37 @@ int64_t sygv_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::sygv_2stage_work
+int64_t sygv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int itype_ = (lapack_int) itype;
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sygv_2stage", 's', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_ssygv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -78,6 +108,36 @@ int64_t sygv_2stage(
 
 // -----------------------------------------------------------------------------
 int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
+{
+    // query for workspace size
+    WorkSizes sizes = sygv_2stage_work_query(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return sygv_2stage_work(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sygv_2stage_work. Takes the same arguments as
+/// lapack::sygv_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+lapack::WorkSizes sygv_2stage_work_query(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
@@ -116,9 +176,46 @@ int64_t sygv_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::sygv_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sygv_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sygv_2stage_work_query.
+int64_t sygv_2stage_work(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int itype_ = (lapack_int) itype;
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sygv_2stage", 'd', n, n, 0, 0 );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dsygv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -135,6 +232,31 @@ int64_t sygv_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    // query for workspace size
+    WorkSizes sizes = sygv_2stage_work_query(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return sygv_2stage_work(
+        itype, jobz, uplo, n,
+        A, lda,
+        B, ldb,
+        W,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
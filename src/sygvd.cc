@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +63,8 @@ int64_t sygvd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sygvd", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssygvd(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -126,6 +129,8 @@ int64_t sygvd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "sygvd", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsygvd(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -81,6 +82,8 @@ int64_t sygvx(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sygvx", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssygvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         A, &lda_,
@@ -172,6 +175,8 @@ int64_t sygvx(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    lapack_trace_block( "sygvx", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsygvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         A, &lda_,
@@ -7,6 +7,7 @@
 // -----------------------------------------------------------------------------
 
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "lapack.hh"
 
 #include <limits>
@@ -57,6 +58,7 @@ void symv(
     }
 
     char uplo_ = uplo2char( uplo );
+    lapack_trace_block( "symv", 'c', n, n, 0, 0 );
     LAPACK_csymv( &uplo_, &n_,
                 (lapack_complex_float*) &alpha,
                 (lapack_complex_float*) A, &lda_,
@@ -110,6 +112,7 @@ void symv(
     }
 
     char uplo_ = uplo2char( uplo );
+    lapack_trace_block( "symv", 'z', n, n, 0, 0 );
     LAPACK_zsymv( &uplo_, &n_,
                 (lapack_complex_double*) &alpha,
                 (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 // while [cz]syr are in LAPACK, [sd]syr are in BLAS,
 // so we put them all in the blas namespace
@@ -50,6 +51,7 @@ void syr(
     }
 
     char uplo_ = uplo2char( uplo );
+    lapack_trace_block( "syr", 'c', n, n, 0, 0 );
     LAPACK_csyr( &uplo_, &n_,
                  (lapack_complex_float*) &alpha,
                  (lapack_complex_float*) x, &incx_,
@@ -96,6 +98,7 @@ void syr(
     }
 
     char uplo_ = uplo2char( uplo );
+    lapack_trace_block( "syr", 'z', n, n, 0, 0 );
     LAPACK_zsyr( &uplo_, &n_,
                  (lapack_complex_double*) &alpha,
                  (lapack_complex_double*) x, &incx_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
@@ -67,6 +68,8 @@ int64_t syrfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "syrfsx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssyrfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -141,6 +144,8 @@ int64_t syrfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "syrfsx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsyrfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -215,6 +220,8 @@ int64_t syrfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    lapack_trace_block( "syrfsx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_csyrfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -561,6 +568,8 @@ int64_t syrfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    lapack_trace_block( "syrfsx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zsyrfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -65,6 +67,9 @@ int64_t sysv(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sysv", 's', n, n, nrhs,
+                        Gflop< float >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_ssysv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -134,6 +139,9 @@ int64_t sysv(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sysv", 'd', n, n, nrhs,
+                        Gflop< double >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dsysv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -203,6 +211,9 @@ int64_t sysv(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sysv", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_csysv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -351,6 +362,9 @@ int64_t sysv(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sysv", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zsysv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
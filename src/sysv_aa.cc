@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -99,6 +101,9 @@ int64_t sysv_aa(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sysv_aa", 's', n, n, nrhs,
+                        Gflop< float >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_ssysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -201,6 +206,9 @@ int64_t sysv_aa(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sysv_aa", 'd', n, n, nrhs,
+                        Gflop< double >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dsysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -302,6 +310,9 @@ int64_t sysv_aa(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sysv_aa", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_csysv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -472,6 +483,9 @@ int64_t sysv_aa(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sysv_aa", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zsysv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
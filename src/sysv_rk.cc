@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -69,6 +71,9 @@ int64_t sysv_rk(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sysv_rk", 's', n, n, nrhs,
+                        Gflop< float >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_ssysv_rk(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -141,6 +146,9 @@ int64_t sysv_rk(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sysv_rk", 'd', n, n, nrhs,
+                        Gflop< double >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dsysv_rk(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -213,6 +221,9 @@ int64_t sysv_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sysv_rk", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_csysv_rk(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -398,6 +409,9 @@ int64_t sysv_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sysv_rk", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zsysv_rk(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30500  // >= 3.5
@@ -67,6 +69,9 @@ int64_t sysv_rook(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sysv_rook", 's', n, n, nrhs,
+                        Gflop< float >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_ssysv_rook(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -136,6 +141,9 @@ int64_t sysv_rook(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sysv_rook", 'd', n, n, nrhs,
+                        Gflop< double >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dsysv_rook(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -205,6 +213,9 @@ int64_t sysv_rook(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sysv_rook", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_csysv_rook(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -276,6 +287,9 @@ int64_t sysv_rook(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sysv_rook", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sysv( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zsysv_rook(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -82,6 +83,8 @@ int64_t sysvx(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sysvx", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ssysvx(
         &fact_, &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -173,6 +176,8 @@ int64_t sysvx(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "sysvx", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dsysvx(
         &fact_, &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -264,6 +269,8 @@ int64_t sysvx(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "sysvx", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_csysvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -490,6 +497,8 @@ int64_t sysvx(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "sysvx", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_zsysvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
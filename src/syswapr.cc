@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
 
@@ -35,6 +36,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "syswapr", 's', n, n, 0, 0 );
     LAPACK_ssyswapr(
         &uplo_, &n_,
         A, &lda_, &i1_, &i2_
@@ -63,6 +65,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "syswapr", 'd', n, n, 0, 0 );
     LAPACK_dsyswapr(
         &uplo_, &n_,
         A, &lda_, &i1_, &i2_
@@ -91,6 +94,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "syswapr", 'c', n, n, 0, 0 );
     LAPACK_csyswapr(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &i1_, &i2_
@@ -149,6 +153,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    lapack_trace_block( "syswapr", 'z', n, n, 0, 0 );
     LAPACK_zsyswapr(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &i1_, &i2_
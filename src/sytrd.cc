@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -16,8 +18,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::sytrd_work_query
 /// @ingroup heev_computational
-int64_t sytrd(
+lapack::WorkSizes sytrd_work_query(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* D,
@@ -53,9 +56,34 @@ int64_t sytrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::sytrd_work
+/// @ingroup heev_computational
+int64_t sytrd_work(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sytrd", 's', n, n, 0, Gflop< float >::sytrd( n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_ssytrd(
         &uplo_, &n_,
         A, &lda_,
@@ -74,9 +102,43 @@ int64_t sytrd(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd
 /// @ingroup heev_computational
 int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = sytrd_work_query(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return sytrd_work(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sytrd_work. Takes the same arguments as
+/// lapack::sytrd; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev_computational
+lapack::WorkSizes sytrd_work_query(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* D,
@@ -112,9 +174,44 @@ int64_t sytrd(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::sytrd, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sytrd.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sytrd_work_query.
+///
+/// @ingroup heev_computational
+int64_t sytrd_work(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sytrd", 'd', n, n, 0, Gflop< double >::sytrd( n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dsytrd(
         &uplo_, &n_,
         A, &lda_,
@@ -132,4 +229,34 @@ int64_t sytrd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd
+/// @ingroup heev_computational
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau )
+{
+    // query for workspace size
+    WorkSizes sizes = sytrd_work_query(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return sytrd_work(
+        uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= v3.7
@@ -18,8 +20,9 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
+/// @see lapack::sytrd_2stage_work_query
 /// @ingroup heev_computational
-int64_t sytrd_2stage(
+lapack::WorkSizes sytrd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* D,
@@ -60,9 +63,39 @@ int64_t sytrd_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::sytrd_2stage_work
+/// @ingroup heev_computational
+int64_t sytrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sytrd_2stage", 's', n, n, 0,
+                        Gflop< float >::sytrd( n ) );
+    lapack_trace_work( lwork*sizeof(float) );
     LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -82,9 +115,46 @@ int64_t sytrd_2stage(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd_2stage
 /// @ingroup heev_computational
 int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 )
+{
+    // query for workspace size
+    WorkSizes sizes = sytrd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2 );
+
+    // allocate workspace
+    lapack::vector< float > work( sizes.lwork );
+
+    return sytrd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2,
+        work.data(), sizes.lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sytrd_2stage_work. Takes the same arguments as
+/// lapack::sytrd_2stage; arrays are not referenced, except that
+/// LAPACK may check their leading dimensions.
+///
+/// @return sizes of the work arrays, in elements; see lapack::WorkSizes.
+///
+/// @ingroup heev_computational
+lapack::WorkSizes sytrd_2stage_work_query(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* D,
@@ -125,9 +195,49 @@ int64_t sytrd_2stage(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    return { lwork_, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+/// Same as lapack::sytrd_2stage, but with work arrays provided by the caller,
+/// so it doesn't allocate memory. Other arguments are as in
+/// lapack::sytrd_2stage.
+///
+/// @param[out] work
+///     Workspace array of length lwork.
+///
+/// @param[in] lwork
+///     The length of work; at least sizes.lwork from
+///     lapack::sytrd_2stage_work_query.
+///
+/// @ingroup heev_computational
+int64_t sytrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    lapack_trace_block( "sytrd_2stage", 'd', n, n, 0,
+                        Gflop< double >::sytrd( n ) );
+    lapack_trace_work( lwork*sizeof(double) );
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -146,6 +256,39 @@ int64_t sytrd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
+{
+    // query for workspace size
+    WorkSizes sizes = sytrd_2stage_work_query(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2 );
+
+    // allocate workspace
+    lapack::vector< double > work( sizes.lwork );
+
+    return sytrd_2stage_work(
+        jobz, uplo, n,
+        A, lda,
+        D,
+        E,
+        tau,
+        hous2, lhous2,
+        work.data(), sizes.lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.7
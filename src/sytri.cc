@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -42,6 +44,8 @@ int64_t sytri(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "sytri", 's', n, n, 0, Gflop< float >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_ssytri(
         &uplo_, &n_,
         A, &lda_,
@@ -84,6 +88,8 @@ int64_t sytri(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "sytri", 'd', n, n, 0, Gflop< double >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_dsytri(
         &uplo_, &n_,
         A, &lda_,
@@ -126,6 +132,9 @@ int64_t sytri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "sytri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_csytri(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -213,6 +222,9 @@ int64_t sytri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "sytri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_zsytri(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
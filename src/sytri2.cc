@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
@@ -61,6 +63,8 @@ int64_t sytri2(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sytri2", 's', n, n, 0, Gflop< float >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_ssytri2(
         &uplo_, &n_,
         A, &lda_,
@@ -120,6 +124,8 @@ int64_t sytri2(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sytri2", 'd', n, n, 0, Gflop< double >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_dsytri2(
         &uplo_, &n_,
         A, &lda_,
@@ -178,6 +184,9 @@ int64_t sytri2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sytri2", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_csytri2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -283,6 +292,9 @@ int64_t sytri2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sytri2", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_zsytri2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
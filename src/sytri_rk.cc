@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -63,6 +65,8 @@ int64_t sytri_rk(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "sytri_rk", 's', n, n, 0, Gflop< float >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_ssytri_3(
         &uplo_, &n_,
         A, &lda_,
@@ -125,6 +129,8 @@ int64_t sytri_rk(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "sytri_rk", 'd', n, n, 0, Gflop< double >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_dsytri_3(
         &uplo_, &n_,
         A, &lda_,
@@ -187,6 +193,9 @@ int64_t sytri_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "sytri_rk", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_csytri_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -335,6 +344,9 @@ int64_t sytri_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "sytri_rk", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::sytri( n ) );
+    lapack_trace_work( work );
     LAPACK_zsytri_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -50,6 +52,61 @@ int64_t sytrs_aa(
     // allocate workspace
     lapack::vector< float > work( (max(1,lwork_)) );
 
+    lapack_trace_block( "sytrs_aa", 's', n, n, nrhs,
+                        Gflop< float >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
+    LAPACK_ssytrs_aa(
+        &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_,
+        &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int32_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) max( 1, 3*n-2 );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (max(1,lwork_)) );
+
+    lapack_trace_block( "sytrs_aa", 's', n, n, nrhs,
+                        Gflop< float >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_ssytrs_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -99,6 +156,61 @@ int64_t sytrs_aa(
     // allocate workspace
     lapack::vector< double > work( (max(1,lwork_)) );
 
+    lapack_trace_block( "sytrs_aa", 'd', n, n, nrhs,
+                        Gflop< double >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
+    LAPACK_dsytrs_aa(
+        &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv_ptr,
+        B, &ldb_,
+        &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int32_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) max( 1, 3*n-2 );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (max(1,lwork_)) );
+
+    lapack_trace_block( "sytrs_aa", 'd', n, n, nrhs,
+                        Gflop< double >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_dsytrs_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -148,6 +260,61 @@ int64_t sytrs_aa(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (max(1,lwork_)) );
 
+    lapack_trace_block( "sytrs_aa", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
+    LAPACK_csytrs_aa(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) max( 1, 3*n-2 );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (max(1,lwork_)) );
+
+    lapack_trace_block( "sytrs_aa", 'c', n, n, nrhs,
+                        Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_csytrs_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -240,6 +407,64 @@ int64_t sytrs_aa(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (max(1,lwork_)) );
 
+    lapack_trace_block( "sytrs_aa", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
+    LAPACK_zsytrs_aa(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) &work[0], &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Overload with 32-bit pivot indices. In LP64 builds, ipiv is passed
+/// directly to LAPACK, without allocating and copying a temporary.
+/// @see lapack::sytrs_aa
+/// @ingroup sysv_aa_computational
+int64_t sytrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int32_t const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifdef LAPACK_ILP64
+        // 64-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) max( 1, 3*n-2 );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (max(1,lwork_)) );
+
+    lapack_trace_block( "sytrs_aa", 'z', n, n, nrhs,
+                        Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+    lapack_trace_work( work );
     LAPACK_zsytrs_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -39,6 +40,8 @@ int64_t tbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tbcon", 's', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_stbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         AB, &ldab_, rcond,
@@ -78,6 +81,8 @@ int64_t tbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tbcon", 'd', n, n, kd, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         AB, &ldab_, rcond,
@@ -117,6 +122,8 @@ int64_t tbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "tbcon", 'c', n, n, kd, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, rcond,
@@ -156,6 +163,8 @@ int64_t tbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "tbcon", 'z', n, n, kd, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +49,8 @@ int64_t tbrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tbrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_stbrfs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -100,6 +103,8 @@ int64_t tbrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tbrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtbrfs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -152,6 +157,8 @@ int64_t tbrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "tbrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctbrfs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -204,6 +211,8 @@ int64_t tbrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "tbrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztbrfs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
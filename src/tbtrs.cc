@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -38,6 +39,7 @@ int64_t tbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tbtrs", 's', n, n, nrhs, 0 );
     LAPACK_stbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -76,6 +78,7 @@ int64_t tbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tbtrs", 'd', n, n, nrhs, 0 );
     LAPACK_dtbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -114,6 +117,7 @@ int64_t tbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tbtrs", 'c', n, n, nrhs, 0 );
     LAPACK_ctbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -152,6 +156,7 @@ int64_t tbtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tbtrs", 'z', n, n, nrhs, 0 );
     LAPACK_ztbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
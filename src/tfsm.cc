@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -35,6 +36,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    lapack_trace_block( "tfsm", 's', m, n, 0, 0 );
     LAPACK_stfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_, &alpha,
         A,
@@ -66,6 +68,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    lapack_trace_block( "tfsm", 'd', m, n, 0, 0 );
     LAPACK_dtfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_, &alpha,
         A,
@@ -97,6 +100,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    lapack_trace_block( "tfsm", 'c', m, n, 0, 0 );
     LAPACK_ctfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_,
         (lapack_complex_float*) &alpha,
@@ -129,6 +133,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    lapack_trace_block( "tfsm", 'z', m, n, 0, 0 );
     LAPACK_ztfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_,
         (lapack_complex_double*) &alpha,
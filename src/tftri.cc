@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -29,6 +30,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tftri", 's', n, n, 0, 0 );
     LAPACK_stftri(
         &transr_, &uplo_, &diag_, &n_,
         A, &info_
@@ -57,6 +59,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tftri", 'd', n, n, 0, 0 );
     LAPACK_dtftri(
         &transr_, &uplo_, &diag_, &n_,
         A, &info_
@@ -85,6 +88,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tftri", 'c', n, n, 0, 0 );
     LAPACK_ctftri(
         &transr_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &info_
@@ -113,6 +117,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tftri", 'z', n, n, 0, 0 );
     LAPACK_ztftri(
         &transr_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &info_
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -29,6 +30,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttp", 's', n, n, 0, 0 );
     LAPACK_stfttp(
         &transr_, &uplo_, &n_,
         ARF,
@@ -58,6 +60,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttp", 'd', n, n, 0, 0 );
     LAPACK_dtfttp(
         &transr_, &uplo_, &n_,
         ARF,
@@ -87,6 +90,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttp", 'c', n, n, 0, 0 );
     LAPACK_ctfttp(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) ARF,
@@ -116,6 +120,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttp", 'z', n, n, 0, 0 );
     LAPACK_ztfttp(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) ARF,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -31,6 +32,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttr", 's', n, n, 0, 0 );
     LAPACK_stfttr(
         &transr_, &uplo_, &n_,
         ARF,
@@ -62,6 +64,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttr", 'd', n, n, 0, 0 );
     LAPACK_dtfttr(
         &transr_, &uplo_, &n_,
         ARF,
@@ -93,6 +96,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttr", 'c', n, n, 0, 0 );
     LAPACK_ctfttr(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) ARF,
@@ -124,6 +128,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tfttr", 'z', n, n, 0, 0 );
     LAPACK_ztfttr(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) ARF,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -136,6 +137,8 @@ int64_t tgexc(
     lapack_int ilst_ = (lapack_int) *ilst;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tgexc", trace::internal::precision< scalar_t >(),
+                        n, n, 0, 0 );
     if constexpr (! is_complex<scalar_t>::value) {
         // Real needs workspace.
         // query for workspace size
@@ -152,6 +155,7 @@ int64_t tgexc(
 
         // allocate workspace
         std::vector< scalar_t > work( lwork_ );
+        lapack_trace_work( work );
 
         // call low-level wrapper
         internal::tgexc(
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -211,6 +212,9 @@ int64_t tgsen(
     std::vector< lapack_int > iwork( liwork_ );
 
     // call low-level wrapper
+    lapack_trace_block( "tgsen", trace::internal::precision< scalar_t >(),
+                        n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     if constexpr (! is_complex<scalar_t>::value) {
         // For real, use split-complex alpha.
         internal::tgsen(
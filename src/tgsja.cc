@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -59,6 +60,8 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    lapack_trace_block( "tgsja", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_stgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         A, &lda_,
@@ -124,6 +127,8 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    lapack_trace_block( "tgsja", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dtgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         A, &lda_,
@@ -189,6 +194,8 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    lapack_trace_block( "tgsja", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ctgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -254,6 +261,8 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    lapack_trace_block( "tgsja", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ztgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
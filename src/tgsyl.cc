@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -78,6 +79,8 @@ int64_t tgsyl(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m+n+6) );
 
+    lapack_trace_block( "tgsyl", 's', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_stgsyl(
         &trans_, &ijob_, &m_, &n_,
         A, &lda_,
@@ -161,6 +164,8 @@ int64_t tgsyl(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m+n+6) );
 
+    lapack_trace_block( "tgsyl", 'd', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtgsyl(
         &trans_, &ijob_, &m_, &n_,
         A, &lda_,
@@ -244,6 +249,8 @@ int64_t tgsyl(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m+n+2) );
 
+    lapack_trace_block( "tgsyl", 'c', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ctgsyl(
         &trans_, &ijob_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -327,6 +334,8 @@ int64_t tgsyl(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< lapack_int > iwork( (m+n+2) );
 
+    lapack_trace_block( "tgsyl", 'z', m, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t tpcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tpcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_stpcon(
         &norm_, &uplo_, &diag_, &n_,
         AP, rcond,
@@ -70,6 +73,8 @@ int64_t tpcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tpcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtpcon(
         &norm_, &uplo_, &diag_, &n_,
         AP, rcond,
@@ -105,6 +110,8 @@ int64_t tpcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "tpcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctpcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP, rcond,
@@ -140,6 +147,8 @@ int64_t tpcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "tpcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztpcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
@@ -47,6 +48,8 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< float > work( (mb*m) );
 
+    lapack_trace_block( "tplqt", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_stplqt(
         &m_, &n_, &l_, &mb_,
         A, &lda_,
@@ -89,6 +92,8 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< double > work( (mb*m) );
 
+    lapack_trace_block( "tplqt", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtplqt(
         &m_, &n_, &l_, &mb_,
         A, &lda_,
@@ -131,6 +136,8 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (mb*m) );
 
+    lapack_trace_block( "tplqt", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ctplqt(
         &m_, &n_, &l_, &mb_,
         (lapack_complex_float*) A, &lda_,
@@ -269,6 +276,8 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (mb*m) );
 
+    lapack_trace_block( "tplqt", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ztplqt(
         &m_, &n_, &l_, &mb_,
         (lapack_complex_double*) A, &lda_,
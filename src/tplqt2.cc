@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -41,6 +42,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tplqt2", 's', m, n, 0, 0 );
     LAPACK_stplqt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -77,6 +79,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tplqt2", 'd', m, n, 0, 0 );
     LAPACK_dtplqt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -113,6 +116,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tplqt2", 'c', m, n, 0, 0 );
     LAPACK_ctplqt2(
         &m_, &n_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -238,6 +242,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tplqt2", 'z', m, n, 0, 0 );
     LAPACK_ztplqt2(
         &m_, &n_, &l_,
         (lapack_complex_double*) A, &lda_,
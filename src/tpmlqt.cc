@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
@@ -59,6 +60,8 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "tpmlqt", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_stpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         V, &ldv_,
@@ -118,6 +121,8 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "tpmlqt", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dtpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         V, &ldv_,
@@ -173,6 +178,8 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< std::complex<float> > work( lwork );
 
+    lapack_trace_block( "tpmlqt", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ctpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         (lapack_complex_float*) V, &ldv_,
@@ -343,6 +350,8 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< std::complex<double> > work( lwork );
 
+    lapack_trace_block( "tpmlqt", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ztpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         (lapack_complex_double*) V, &ldv_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
@@ -59,6 +60,8 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "tpmqrt", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_stpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         V, &ldv_,
@@ -118,6 +121,8 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "tpmqrt", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dtpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         V, &ldv_,
@@ -173,6 +178,8 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< std::complex<float> > work( lwork );
 
+    lapack_trace_block( "tpmqrt", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ctpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         (lapack_complex_float*) V, &ldv_,
@@ -346,6 +353,8 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< std::complex<double> > work( lwork );
 
+    lapack_trace_block( "tpmqrt", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ztpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         (lapack_complex_double*) V, &ldv_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
@@ -47,6 +48,8 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
 
+    lapack_trace_block( "tpqrt", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_stpqrt(
         &m_, &n_, &l_, &nb_,
         A, &lda_,
@@ -89,6 +92,8 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
 
+    lapack_trace_block( "tpqrt", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtpqrt(
         &m_, &n_, &l_, &nb_,
         A, &lda_,
@@ -131,6 +136,8 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
 
+    lapack_trace_block( "tpqrt", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ctpqrt(
         &m_, &n_, &l_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -173,6 +180,8 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
 
+    lapack_trace_block( "tpqrt", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ztpqrt(
         &m_, &n_, &l_, &nb_,
         (lapack_complex_double*) A, &lda_,
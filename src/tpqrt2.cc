@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -41,6 +42,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpqrt2", 's', m, n, 0, 0 );
     LAPACK_stpqrt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -77,6 +79,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpqrt2", 'd', m, n, 0, 0 );
     LAPACK_dtpqrt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -113,6 +116,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpqrt2", 'c', m, n, 0, 0 );
     LAPACK_ctpqrt2(
         &m_, &n_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -149,6 +153,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpqrt2", 'z', m, n, 0, 0 );
     LAPACK_ztpqrt2(
         &m_, &n_, &l_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
@@ -57,6 +58,8 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< float > work( lwork );
 
+    lapack_trace_block( "tprfb", 's', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_stprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         V, &ldv_,
@@ -110,6 +113,8 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< double > work( lwork );
 
+    lapack_trace_block( "tprfb", 'd', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_dtprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         V, &ldv_,
@@ -163,6 +168,8 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< std::complex<float> > work( lwork );
 
+    lapack_trace_block( "tprfb", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ctprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         (lapack_complex_float*) V, &ldv_,
@@ -382,6 +389,8 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< std::complex<double> > work( lwork );
 
+    lapack_trace_block( "tprfb", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_ztprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         (lapack_complex_double*) V, &ldv_,
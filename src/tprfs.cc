@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -44,6 +45,8 @@ int64_t tprfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tprfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_stprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -92,6 +95,8 @@ int64_t tprfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "tprfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -140,6 +145,8 @@ int64_t tprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "tprfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -188,6 +195,8 @@ int64_t tprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "tprfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
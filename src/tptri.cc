@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -28,6 +29,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptri", 's', n, n, 0, 0 );
     LAPACK_stptri(
         &uplo_, &diag_, &n_,
         AP, &info_
@@ -55,6 +57,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptri", 'd', n, n, 0, 0 );
     LAPACK_dtptri(
         &uplo_, &diag_, &n_,
         AP, &info_
@@ -82,6 +85,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptri", 'c', n, n, 0, 0 );
     LAPACK_ctptri(
         &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP, &info_
@@ -109,6 +113,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptri", 'z', n, n, 0, 0 );
     LAPACK_ztptri(
         &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP, &info_
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -34,6 +35,7 @@ int64_t tptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptrs", 's', n, n, nrhs, 0 );
     LAPACK_stptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -68,6 +70,7 @@ int64_t tptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptrs", 'd', n, n, nrhs, 0 );
     LAPACK_dtptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -102,6 +105,7 @@ int64_t tptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptrs", 'c', n, n, nrhs, 0 );
     LAPACK_ctptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -136,6 +140,7 @@ int64_t tptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tptrs", 'z', n, n, nrhs, 0 );
     LAPACK_ztptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
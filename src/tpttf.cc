@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -29,6 +30,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttf", 's', n, n, 0, 0 );
     LAPACK_stpttf(
         &transr_, &uplo_, &n_,
         AP,
@@ -58,6 +60,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttf", 'd', n, n, 0, 0 );
     LAPACK_dtpttf(
         &transr_, &uplo_, &n_,
         AP,
@@ -87,6 +90,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttf", 'c', n, n, 0, 0 );
     LAPACK_ctpttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -116,6 +120,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttf", 'z', n, n, 0, 0 );
     LAPACK_ztpttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +31,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttr", 's', n, n, 0, 0 );
     LAPACK_stpttr(
         &uplo_, &n_,
         AP,
@@ -60,6 +62,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttr", 'd', n, n, 0, 0 );
     LAPACK_dtpttr(
         &uplo_, &n_,
         AP,
@@ -90,6 +93,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttr", 'c', n, n, 0, 0 );
     LAPACK_ctpttr(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -120,6 +124,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "tpttr", 'z', n, n, 0, 0 );
     LAPACK_ztpttr(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -0,0 +1,106 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/trace.hh"
+
+#include <memory>
+
+namespace lapack {
+namespace trace {
+
+namespace internal {
+
+std::atomic< bool > g_on( false );
+
+// Sink is held by shared_ptr, so a Block that started reporting keeps
+// its sink alive even if set_sink replaces it concurrently.
+static std::mutex g_sink_mutex;
+static std::shared_ptr< Sink > g_sink;
+
+//------------------------------------------------------------------------------
+void Block::finish()
+{
+    event_.time = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start_ ).count();
+
+    std::shared_ptr< Sink > sink;
+    {
+        std::lock_guard< std::mutex > lock( g_sink_mutex );
+        sink = g_sink;
+    }
+    if (sink)
+        (*sink)( event_ );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void set_sink( Sink sink )
+{
+    #if defined(LAPACK_TRACE)
+        std::lock_guard< std::mutex > lock( internal::g_sink_mutex );
+        if (sink) {
+            internal::g_sink = std::make_shared< Sink >( std::move( sink ) );
+            internal::g_on.store( true, std::memory_order_relaxed );
+        }
+        else {
+            internal::g_on.store( false, std::memory_order_relaxed );
+            internal::g_sink.reset();
+        }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+RingBuffer::RingBuffer( size_t capacity )
+    : events_( capacity ),
+      head_( 0 ),
+      size_( 0 ),
+      dropped_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+void RingBuffer::push( Event const& event )
+{
+    std::lock_guard< std::mutex > lock( mutex_ );
+    size_t cap = events_.size();
+    if (cap == 0) {
+        ++dropped_;
+        return;
+    }
+    if (size_ < cap) {
+        events_[ (head_ + size_) % cap ] = event;
+        ++size_;
+    }
+    else {
+        // overwrite oldest
+        events_[ head_ ] = event;
+        head_ = (head_ + 1) % cap;
+        ++dropped_;
+    }
+}
+
+//------------------------------------------------------------------------------
+std::vector< Event > RingBuffer::drain()
+{
+    std::lock_guard< std::mutex > lock( mutex_ );
+    size_t cap = events_.size();
+    std::vector< Event > out;
+    out.reserve( size_ );
+    for (size_t i = 0; i < size_; ++i)
+        out.push_back( events_[ (head_ + i) % cap ] );
+    head_ = 0;
+    size_ = 0;
+    return out;
+}
+
+//------------------------------------------------------------------------------
+size_t RingBuffer::dropped() const
+{
+    std::lock_guard< std::mutex > lock( mutex_ );
+    return dropped_;
+}
+
+}  // namespace trace
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -37,6 +38,8 @@ int64_t trcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "trcon", 's', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_strcon(
         &norm_, &uplo_, &diag_, &n_,
         A, &lda_, rcond,
@@ -74,6 +77,8 @@ int64_t trcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "trcon", 'd', n, n, 0, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtrcon(
         &norm_, &uplo_, &diag_, &n_,
         A, &lda_, rcond,
@@ -111,6 +116,8 @@ int64_t trcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "trcon", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctrcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &lda_, rcond,
@@ -148,6 +155,8 @@ int64_t trcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "trcon", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztrcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &lda_, rcond,
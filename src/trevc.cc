@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +52,8 @@ int64_t trevc(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    lapack_trace_block( "trevc", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_strevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -107,6 +110,8 @@ int64_t trevc(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    lapack_trace_block( "trevc", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -164,6 +169,8 @@ int64_t trevc(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "trevc", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -342,6 +349,8 @@ int64_t trevc(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "trevc", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30601  // >= 3.6.1
@@ -73,6 +74,8 @@ int64_t trevc3(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "trevc3", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_strevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -148,6 +151,8 @@ int64_t trevc3(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "trevc3", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -227,6 +232,8 @@ int64_t trevc3(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( lrwork_ );
 
+    lapack_trace_block( "trevc3", 'c', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -429,6 +436,8 @@ int64_t trevc3(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( lrwork_ );
 
+    lapack_trace_block( "trevc3", 'z', n, n, 0, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -40,6 +41,8 @@ int64_t trexc(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    lapack_trace_block( "trexc", 's', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_strexc(
         &compq_, &n_,
         T, &ldt_,
@@ -82,6 +85,8 @@ int64_t trexc(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    lapack_trace_block( "trexc", 'd', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtrexc(
         &compq_, &n_,
         T, &ldt_,
@@ -121,6 +126,7 @@ int64_t trexc(
     lapack_int ilst_ = (lapack_int) ilst;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trexc", 'c', n, n, 0, 0 );
     LAPACK_ctrexc(
         &compq_, &n_,
         (lapack_complex_float*) T, &ldt_,
@@ -157,6 +163,7 @@ int64_t trexc(
     lapack_int ilst_ = (lapack_int) ilst;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trexc", 'z', n, n, 0, 0 );
     LAPACK_ztrexc(
         &compq_, &n_,
         (lapack_complex_double*) T, &ldt_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -46,6 +47,8 @@ int64_t trrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "trrfs", 's', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_strrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -96,6 +99,8 @@ int64_t trrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    lapack_trace_block( "trrfs", 'd', n, n, nrhs, 0 );
+    lapack_trace_work( work, iwork );
     LAPACK_dtrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -146,6 +151,8 @@ int64_t trrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    lapack_trace_block( "trrfs", 'c', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ctrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -196,6 +203,8 @@ int64_t trrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    lapack_trace_block( "trrfs", 'z', n, n, nrhs, 0 );
+    lapack_trace_work( work, rwork );
     LAPACK_ztrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -77,6 +78,8 @@ int64_t trsen(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "trsen", 's', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, iwork );
     LAPACK_strsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -164,6 +167,8 @@ int64_t trsen(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
+    lapack_trace_block( "trsen", 'd', n, n, 0, 0 );
+    lapack_trace_work( WR, WI, work, iwork );
     LAPACK_dtrsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -241,6 +246,8 @@ int64_t trsen(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "trsen", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ctrsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -311,6 +318,8 @@ int64_t trsen(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "trsen", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ztrsen(
         &sense_, &compq_,
         select_ptr, &n_,
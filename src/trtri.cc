@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtri", 's', n, n, 0, Gflop< float >::trtri( n ) );
     LAPACK_strtri(
         &uplo_, &diag_, &n_,
         A, &lda_, &info_
@@ -59,6 +62,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtri", 'd', n, n, 0, Gflop< double >::trtri( n ) );
     LAPACK_dtrtri(
         &uplo_, &diag_, &n_,
         A, &lda_, &info_
@@ -88,6 +92,8 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtri", 'c', n, n, 0,
+                        Gflop< std::complex<float> >::trtri( n ) );
     LAPACK_ctrtri(
         &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -117,6 +123,8 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtri", 'z', n, n, 0,
+                        Gflop< std::complex<double> >::trtri( n ) );
     LAPACK_ztrtri(
         &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
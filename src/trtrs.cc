@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -36,6 +37,7 @@ int64_t trtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtrs", 's', n, n, nrhs, 0 );
     LAPACK_strtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -72,6 +74,7 @@ int64_t trtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtrs", 'd', n, n, nrhs, 0 );
     LAPACK_dtrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -108,6 +111,7 @@ int64_t trtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtrs", 'c', n, n, nrhs, 0 );
     LAPACK_ctrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -144,6 +148,7 @@ int64_t trtrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trtrs", 'z', n, n, nrhs, 0 );
     LAPACK_ztrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
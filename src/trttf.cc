@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -31,6 +32,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttf", 's', n, n, 0, 0 );
     LAPACK_strttf(
         &transr_, &uplo_, &n_,
         A, &lda_,
@@ -62,6 +64,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttf", 'd', n, n, 0, 0 );
     LAPACK_dtrttf(
         &transr_, &uplo_, &n_,
         A, &lda_,
@@ -93,6 +96,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttf", 'c', n, n, 0, 0 );
     LAPACK_ctrttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -124,6 +128,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttf", 'z', n, n, 0, 0 );
     LAPACK_ztrttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #include <vector>
 
@@ -30,6 +31,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttp", 's', n, n, 0, 0 );
     LAPACK_strttp(
         &uplo_, &n_,
         A, &lda_,
@@ -60,6 +62,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttp", 'd', n, n, 0, 0 );
     LAPACK_dtrttp(
         &uplo_, &n_,
         A, &lda_,
@@ -90,6 +93,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttp", 'c', n, n, 0, 0 );
     LAPACK_ctrttp(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -120,6 +124,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "trttp", 'z', n, n, 0, 0 );
     LAPACK_ztrttp(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -48,6 +49,8 @@ int64_t tzrzf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
+    lapack_trace_block( "tzrzf", 's', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_stzrzf(
         &m_, &n_,
         A, &lda_,
@@ -92,6 +95,8 @@ int64_t tzrzf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
+    lapack_trace_block( "tzrzf", 'd', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_dtzrzf(
         &m_, &n_,
         A, &lda_,
@@ -136,6 +141,8 @@ int64_t tzrzf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "tzrzf", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ctzrzf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -180,6 +187,8 @@ int64_t tzrzf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "tzrzf", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_ztzrzf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
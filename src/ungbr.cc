@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -56,6 +57,8 @@ int64_t ungbr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ungbr", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_cungbr(
         &vect_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -176,6 +179,8 @@ int64_t ungbr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ungbr", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zungbr(
         &vect_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
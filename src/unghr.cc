@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +52,8 @@ int64_t unghr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unghr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cunghr(
         &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
@@ -137,6 +140,8 @@ int64_t unghr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unghr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zunghr(
         &n_, &ilo_, &ihi_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +53,9 @@ int64_t unglq(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unglq", 'c', m, n, k,
+                        Gflop< std::complex<float> >::unglq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_cunglq(
         &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -136,6 +141,9 @@ int64_t unglq(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unglq", 'z', m, n, k,
+                        Gflop< std::complex<double> >::unglq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_zunglq(
         &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
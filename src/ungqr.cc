@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +53,9 @@ int64_t ungqr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ungqr", 'c', m, n, k,
+                        Gflop< std::complex<float> >::ungqr( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_cungqr(
         &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -137,6 +142,9 @@ int64_t ungqr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ungqr", 'z', m, n, k,
+                        Gflop< std::complex<double> >::ungqr( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_zungqr(
         &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
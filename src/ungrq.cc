@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -51,6 +53,9 @@ int64_t ungrq(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ungrq", 'c', m, n, k,
+                        Gflop< std::complex<float> >::ungrq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_cungrq(
         &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -136,6 +141,9 @@ int64_t ungrq(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ungrq", 'z', m, n, k,
+                        Gflop< std::complex<double> >::ungrq( m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_zungrq(
         &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -52,6 +53,8 @@ int64_t ungtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "ungtr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cungtr(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -140,6 +143,8 @@ int64_t ungtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "ungtr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zungtr(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 
 #if LAPACK_VERSION >= 30900  // >= 3.9.0
 
@@ -40,6 +41,7 @@ int64_t unhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "unhr_col", 'c', m, n, 0, 0 );
     LAPACK_cunhr_col(
         &m_, &n_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -159,6 +161,7 @@ int64_t unhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    lapack_trace_block( "unhr_col", 'z', m, n, 0, 0 );
     LAPACK_zunhr_col(
         &m_, &n_, &nb_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -63,6 +64,8 @@ int64_t unmhr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unmhr", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cunmhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
@@ -198,6 +201,8 @@ int64_t unmhr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unmhr", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zunmhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -61,6 +63,9 @@ int64_t unmql(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unmql", 'c', m, n, k,
+                        Gflop< std::complex<float> >::unmql( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_cunmql(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -190,6 +195,9 @@ int64_t unmql(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unmql", 'z', m, n, k,
+                        Gflop< std::complex<double> >::unmql( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_zunmql(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -61,6 +63,9 @@ int64_t unmrq(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unmrq", 'c', m, n, k,
+                        Gflop< std::complex<float> >::unmrq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_cunmrq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -189,6 +194,9 @@ int64_t unmrq(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unmrq", 'z', m, n, k,
+                        Gflop< std::complex<double> >::unmrq( side, m, n, k ) );
+    lapack_trace_work( work );
     LAPACK_zunmrq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -62,6 +63,8 @@ int64_t unmrz(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unmrz", 'c', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_cunmrz(
         &side_, &trans_, &m_, &n_, &k_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -125,6 +128,8 @@ int64_t unmrz(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unmrz", 'z', m, n, k, 0 );
+    lapack_trace_work( work );
     LAPACK_zunmrz(
         &side_, &trans_, &m_, &n_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
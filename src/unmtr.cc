@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -60,6 +61,8 @@ int64_t unmtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
+    lapack_trace_block( "unmtr", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cunmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -187,6 +190,8 @@ int64_t unmtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    lapack_trace_block( "unmtr", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zunmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
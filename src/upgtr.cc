@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -35,6 +36,8 @@ int64_t upgtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n-1) );
 
+    lapack_trace_block( "upgtr", 'c', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cupgtr(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -71,6 +74,8 @@ int64_t upgtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n-1) );
 
+    lapack_trace_block( "upgtr", 'z', n, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zupgtr(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/trace.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -43,6 +44,8 @@ int64_t upmtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( max(1,lwork) );
 
+    lapack_trace_block( "upmtr", 'c', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_cupmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_float*) AP,
@@ -150,6 +153,8 @@ int64_t upmtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( max(1,lwork) );
 
+    lapack_trace_block( "upmtr", 'z', m, n, 0, 0 );
+    lapack_trace_work( work );
     LAPACK_zupmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_double*) AP,
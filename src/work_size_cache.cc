@@ -0,0 +1,169 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "work_size_cache.hh"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// FNV-1a hash over the bytes of the key; WorkSizeKey has no padding.
+struct WorkSizeKeyHash
+{
+    size_t operator () ( WorkSizeKey const& key ) const
+    {
+        auto bytes = reinterpret_cast< unsigned char const* >( &key );
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < sizeof(key); ++i) {
+            hash ^= bytes[ i ];
+            hash *= 1099511628211ull;
+        }
+        return size_t( hash );
+    }
+};
+
+//------------------------------------------------------------------------------
+// Bounded LRU cache. Most recently used entries are at the front of lru_.
+// A hit only relinks a list node, so it does no allocation.
+class WorkSizeCache
+{
+public:
+    bool find( WorkSizeKey const& key, WorkSizes* sizes )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        auto iter = map_.find( key );
+        if (iter == map_.end()) {
+            ++misses_;
+            return false;
+        }
+        ++hits_;
+        lru_.splice( lru_.begin(), lru_, iter->second );
+        *sizes = iter->second->second;
+        return true;
+    }
+
+    void insert( WorkSizeKey const& key, WorkSizes const& sizes )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if (capacity_ <= 0)
+            return;
+
+        auto iter = map_.find( key );
+        if (iter != map_.end()) {
+            // Another thread inserted it meanwhile.
+            iter->second->second = sizes;
+            lru_.splice( lru_.begin(), lru_, iter->second );
+            return;
+        }
+        lru_.emplace_front( key, sizes );
+        map_.emplace( key, lru_.begin() );
+        evict();
+    }
+
+    WorkSizeCacheStats stats()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return { hits_, misses_, evictions_, int64_t( map_.size() ), capacity_ };
+    }
+
+    void clear()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        map_.clear();
+        lru_.clear();
+        hits_ = 0;
+        misses_ = 0;
+        evictions_ = 0;
+    }
+
+    void set_capacity( int64_t capacity )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        capacity_ = capacity < 0 ? 0 : capacity;
+        evict();
+    }
+
+private:
+    // Drops least recently used entries until within capacity.
+    // Caller holds mutex_.
+    void evict()
+    {
+        while (int64_t( map_.size() ) > capacity_) {
+            map_.erase( lru_.back().first );
+            lru_.pop_back();
+            ++evictions_;
+        }
+    }
+
+    using Entry = std::pair< WorkSizeKey, WorkSizes >;
+
+    std::mutex mutex_;
+    std::list< Entry > lru_;
+    std::unordered_map< WorkSizeKey, std::list< Entry >::iterator,
+                        WorkSizeKeyHash > map_;
+    int64_t capacity_  = 1024;
+    int64_t hits_      = 0;
+    int64_t misses_    = 0;
+    int64_t evictions_ = 0;
+};
+
+//------------------------------------------------------------------------------
+// Constructed on first use, so it is ready during static initialization.
+static WorkSizeCache& work_size_cache()
+{
+    static WorkSizeCache cache;
+    return cache;
+}
+
+//------------------------------------------------------------------------------
+/// Looks up the workspace sizes for key.
+/// @return true and sets sizes if found; false otherwise.
+bool work_size_cache_find( WorkSizeKey const& key, WorkSizes* sizes )
+{
+    return work_size_cache().find( key, sizes );
+}
+
+//------------------------------------------------------------------------------
+/// Saves the workspace sizes for key, evicting the least recently used
+/// entry if the cache is full.
+void work_size_cache_insert( WorkSizeKey const& key, WorkSizes const& sizes )
+{
+    work_size_cache().insert( key, sizes );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @return hit, miss, and eviction counts, and size and capacity,
+/// of the workspace size cache.
+/// @ingroup auxiliary
+WorkSizeCacheStats work_size_cache_stats()
+{
+    return internal::work_size_cache().stats();
+}
+
+//------------------------------------------------------------------------------
+/// Empties the workspace size cache and zeros its statistics.
+/// @ingroup auxiliary
+void work_size_cache_clear()
+{
+    internal::work_size_cache().clear();
+}
+
+//------------------------------------------------------------------------------
+/// Sets the maximum number of entries in the workspace size cache,
+/// evicting entries if needed. The default is 1024; 0 disables caching.
+/// @ingroup auxiliary
+void work_size_cache_set_capacity( int64_t capacity )
+{
+    internal::work_size_cache().set_capacity( capacity );
+}
+
+}  // namespace lapack
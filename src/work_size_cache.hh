@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORK_SIZE_CACHE_HH
+#define LAPACK_WORK_SIZE_CACHE_HH
+
+#include "lapack/workspace.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Key for the workspace size cache: Fortran routine name (which includes
+// the precision), job and other character options, and integer
+// dimensions, including leading dimensions. Sizes are chosen so the
+// struct has no padding, which lets it be compared and hashed bytewise.
+struct WorkSizeKey
+{
+    static constexpr int max_routine = 16;
+    static constexpr int max_jobs = 8;
+    static constexpr int max_dims = 8;
+
+    WorkSizeKey(
+        const char* routine_,
+        std::initializer_list< char > jobs_,
+        std::initializer_list< int64_t > dims_ )
+    {
+        std::strncpy( routine, routine_, max_routine - 1 );
+        int i = 0;
+        for (char job : jobs_) {
+            if (i < max_jobs)
+                jobs[ i++ ] = job;
+        }
+        i = 0;
+        for (int64_t dim : dims_) {
+            if (i < max_dims)
+                dims[ i++ ] = dim;
+        }
+    }
+
+    bool operator == ( WorkSizeKey const& other ) const
+    {
+        return std::memcmp( this, &other, sizeof(*this) ) == 0;
+    }
+
+    char    routine[ max_routine ] = {};
+    char    jobs[ max_jobs ] = {};
+    int64_t dims[ max_dims ] = {};
+};
+
+//------------------------------------------------------------------------------
+// Optimal sizes returned by a workspace query, in elements.
+using WorkSizes = lapack::WorkSizes;
+
+bool work_size_cache_find( WorkSizeKey const& key, WorkSizes* sizes );
+
+void work_size_cache_insert( WorkSizeKey const& key, WorkSizes const& sizes );
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_WORK_SIZE_CACHE_HH
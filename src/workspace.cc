@@ -0,0 +1,73 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Grows the arena to hold at least bytes. Invalidates all arrays
+/// previously taken; the contents are not preserved.
+void Workspace::reserve( size_t bytes )
+{
+    bytes = round_up( bytes );
+    if (bytes > capacity_) {
+        NoConstructAllocator< char > alloc( allocator_ );
+        char* data = alloc.allocate( bytes );
+        if (data_ != nullptr)
+            alloc.deallocate( data_, capacity_ );
+        data_ = data;
+        capacity_ = bytes;
+    }
+    used_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Frees the arena and any overflow blocks.
+void Workspace::release()
+{
+    NoConstructAllocator< char > alloc( allocator_ );
+    for (auto& block : overflow_)
+        alloc.deallocate( block.first, block.second );
+    overflow_.clear();
+    overflow_bytes_ = 0;
+
+    if (data_ != nullptr)
+        alloc.deallocate( data_, capacity_ );
+    data_ = nullptr;
+    capacity_ = 0;
+    used_ = 0;
+}
+
+//------------------------------------------------------------------------------
+// Slow path of take(): the arena is full, so allocate a separate block
+// that lives until the next reset(). Arrays already taken stay valid.
+void* Workspace::take_overflow( size_t bytes )
+{
+    NoConstructAllocator< char > alloc( allocator_ );
+    char* block = alloc.allocate( bytes );
+    overflow_.push_back( { block, bytes } );
+    overflow_bytes_ += bytes;
+    if (used_ + overflow_bytes_ > peak_)
+        peak_ = used_ + overflow_bytes_;
+    return block;
+}
+
+//------------------------------------------------------------------------------
+// Frees overflow blocks and regrows the arena to the peak size,
+// so the next pass of the same size fits without allocating.
+void Workspace::consolidate()
+{
+    NoConstructAllocator< char > alloc( allocator_ );
+    for (auto& block : overflow_)
+        alloc.deallocate( block.first, block.second );
+    overflow_.clear();
+    overflow_bytes_ = 0;
+
+    reserve( peak_ );
+}
+
+}  // namespace lapack
@@ -0,0 +1,588 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Benchmark driver. Runs the same routines as the tester, reusing its
+// routine table, parameters, and matrix generator, but instead of
+// checking results it times each case over several runs and writes
+// median, min, and stddev of time, Gflop/s, and Gbyte/s as CSV or JSON.
+//
+// Usage: lapackpp_bench [bench options] [tester parameters] routine...
+// See bench_usage below, or run with --help.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.hh"
+
+// -----------------------------------------------------------------------------
+using testsweeper::ansi_bold;
+using testsweeper::ansi_red;
+using testsweeper::ansi_normal;
+
+namespace {
+
+enum class Format { CSV, JSON };
+
+//------------------------------------------------------------------------------
+/// Options handled by the benchmark itself; everything else is passed
+/// to the tester's parameter parser.
+struct BenchOptions
+{
+    int64_t warmup = 1;
+    int64_t repeat = 5;
+    Format format = Format::CSV;
+    std::string output;
+    std::vector< std::string > shapes;
+    std::vector< std::string > sizes;
+    int64_t aspect = 2;
+};
+
+//------------------------------------------------------------------------------
+/// Statistics of one case over its timed runs. Values are NaN if the
+/// routine didn't report them.
+struct Stats
+{
+    double time_median = NAN;
+    double time_min    = NAN;
+    double time_stddev = NAN;
+    double gflops      = NAN;
+    double gbytes      = NAN;
+};
+
+//------------------------------------------------------------------------------
+void bench_usage( const char* prog )
+{
+    printf(
+        "Usage: %s [bench options] [parameters] routine [routine ...]\n"
+        "\n"
+        "Bench options:\n"
+        "    --warmup N        untimed runs before timing each case; default 1\n"
+        "    --repeat N        timed runs of each case; default 5\n"
+        "    --format F        output format: csv (default) or json\n"
+        "    --output FILE     write results to FILE instead of stdout\n"
+        "    --shape S,...     shapes to sweep: square, tall, wide;\n"
+        "                      default square, unless --dim is given\n"
+        "    --size R,...      sizes to sweep, each start:end:step or n;\n"
+        "                      default 100:500:100\n"
+        "    --aspect R        rows/cols ratio for tall and wide; default 2\n"
+        "                      (square-only routines, e.g., potrf, ignore m)\n"
+        "\n"
+        "Other parameters are as for the tester, e.g., --type d,z --dim 1000.\n"
+        "Checks and reference runs are off unless --check y or --ref y is given.\n"
+        "Test matrices are cached (--gen-cache 1024 MiB) unless --gen-cache 0.\n"
+        "With --gen-dir DIR, they are stored in DIR and reused across runs.\n"
+        "With --mmap-dir DIR, the matrix under test is mapped to a file in DIR,\n"
+        "for sizes near the memory limit (getrf, potrf, geqrf); add\n"
+        "--huge-pages y to advise huge pages.\n"
+        "For batched sweeps, use a *_batch routine with --batch.\n"
+        "Status is pass, fail (with --check y), error, or skip if the\n"
+        "tester skipped the case, e.g., an unsupported type.\n"
+        "\n"
+        "Example:\n"
+        "    %s --shape square,tall --size 500:2000:500 --format json \\\n"
+        "        --type d getrf geqrf\n"
+        "\n",
+        prog, prog );
+}
+
+//------------------------------------------------------------------------------
+/// Splits comma-separated list.
+std::vector< std::string > split( std::string const& str )
+{
+    std::vector< std::string > list;
+    size_t start = 0;
+    while (start <= str.size()) {
+        size_t end = str.find( ',', start );
+        if (end == std::string::npos)
+            end = str.size();
+        if (end > start)
+            list.push_back( str.substr( start, end - start ) );
+        start = end + 1;
+    }
+    return list;
+}
+
+//------------------------------------------------------------------------------
+/// Converts size range "start:end:step" or "n" to tester --dim values for
+/// the given shape. Tall is (aspect*n)-by-n; wide is n-by-(aspect*n).
+std::string shape_dim(
+    std::string const& shape, std::string const& size, int64_t aspect )
+{
+    long long start, end, step;
+    int cnt = sscanf( size.c_str(), "%lld:%lld:%lld", &start, &end, &step );
+    if (cnt == 1) {
+        end  = start;
+        step = 1;
+    }
+    else if (cnt == 2) {
+        step = 1;
+    }
+    if (cnt < 1 || start < 0 || end < start || step <= 0) {
+        throw std::runtime_error( "invalid --size '" + size + "'" );
+    }
+
+    char buf[ 128 ];
+    char const* fmt = "%lld:%lld:%lld";
+    char scaled[ 64 ];
+    snprintf( buf, sizeof( buf ), fmt, start, end, step );
+    snprintf( scaled, sizeof( scaled ), fmt,
+              start * aspect, end * aspect, step * aspect );
+
+    if (shape == "square")
+        return buf;
+    else if (shape == "tall")
+        return std::string( scaled ) + "x" + buf;
+    else if (shape == "wide")
+        return std::string( buf ) + "x" + scaled;
+    else
+        throw std::runtime_error( "unknown --shape '" + shape + "'" );
+}
+
+//------------------------------------------------------------------------------
+/// Strips bench options from args, leaving tester parameters and routines.
+/// Routine names (non-option arguments) are moved to routine_names.
+void parse_bench_args(
+    int argc, char** argv, BenchOptions& opts,
+    std::vector< std::string >& params_args,
+    std::vector< std::string >& routine_names )
+{
+    bool has_dim = false, has_check = false, has_ref = false;
+    bool has_gen_cache = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[ i ];
+        std::string value;
+        bool is_option = arg.size() > 2 && arg.compare( 0, 2, "--" ) == 0;
+        if (! is_option) {
+            routine_names.push_back( arg );
+            continue;
+        }
+
+        // Support both "--name value" and "--name=value".
+        size_t eq = arg.find( '=' );
+        if (eq != std::string::npos) {
+            value = arg.substr( eq + 1 );
+            arg = arg.substr( 0, eq );
+        }
+        auto next_value = [&]() {
+            if (eq != std::string::npos)
+                return value;
+            if (i + 1 >= argc)
+                throw std::runtime_error( "missing value for " + arg );
+            return std::string( argv[ ++i ] );
+        };
+
+        if (arg == "--warmup") {
+            opts.warmup = atoll( next_value().c_str() );
+            if (opts.warmup < 0)
+                throw std::runtime_error( "--warmup must be >= 0" );
+        }
+        else if (arg == "--repeat") {
+            opts.repeat = atoll( next_value().c_str() );
+            if (opts.repeat < 1)
+                throw std::runtime_error( "--repeat must be >= 1" );
+        }
+        else if (arg == "--format") {
+            value = next_value();
+            if (value == "csv")
+                opts.format = Format::CSV;
+            else if (value == "json")
+                opts.format = Format::JSON;
+            else
+                throw std::runtime_error( "unknown --format '" + value + "'" );
+        }
+        else if (arg == "--output") {
+            opts.output = next_value();
+        }
+        else if (arg == "--shape") {
+            for (auto& shape : split( next_value() ))
+                opts.shapes.push_back( shape );
+        }
+        else if (arg == "--size") {
+            for (auto& size : split( next_value() ))
+                opts.sizes.push_back( size );
+        }
+        else if (arg == "--aspect") {
+            opts.aspect = atoll( next_value().c_str() );
+            if (opts.aspect < 1)
+                throw std::runtime_error( "--aspect must be >= 1" );
+        }
+        else {
+            // tester parameter; flags without values, e.g., --help-matrix,
+            // aren't meaningful here, so every parameter takes a value.
+            has_dim   |= (arg == "--dim");
+            has_check |= (arg == "--check");
+            has_ref   |= (arg == "--ref");
+            has_gen_cache |= (arg == "--gen-cache");
+            params_args.push_back( arg );
+            params_args.push_back( next_value() );
+        }
+    }
+
+    // Sweep shapes, unless the user gave explicit --dim values.
+    if (opts.shapes.empty() && ! has_dim)
+        opts.shapes.push_back( "square" );
+    if (opts.sizes.empty())
+        opts.sizes.push_back( "100:500:100" );
+    for (auto& shape : opts.shapes) {
+        for (auto& size : opts.sizes) {
+            params_args.push_back( "--dim" );
+            params_args.push_back( shape_dim( shape, size, opts.aspect ) );
+        }
+    }
+
+    // Benchmark the routine alone, unless asked otherwise.
+    if (! has_check) {
+        params_args.push_back( "--check" );
+        params_args.push_back( "n" );
+    }
+    if (! has_ref) {
+        params_args.push_back( "--ref" );
+        params_args.push_back( "n" );
+    }
+
+    // Generate each test matrix once, rather than for every run.
+    if (! has_gen_cache) {
+        params_args.push_back( "--gen-cache" );
+        params_args.push_back( "1024" );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return median, min, and sample stddev of time, and Gflop/s and Gbyte/s
+/// at the median time.
+Stats compute_stats(
+    std::vector< double > times, double gflop, double gbyte )
+{
+    Stats stats;
+    size_t cnt = times.size();
+    if (cnt == 0)
+        return stats;
+
+    std::sort( times.begin(), times.end() );
+    stats.time_min = times[ 0 ];
+    stats.time_median = (cnt % 2 == 1)
+                      ? times[ cnt/2 ]
+                      : (times[ cnt/2 - 1 ] + times[ cnt/2 ]) / 2;
+
+    double mean = 0;
+    for (double t : times)
+        mean += t;
+    mean /= cnt;
+    double var = 0;
+    for (double t : times)
+        var += (t - mean) * (t - mean);
+    stats.time_stddev = cnt > 1 ? std::sqrt( var / (cnt - 1) ) : 0;
+
+    if (stats.time_median > 0) {
+        if (! std::isnan( gflop ))
+            stats.gflops = gflop / stats.time_median;
+        if (! std::isnan( gbyte ))
+            stats.gbytes = gbyte / stats.time_median;
+    }
+    return stats;
+}
+
+//------------------------------------------------------------------------------
+/// @return options that the routine uses, such as uplo and trans,
+/// as "name=value" pairs separated by semicolons.
+std::string used_options( Params& params )
+{
+    std::string opts;
+    auto add = [&opts]( char const* name, std::string const& value ) {
+        if (! opts.empty())
+            opts += ";";
+        opts += name;
+        opts += "=";
+        opts += value;
+    };
+    auto add_char = [&add]( char const* name, char value ) {
+        add( name, std::string( 1, value ) );
+    };
+
+    if (params.side.used())  add_char( "side",  blas::side2char( params.side() ) );
+    if (params.uplo.used())  add_char( "uplo",  blas::uplo2char( params.uplo() ) );
+    if (params.trans.used()) add_char( "trans", blas::op2char( params.trans() ) );
+    if (params.diag.used())  add_char( "diag",  blas::diag2char( params.diag() ) );
+    if (params.norm.used())  add_char( "norm",  lapack::norm2char( params.norm() ) );
+    if (params.jobz.used())  add_char( "jobz",  lapack::job2char( params.jobz() ) );
+    if (params.jobvl.used()) add_char( "jobvl", lapack::job2char( params.jobvl() ) );
+    if (params.jobvr.used()) add_char( "jobvr", lapack::job2char( params.jobvr() ) );
+    if (params.jobu.used())  add_char( "jobu",  lapack::job2char( params.jobu() ) );
+    if (params.jobvt.used()) add_char( "jobvt", lapack::job2char( params.jobvt() ) );
+    if (params.range.used()) add_char( "range", lapack::range2char( params.range() ) );
+    if (params.kd.used())    add( "kd", std::to_string( params.kd() ) );
+    if (params.kl.used())    add( "kl", std::to_string( params.kl() ) );
+    if (params.ku.used())    add( "ku", std::to_string( params.ku() ) );
+    if (params.nb.used())    add( "nb", std::to_string( params.nb() ) );
+    if (params.matrix.kind.used())
+        add( "matrix", params.matrix.kind() );
+    return opts;
+}
+
+//------------------------------------------------------------------------------
+/// Writes results as CSV or JSON. Missing values are empty in CSV
+/// and null in JSON.
+class Writer
+{
+public:
+    Writer( FILE* out, Format format, int64_t warmup )
+        : out_( out ), format_( format ), warmup_( warmup ), count_( 0 )
+    {
+        if (format_ == Format::CSV) {
+            fprintf( out_, "routine,type,shape,m,n,k,nrhs,batch,options,"
+                           "warmup,runs,time_median,time_min,time_stddev,"
+                           "gflops,gbytes,status\n" );
+        }
+        else {
+            fprintf( out_, "[" );
+        }
+    }
+
+    ~Writer()
+    {
+        if (format_ == Format::JSON)
+            fprintf( out_, "\n]\n" );
+        fflush( out_ );
+    }
+
+    void write(
+        char const* routine, Params& params, int64_t runs,
+        Stats const& stats, char const* status )
+    {
+        int64_t m = params.dim.m();
+        int64_t n = params.dim.n();
+        int64_t k = params.dim.k();
+        char const* shape = params.batch.used() ? "batched"
+                          : m == n ? "square"
+                          : m >  n ? "tall" : "wide";
+        char type[] = { testsweeper::datatype2char( params.datatype() ), '\0' };
+        std::string options = used_options( params );
+        int64_t nrhs  = params.nrhs.used()  ? params.nrhs()  : -1;
+        int64_t batch = params.batch.used() ? params.batch() : -1;
+
+        if (format_ == Format::CSV) {
+            fprintf( out_, "%s,%s,%s,%lld,%lld,%lld,",
+                     routine, type, shape, llong( m ), llong( n ), llong( k ) );
+            int_field( nrhs );
+            int_field( batch );
+            fprintf( out_, "%s,%lld,%lld,",
+                     options.c_str(), llong( warmup_ ), llong( runs ) );
+        }
+        else {
+            fprintf( out_, "%s\n  {\"routine\": \"%s\", \"type\": \"%s\", "
+                           "\"shape\": \"%s\", "
+                           "\"m\": %lld, \"n\": %lld, \"k\": %lld, ",
+                     (count_ > 0 ? "," : ""), routine, type, shape,
+                     llong( m ), llong( n ), llong( k ) );
+            fprintf( out_, "\"nrhs\": " );
+            int_field( nrhs );
+            fprintf( out_, "\"batch\": " );
+            int_field( batch );
+            fprintf( out_, "\"options\": \"%s\", \"warmup\": %lld, "
+                           "\"runs\": %lld, ",
+                     options.c_str(), llong( warmup_ ), llong( runs ) );
+            fprintf( out_, "\"time_median\": " );
+        }
+        real_field( stats.time_median );
+        if (format_ == Format::JSON) fprintf( out_, "\"time_min\": " );
+        real_field( stats.time_min );
+        if (format_ == Format::JSON) fprintf( out_, "\"time_stddev\": " );
+        real_field( stats.time_stddev );
+        if (format_ == Format::JSON) fprintf( out_, "\"gflops\": " );
+        real_field( stats.gflops );
+        if (format_ == Format::JSON) fprintf( out_, "\"gbytes\": " );
+        real_field( stats.gbytes );
+        if (format_ == Format::CSV)
+            fprintf( out_, "%s\n", status );
+        else
+            fprintf( out_, "\"status\": \"%s\"}", status );
+        fflush( out_ );
+        ++count_;
+    }
+
+private:
+    /// Writes integer field and separator; negative is missing.
+    void int_field( int64_t value )
+    {
+        if (value >= 0)
+            fprintf( out_, format_ == Format::CSV ? "%lld," : "%lld, ",
+                     llong( value ) );
+        else
+            fprintf( out_, format_ == Format::CSV ? "," : "null, " );
+    }
+
+    /// Writes real field and separator; NaN is missing.
+    void real_field( double value )
+    {
+        if (! std::isnan( value ))
+            fprintf( out_, format_ == Format::CSV ? "%.6e," : "%.6e, ", value );
+        else
+            fprintf( out_, format_ == Format::CSV ? "," : "null, " );
+    }
+
+    FILE* out_;
+    Format format_;
+    int64_t warmup_;
+    int64_t count_;
+};
+
+//------------------------------------------------------------------------------
+/// @return value of an output param, or NaN if the routine didn't set it.
+double output_value( testsweeper::ParamDouble& param )
+{
+    if (! param.used())
+        return NAN;
+    double value = param();
+    return std::isfinite( value ) ? value : NAN;
+}
+
+//------------------------------------------------------------------------------
+/// Benchmarks all cases of one routine.
+/// @return number of cases that failed.
+int bench_routine(
+    std::string const& routine, BenchOptions const& opts,
+    std::vector< std::string > const& params_args, Writer& writer )
+{
+    testsweeper::test_func_ptr test_routine
+        = find_tester( routine.c_str(), routines );
+    if (test_routine == nullptr) {
+        throw std::runtime_error( "routine " + routine + " not found" );
+    }
+
+    // mark fields that are used (run=false)
+    Params params;
+    test_routine( params, false );
+
+    std::vector< std::string > args_copy( params_args );
+    std::vector< char* > args;
+    for (auto& arg : args_copy)
+        args.push_back( &arg[ 0 ] );
+    args.push_back( nullptr );
+    try {
+        params.parse( routine.c_str(), int( args.size() ) - 1, args.data() );
+    }
+    catch (const std::exception& ex) {
+        params.help( routine.c_str() );
+        throw;
+    }
+    lapack::set_matrix_cache_limit( params.gen_cache() * 1024 * 1024 );
+    lapack::set_matrix_cache_dir( params.gen_dir() );
+
+    int failed = 0;
+    do {
+        std::vector< double > times;
+        double gflop = NAN, gbyte = NAN;
+        char const* status = "pass";
+        int64_t runs = 0;
+        try {
+            for (int64_t iter = 0; iter < opts.warmup + opts.repeat; ++iter) {
+                params.matrix.reset_calls();
+                params.matrixB.reset_calls();
+                test_routine( params, true );
+                if (params.check() == 'y' && ! params.okay())
+                    status = "fail";
+                if (iter >= opts.warmup) {
+                    double time = output_value( params.time );
+                    if (! std::isnan( time )) {
+                        times.push_back( time );
+                        // flop and byte counts are the same for each run
+                        gflop = output_value( params.gflops ) * time;
+                        gbyte = output_value( params.gbytes ) * time;
+                        ++runs;
+                    }
+                }
+                params.reset_output();
+            }
+        }
+        catch (const std::exception& ex) {
+            fprintf( stderr, "%s%sError: %s%s\n",
+                     ansi_bold, ansi_red, ex.what(), ansi_normal );
+            params.reset_output();
+            status = "error";
+        }
+        // the tester skips unsupported cases without setting a time
+        if (runs == 0 && strcmp( status, "pass" ) == 0)
+            status = "skip";
+        if (strcmp( status, "fail" ) == 0 || strcmp( status, "error" ) == 0)
+            ++failed;
+
+        Stats stats = compute_stats( times, gflop, gbyte );
+        writer.write( routine.c_str(), params, runs, stats, status );
+
+        fprintf( stderr, "%-16s %c %6lld %6lld %6lld  %.3e s  %s\n",
+                 routine.c_str(),
+                 testsweeper::datatype2char( params.datatype() ),
+                 llong( params.dim.m() ), llong( params.dim.n() ),
+                 llong( params.dim.k() ), stats.time_median, status );
+    } while (params.next());
+
+    return failed;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int main( int argc, char** argv )
+{
+    int status = 0;
+    try {
+        if (argc < 2
+            || strcmp( argv[argc-1], "-h" ) == 0
+            || strcmp( argv[argc-1], "--help" ) == 0)
+        {
+            bench_usage( argv[0] );
+            usage( argc, argv, routines, section_names );
+            return 0;
+        }
+
+        BenchOptions opts;
+        std::vector< std::string > params_args, routine_names;
+        parse_bench_args( argc, argv, opts, params_args, routine_names );
+        if (routine_names.empty()) {
+            throw std::runtime_error( "no routine given; see --help" );
+        }
+
+        int version = lapack::lapackpp_version();
+        fprintf( stderr, "LAPACK++ version %d.%02d.%02d, id %s\n",
+                 version / 10000, (version % 10000) / 100, version % 100,
+                 lapack::lapackpp_id() );
+
+        FILE* out = stdout;
+        if (! opts.output.empty()) {
+            out = fopen( opts.output.c_str(), "w" );
+            if (out == nullptr) {
+                throw std::runtime_error(
+                    "cannot open " + opts.output + ": " + strerror( errno ) );
+            }
+        }
+
+        {
+            Writer writer( out, opts.format, opts.warmup );
+            for (auto& routine : routine_names) {
+                status += bench_routine( routine, opts, params_args, writer );
+            }
+        }
+        if (out != stdout)
+            fclose( out );
+
+        if (status) {
+            fprintf( stderr, "%d cases FAILED.\n", status );
+        }
+    }
+    catch (const std::exception& ex) {
+        fprintf( stderr, "\n%s%sError: %s%s\n",
+                 ansi_bold, ansi_red, ex.what(), ansi_normal );
+        status = -1;
+    }
+
+    return status;
+}
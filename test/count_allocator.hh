@@ -0,0 +1,49 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef COUNT_ALLOCATOR_HH
+#define COUNT_ALLOCATOR_HH
+
+#include "lapack/memory.hh"
+
+#include <atomic>
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// Allocator that counts calls and bytes outstanding, and forwards to the
+// allocator in effect when it was constructed.
+class CountAllocator: public lapack::Allocator
+{
+public:
+    CountAllocator()
+        : upstream_( lapack::get_allocator() )
+    {}
+
+    void* allocate( size_t bytes, size_t alignment ) override
+    {
+        void* ptr = upstream_->allocate( bytes, alignment );
+        allocs    += 1;
+        used      += bytes;
+        last_alignment = alignment;
+        return ptr;
+    }
+
+    void deallocate( void* ptr, size_t bytes ) noexcept override
+    {
+        upstream_->deallocate( ptr, bytes );
+        deallocs += 1;
+        used     -= bytes;
+    }
+
+    std::atomic< int64_t > allocs { 0 };
+    std::atomic< int64_t > deallocs { 0 };
+    std::atomic< size_t > used { 0 };
+    std::atomic< size_t > last_alignment { 0 };
+
+private:
+    lapack::Allocator* upstream_;
+};
+
+#endif // COUNT_ALLOCATOR_HH
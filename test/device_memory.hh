@@ -0,0 +1,81 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef DEVICE_MEMORY_HH
+#define DEVICE_MEMORY_HH
+
+#include "lapack/device.hh"
+
+#include <algorithm>
+
+// -----------------------------------------------------------------------------
+// Memory for device testers. When device routines run on the host,
+// "device" memory is host memory, so these use new and std::copy;
+// otherwise, they use BLAS++ device memory routines on the queue.
+
+// -----------------------------------------------------------------------------
+/// @return true if device routines can run: on the host,
+/// always; otherwise, if there is a GPU device.
+inline bool test_device_available()
+{
+    #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+        return true;
+    #else
+        return blas::get_device_count() > 0;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* test_device_malloc( int64_t n, lapack::Queue& queue )
+{
+    #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+        return new T[ n ];
+    #else
+        return blas::device_malloc< T >( n, queue );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void test_device_free( T* ptr, lapack::Queue& queue )
+{
+    #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+        delete[] ptr;
+    #else
+        blas::device_free( ptr, queue );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Copies n elements from src to dst; either may be on the device.
+template <typename T>
+void test_device_memcpy( T* dst, T const* src, int64_t n, lapack::Queue& queue )
+{
+    #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+        std::copy( src, src + n, dst );
+    #else
+        blas::device_memcpy( dst, src, n, queue );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Copies m-by-n matrix A to B; either may be on the device.
+template <typename T>
+void test_device_copy_matrix(
+    int64_t m, int64_t n,
+    T const* A, int64_t lda,
+    T*       B, int64_t ldb, lapack::Queue& queue )
+{
+    #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+        for (int64_t j = 0; j < n; ++j) {
+            std::copy( &A[ j*lda ], &A[ j*lda + m ], &B[ j*ldb ] );
+        }
+    #else
+        blas::device_copy_matrix( m, n, A, lda, B, ldb, queue );
+    #endif
+}
+
+#endif // DEVICE_MEMORY_HH
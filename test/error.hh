@@ -59,4 +59,36 @@ rel_error( std::vector<T1>& x, std::vector<T2>& xref )
     return diff / norm;
 }
 
+// -----------------------------------------------------------------------------
+// returns max elementwise relative error, max_i | x_i - xref_i | / | xref_i |,
+// where | xref_i | is at least the underflow threshold, so subnormal values
+// are compared in absolute terms. Entries that are equal, including equal
+// Inf, or both NaN have no error; other Inf or NaN entries have Inf error.
+template< typename T1, typename T2 >
+blas::real_type< T1, T2 >
+max_rel_error( std::vector<T1>& x, std::vector<T2>& xref )
+{
+    using real_t = blas::real_type< T1, T2 >;
+    const real_t inf = std::numeric_limits<real_t>::infinity();
+    const real_t safmin = std::numeric_limits<real_t>::min();
+
+    if (x.size() != xref.size()) {
+        return std::numeric_limits<real_t>::quiet_NaN();
+    }
+    real_t tmp;
+    real_t error = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        bool x_nan    = (x[i] != x[i]);
+        bool xref_nan = (xref[i] != xref[i]);
+        if (x[i] == xref[i] || (x_nan && xref_nan))
+            continue;
+        tmp = std::abs( x[i] - xref[i] )
+            / std::max( real_t( std::abs( xref[i] ) ), safmin );
+        if (std::isnan( tmp ))
+            tmp = inf;
+        error = std::max( error, tmp );
+    }
+    return error;
+}
+
 #endif        //  #ifndef ERROR_HH
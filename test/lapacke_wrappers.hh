@@ -4707,6 +4707,52 @@ inline lapack_int LAPACKE_hptrs(
         (lapack_complex_double*) B, ldb );
 }
 
+// -----------------------------------------------------------------------------
+// Fortran prototypes if not given via lapacke.h
+extern "C" {
+
+#ifndef LAPACK_clacp2
+#define LAPACK_clacp2 LAPACK_GLOBAL(clacp2,CLACP2)
+void LAPACK_clacp2(
+    char const* uplo, lapack_int const* m, lapack_int const* n,
+    float const* A, lapack_int const* lda,
+    lapack_complex_float* B, lapack_int const* ldb );
+#endif
+
+#ifndef LAPACK_zlacp2
+#define LAPACK_zlacp2 LAPACK_GLOBAL(zlacp2,ZLACP2)
+void LAPACK_zlacp2(
+    char const* uplo, lapack_int const* m, lapack_int const* n,
+    double const* A, lapack_int const* lda,
+    lapack_complex_double* B, lapack_int const* ldb );
+#endif
+
+}  // extern "C"
+
+// --------------------
+// wrappers around LAPACK (not in LAPACKE before 3.6)
+inline lapack_int LAPACKE_lacp2(
+    char uplo, lapack_int m, lapack_int n,
+    float const* A, lapack_int lda,
+    std::complex<float>* B, lapack_int ldb )
+{
+    LAPACK_clacp2(
+        &uplo, &m, &n, A, &lda,
+        (lapack_complex_float*) B, &ldb );
+    return 0;
+}
+
+inline lapack_int LAPACKE_lacp2(
+    char uplo, lapack_int m, lapack_int n,
+    double const* A, lapack_int lda,
+    std::complex<double>* B, lapack_int ldb )
+{
+    LAPACK_zlacp2(
+        &uplo, &m, &n, A, &lda,
+        (lapack_complex_double*) B, &ldb );
+    return 0;
+}
+
 // -----------------------------------------------------------------------------
 inline lapack_int LAPACKE_lacpy(
     char uplo, lapack_int m, lapack_int n,
@@ -5823,6 +5869,28 @@ inline double LAPACKE_lantr(
 }
 
 
+// -----------------------------------------------------------------------------
+inline float LAPACKE_lapy2( float x, float y )
+{
+    return LAPACKE_slapy2( x, y );
+}
+
+inline double LAPACKE_lapy2( double x, double y )
+{
+    return LAPACKE_dlapy2( x, y );
+}
+
+// -----------------------------------------------------------------------------
+inline float LAPACKE_lapy3( float x, float y, float z )
+{
+    return LAPACKE_slapy3( x, y, z );
+}
+
+inline double LAPACKE_lapy3( double x, double y, double z )
+{
+    return LAPACKE_dlapy3( x, y, z );
+}
+
 // -----------------------------------------------------------------------------
 // Fortran prototypes if not given via lapacke.h
 extern "C" {
@@ -6250,6 +6318,171 @@ inline lapack_int LAPACKE_larfy(
 }
 #endif // 30700
 
+// -----------------------------------------------------------------------------
+// Fortran prototypes if not given via lapacke.h
+extern "C" {
+
+#ifndef LAPACK_slartg
+#define LAPACK_slartg LAPACK_GLOBAL(slartg,SLARTG)
+void LAPACK_slartg(
+    float const* f, float const* g,
+    float* c, float* s, float* r );
+#endif
+
+#ifndef LAPACK_dlartg
+#define LAPACK_dlartg LAPACK_GLOBAL(dlartg,DLARTG)
+void LAPACK_dlartg(
+    double const* f, double const* g,
+    double* c, double* s, double* r );
+#endif
+
+#ifndef LAPACK_clartg
+#define LAPACK_clartg LAPACK_GLOBAL(clartg,CLARTG)
+void LAPACK_clartg(
+    lapack_complex_float const* f, lapack_complex_float const* g,
+    float* c, lapack_complex_float* s, lapack_complex_float* r );
+#endif
+
+#ifndef LAPACK_zlartg
+#define LAPACK_zlartg LAPACK_GLOBAL(zlartg,ZLARTG)
+void LAPACK_zlartg(
+    lapack_complex_double const* f, lapack_complex_double const* g,
+    double* c, lapack_complex_double* s, lapack_complex_double* r );
+#endif
+
+}  // extern "C"
+
+// --------------------
+// wrappers around LAPACK (not in LAPACKE)
+inline void LAPACKE_lartg(
+    float f, float g,
+    float* c, float* s, float* r )
+{
+    LAPACK_slartg( &f, &g, c, s, r );
+}
+
+inline void LAPACKE_lartg(
+    double f, double g,
+    double* c, double* s, double* r )
+{
+    LAPACK_dlartg( &f, &g, c, s, r );
+}
+
+inline void LAPACKE_lartg(
+    std::complex<float> f, std::complex<float> g,
+    float* c, std::complex<float>* s, std::complex<float>* r )
+{
+    LAPACK_clartg(
+        (lapack_complex_float*) &f, (lapack_complex_float*) &g,
+        c, (lapack_complex_float*) s, (lapack_complex_float*) r );
+}
+
+inline void LAPACKE_lartg(
+    std::complex<double> f, std::complex<double> g,
+    double* c, std::complex<double>* s, std::complex<double>* r )
+{
+    LAPACK_zlartg(
+        (lapack_complex_double*) &f, (lapack_complex_double*) &g,
+        c, (lapack_complex_double*) s, (lapack_complex_double*) r );
+}
+
+// -----------------------------------------------------------------------------
+// Fortran prototypes if not given via lapacke.h
+extern "C" {
+
+#ifndef LAPACK_slascl
+#define LAPACK_slascl LAPACK_GLOBAL(slascl,SLASCL)
+void LAPACK_slascl(
+    char const* type, lapack_int const* kl, lapack_int const* ku,
+    float const* cfrom, float const* cto,
+    lapack_int const* m, lapack_int const* n,
+    float* A, lapack_int const* lda,
+    lapack_int* info );
+#endif
+
+#ifndef LAPACK_dlascl
+#define LAPACK_dlascl LAPACK_GLOBAL(dlascl,DLASCL)
+void LAPACK_dlascl(
+    char const* type, lapack_int const* kl, lapack_int const* ku,
+    double const* cfrom, double const* cto,
+    lapack_int const* m, lapack_int const* n,
+    double* A, lapack_int const* lda,
+    lapack_int* info );
+#endif
+
+#ifndef LAPACK_clascl
+#define LAPACK_clascl LAPACK_GLOBAL(clascl,CLASCL)
+void LAPACK_clascl(
+    char const* type, lapack_int const* kl, lapack_int const* ku,
+    float const* cfrom, float const* cto,
+    lapack_int const* m, lapack_int const* n,
+    lapack_complex_float* A, lapack_int const* lda,
+    lapack_int* info );
+#endif
+
+#ifndef LAPACK_zlascl
+#define LAPACK_zlascl LAPACK_GLOBAL(zlascl,ZLASCL)
+void LAPACK_zlascl(
+    char const* type, lapack_int const* kl, lapack_int const* ku,
+    double const* cfrom, double const* cto,
+    lapack_int const* m, lapack_int const* n,
+    lapack_complex_double* A, lapack_int const* lda,
+    lapack_int* info );
+#endif
+
+}  // extern "C"
+
+// --------------------
+// wrappers around LAPACK (not in LAPACKE before 3.6)
+// Unlike LAPACKE_lascl, these don't check A for NaN.
+inline lapack_int LAPACKE_lascl(
+    char type, lapack_int kl, lapack_int ku, float cfrom, float cto,
+    lapack_int m, lapack_int n,
+    float* A, lapack_int lda )
+{
+    lapack_int info = 0;
+    LAPACK_slascl(
+        &type, &kl, &ku, &cfrom, &cto, &m, &n,
+        A, &lda, &info );
+    return info;
+}
+
+inline lapack_int LAPACKE_lascl(
+    char type, lapack_int kl, lapack_int ku, double cfrom, double cto,
+    lapack_int m, lapack_int n,
+    double* A, lapack_int lda )
+{
+    lapack_int info = 0;
+    LAPACK_dlascl(
+        &type, &kl, &ku, &cfrom, &cto, &m, &n,
+        A, &lda, &info );
+    return info;
+}
+
+inline lapack_int LAPACKE_lascl(
+    char type, lapack_int kl, lapack_int ku, float cfrom, float cto,
+    lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda )
+{
+    lapack_int info = 0;
+    LAPACK_clascl(
+        &type, &kl, &ku, &cfrom, &cto, &m, &n,
+        (lapack_complex_float*) A, &lda, &info );
+    return info;
+}
+
+inline lapack_int LAPACKE_lascl(
+    char type, lapack_int kl, lapack_int ku, double cfrom, double cto,
+    lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda )
+{
+    lapack_int info = 0;
+    LAPACK_zlascl(
+        &type, &kl, &ku, &cfrom, &cto, &m, &n,
+        (lapack_complex_double*) A, &lda, &info );
+    return info;
+}
+
 // -----------------------------------------------------------------------------
 inline lapack_int LAPACKE_laset(
     char uplo, lapack_int m, lapack_int n, float alpha, float beta,
@@ -6291,6 +6524,74 @@ inline lapack_int LAPACKE_laset(
         (lapack_complex_double*) A, lda );
 }
 
+// -----------------------------------------------------------------------------
+// Fortran prototypes if not given via lapacke.h
+extern "C" {
+
+#ifndef LAPACK_slassq
+#define LAPACK_slassq LAPACK_GLOBAL(slassq,SLASSQ)
+void LAPACK_slassq(
+    lapack_int const* n,
+    float const* x, lapack_int const* incx,
+    float* scale, float* sumsq );
+#endif
+
+#ifndef LAPACK_dlassq
+#define LAPACK_dlassq LAPACK_GLOBAL(dlassq,DLASSQ)
+void LAPACK_dlassq(
+    lapack_int const* n,
+    double const* x, lapack_int const* incx,
+    double* scale, double* sumsq );
+#endif
+
+#ifndef LAPACK_classq
+#define LAPACK_classq LAPACK_GLOBAL(classq,CLASSQ)
+void LAPACK_classq(
+    lapack_int const* n,
+    lapack_complex_float const* x, lapack_int const* incx,
+    float* scale, float* sumsq );
+#endif
+
+#ifndef LAPACK_zlassq
+#define LAPACK_zlassq LAPACK_GLOBAL(zlassq,ZLASSQ)
+void LAPACK_zlassq(
+    lapack_int const* n,
+    lapack_complex_double const* x, lapack_int const* incx,
+    double* scale, double* sumsq );
+#endif
+
+}  // extern "C"
+
+// --------------------
+// wrappers around LAPACK (not in LAPACKE before 3.10.1)
+inline void LAPACKE_lassq(
+    lapack_int n, float const* x, lapack_int incx,
+    float* scale, float* sumsq )
+{
+    LAPACK_slassq( &n, x, &incx, scale, sumsq );
+}
+
+inline void LAPACKE_lassq(
+    lapack_int n, double const* x, lapack_int incx,
+    double* scale, double* sumsq )
+{
+    LAPACK_dlassq( &n, x, &incx, scale, sumsq );
+}
+
+inline void LAPACKE_lassq(
+    lapack_int n, std::complex<float> const* x, lapack_int incx,
+    float* scale, float* sumsq )
+{
+    LAPACK_classq( &n, (lapack_complex_float const*) x, &incx, scale, sumsq );
+}
+
+inline void LAPACKE_lassq(
+    lapack_int n, std::complex<double> const* x, lapack_int incx,
+    double* scale, double* sumsq )
+{
+    LAPACK_zlassq( &n, (lapack_complex_double const*) x, &incx, scale, sumsq );
+}
+
 // -----------------------------------------------------------------------------
 inline lapack_int LAPACKE_laswp(
     lapack_int n,
@@ -7,7 +7,24 @@
 #include <string>
 #include <vector>
 #include <limits>
+#include <list>
 #include <complex>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
+
+#if ! defined( _WIN32 ) && ! defined( _WIN64 )
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #include <process.h>
+#endif
 
 #include "matrix_params.hh"
 #include "matrix_generator.hh"
@@ -44,6 +61,374 @@ std::vector< std::string >
 // =============================================================================
 namespace lapack {
 
+// -----------------------------------------------------------------------------
+/// Derives the next larnv seed from iseed, with the splitmix64 finalizer.
+/// Result is a valid larnv seed: entries in [0, 4095], seed[3] odd.
+/// seed may alias iseed.
+///
+/// @return 48-bit key from iseed, for larnv_philox.
+///
+/// @ingroup generate_matrix
+uint64_t next_seed( int64_t const* iseed, int64_t* seed )
+{
+    uint64_t key = (uint64_t( iseed[0] ) << 36) | (uint64_t( iseed[1] ) << 24)
+                 | (uint64_t( iseed[2] ) << 12) |  uint64_t( iseed[3] );
+    uint64_t x = key + 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    x =  x ^ (x >> 31);
+    for (int i = 0; i < 4; ++i) {
+        seed[i] = int64_t( (x >> (12*i)) & 4095 );
+    }
+    seed[3] |= 1;
+    return key;
+}
+
+// -----------------------------------------------------------------------------
+/// Fills m-by-n matrix A with random numbers from distribution idist,
+/// like larnv, in parallel, using the counter-based lapack::larnv_philox
+/// keyed by iseed. A depends only on iseed and dimensions, not the number
+/// of threads. On exit, iseed is updated for the next call.
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void larnv_parallel(
+    int64_t idist, int64_t* iseed,
+    int64_t m, int64_t n, scalar_t* A, int64_t lda )
+{
+    uint64_t key = next_seed( iseed, iseed );
+    lapack::larnv_philox( idist, key, 0, m, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Makes each column j of the m-by-n matrix U into a Householder vector
+/// of length m - j, in parallel.
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void householder_columns(
+    int64_t m, int64_t n, Matrix<scalar_t>& U, Vector<scalar_t>& tau )
+{
+    #if defined(_OPENMP)
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t mj = m - j;
+        lapack::larfg( mj, U(j,j), U(j+1,j), 1, tau(j) );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// Cache of generated matrices, keyed by precision, kind, dimensions,
+/// cond, condD, and seed. Disabled until set_matrix_cache_limit is
+/// called with a positive size. Entries are evicted least recently used
+/// first. Not thread safe; the tester generates matrices serially.
+class MatrixCache
+{
+public:
+    struct Entry {
+        std::string key;
+        std::vector< char > A, sigma;
+    };
+
+    MatrixCache():
+        limit_( 0 ),
+        bytes_( 0 )
+    {}
+
+    int64_t limit() const { return limit_; }
+
+    void limit( int64_t bytes )
+    {
+        limit_ = bytes;
+        evict( 0 );
+    }
+
+    /// @return entry for key, or nullptr if not found.
+    Entry* find( std::string const& key )
+    {
+        for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+            if (iter->key == key) {
+                // move to front, as most recently used
+                entries_.splice( entries_.begin(), entries_, iter );
+                return &entries_.front();
+            }
+        }
+        return nullptr;
+    }
+
+    void insert( Entry&& entry )
+    {
+        int64_t size = entry.A.size() + entry.sigma.size();
+        if (size > limit_)
+            return;
+        evict( size );
+        bytes_ += size;
+        entries_.push_front( std::move( entry ) );
+    }
+
+private:
+    /// Evicts entries until size more bytes fit within the limit.
+    void evict( int64_t size )
+    {
+        while (! entries_.empty() && bytes_ + size > limit_) {
+            auto& last = entries_.back();
+            bytes_ -= last.A.size() + last.sigma.size();
+            entries_.pop_back();
+        }
+    }
+
+    int64_t limit_;
+    int64_t bytes_;
+    std::list< Entry > entries_;
+};
+
+MatrixCache g_matrix_cache;
+
+// -----------------------------------------------------------------------------
+/// Sets the size of the cache of generated matrices, in bytes.
+/// If bytes > 0, generate_matrix returns the same matrix for the same
+/// MatrixParams seed, kind, cond, condD, dimensions, sigma length, and
+/// call number since MatrixParams::reset_calls, copying it from the
+/// cache after the first time, and doesn't advance the seed. The call
+/// number keeps matrices generated in one test (e.g., A and X) different.
+/// If bytes = 0 (default), the cache is disabled and each call
+/// advances the seed, generating a new matrix.
+///
+/// @ingroup generate_matrix
+void set_matrix_cache_limit( int64_t bytes )
+{
+    g_matrix_cache.limit( std::max( int64_t( 0 ), bytes ) );
+}
+
+// -----------------------------------------------------------------------------
+/// Maps file into memory, for Vector and Matrix. Creates the file if it
+/// doesn't exist, and resizes it to bytes if needed. The mapping is
+/// shared, so writes go to the file. With huge_pages, advises the OS to
+/// use transparent huge pages, where supported.
+/// Throws on error, or if mapping files isn't supported.
+///
+/// @ingroup generate_matrix
+void* map_file( std::string const& filename, size_t bytes, bool huge_pages )
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        throw std::runtime_error( "mapping files is not supported" );
+    #else
+        int fd = open( filename.c_str(), O_RDWR | O_CREAT, 0644 );
+        if (fd < 0) {
+            throw std::runtime_error( "can't open " + filename + ": "
+                                      + strerror( errno ) );
+        }
+        struct stat st;
+        if (fstat( fd, &st ) != 0
+            || (size_t( st.st_size ) != bytes
+                && ftruncate( fd, off_t( bytes ) ) != 0))
+        {
+            int err = errno;
+            close( fd );
+            throw std::runtime_error( "can't resize " + filename + ": "
+                                      + strerror( err ) );
+        }
+        void* data = mmap( nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd, 0 );
+        int err = errno;
+        close( fd );  // mapping keeps file open
+        if (data == MAP_FAILED) {
+            throw std::runtime_error( "can't map " + filename + ": "
+                                      + strerror( err ) );
+        }
+        #if defined( MADV_HUGEPAGE )
+            if (huge_pages)
+                madvise( data, bytes, MADV_HUGEPAGE );  // only a hint
+        #endif
+        return data;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Maps existing file into memory read-only, for reading stored matrices.
+/// Never creates or resizes the file.
+///
+/// @return pointer to the data, or null if the file doesn't exist or
+/// isn't exactly bytes long, or if mapping files isn't supported.
+/// Throws on other errors. Unmap with unmap_file.
+///
+/// @ingroup generate_matrix
+void const* map_file_read( std::string const& filename, size_t bytes )
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        return nullptr;
+    #else
+        int fd = open( filename.c_str(), O_RDONLY );
+        if (fd < 0) {
+            if (errno == ENOENT)
+                return nullptr;
+            throw std::runtime_error( "can't open " + filename + ": "
+                                      + strerror( errno ) );
+        }
+        struct stat st;
+        if (fstat( fd, &st ) != 0 || size_t( st.st_size ) != bytes) {
+            close( fd );
+            return nullptr;
+        }
+        void* data = mmap( nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0 );
+        int err = errno;
+        close( fd );  // mapping keeps file open
+        if (data == MAP_FAILED) {
+            throw std::runtime_error( "can't map " + filename + ": "
+                                      + strerror( err ) );
+        }
+        return data;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Unmaps file mapped by map_file or map_file_read.
+///
+/// @ingroup generate_matrix
+void unmap_file( void const* data, size_t bytes )
+{
+    #if ! defined( _WIN32 ) && ! defined( _WIN64 )
+        munmap( const_cast< void* >( data ), bytes );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Directory where generated matrices are stored; empty if disabled.
+std::string g_matrix_dir;
+
+// -----------------------------------------------------------------------------
+/// Sets the directory where generated matrices are stored, for reuse
+/// across runs. If dir is not empty, generate_matrix looks for the matrix
+/// in dir, mapping it into memory, before generating it; and writes each
+/// matrix it generates to dir. Like the cache, the seed isn't advanced,
+/// so the same MatrixParams and call number gives the same matrix. If dir is empty
+/// (default), matrices are not stored.
+///
+/// @see set_matrix_cache_limit
+///
+/// @ingroup generate_matrix
+void set_matrix_cache_dir( std::string const& dir )
+{
+    g_matrix_dir = dir;
+}
+
+// -----------------------------------------------------------------------------
+/// @return filename in g_matrix_dir for the matrix with the cache key,
+/// without extension. Characters that aren't safe in filenames are
+/// replaced by '_'.
+std::string matrix_filename( std::string const& key )
+{
+    std::string name = "lapackpp_" + key;
+    for (auto& c : name) {
+        if (! (isalnum( c ) || c == '.' || c == '-' || c == '+'))
+            c = '_';
+    }
+    return g_matrix_dir + "/" + name;
+}
+
+// -----------------------------------------------------------------------------
+/// Reads matrix A and sigma from files in g_matrix_dir, if they exist,
+/// mapping them read-only.
+///
+/// @return true if found; false if either file is missing or has the
+/// wrong size, e.g., from an interrupted or different run.
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+bool read_matrix_file(
+    std::string const& key,
+    Matrix<scalar_t>& A,
+    Vector< blas::real_type<scalar_t> >& sigma )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    std::string filename = matrix_filename( key );
+    size_t bytes_A = size_t( A.m ) * A.n * sizeof(scalar_t);
+    size_t bytes_sigma = size_t( sigma.n ) * sizeof(real_t);
+    auto A_file = (scalar_t const*) map_file_read( filename + ".A", bytes_A );
+    if (A_file == nullptr)
+        return false;
+
+    if (sigma.n > 0) {
+        auto sigma_file = (real_t const*) map_file_read(
+            filename + ".sigma", bytes_sigma );
+        if (sigma_file == nullptr) {
+            unmap_file( A_file, bytes_A );
+            return false;
+        }
+        std::copy( sigma_file, sigma_file + sigma.n, sigma(0) );
+        unmap_file( sigma_file, bytes_sigma );
+    }
+    lapack::lacpy( lapack::MatrixType::General, A.m, A.n,
+                   A_file, A.m, A(0,0), A.ld );
+    unmap_file( A_file, bytes_A );
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+/// @return suffix for temporary files, unique to this process.
+std::string tmp_file_suffix()
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        return ".tmp" + std::to_string( _getpid() );
+    #else
+        return ".tmp" + std::to_string( getpid() );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Renames file src to dst, replacing dst on POSIX systems. On error,
+/// removes src and throws.
+void rename_file( std::string const& src, std::string const& dst )
+{
+    if (rename( src.c_str(), dst.c_str() ) != 0) {
+        int err = errno;
+        remove( src.c_str() );
+        throw std::runtime_error( "can't rename " + src + " to " + dst + ": "
+                                  + strerror( err ) );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// Writes matrix A and sigma to files in g_matrix_dir. Writes to
+/// temporary files, then renames them, so concurrent or interrupted
+/// runs don't leave partial files.
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void write_matrix_file(
+    std::string const& key,
+    Matrix<scalar_t>& A,
+    Vector< blas::real_type<scalar_t> >& sigma )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    std::string filename = matrix_filename( key );
+    std::string tmp = tmp_file_suffix();
+    if (sigma.n > 0) {
+        {
+            Vector<real_t> sigma_file( filename + ".sigma" + tmp, sigma.n );
+            std::copy( sigma(0), sigma(0) + sigma.n, sigma_file(0) );
+        }
+        rename_file( filename + ".sigma" + tmp, filename + ".sigma" );
+    }
+    {
+        Matrix<scalar_t> A_file( filename + ".A" + tmp, A.m, A.n );
+        lapack::lacpy( lapack::MatrixType::General, A.m, A.n,
+                       A(0,0), A.ld, A_file(0,0), A_file.ld );
+    }
+    rename_file( filename + ".A" + tmp, filename + ".A" );
+}
+
 // -----------------------------------------------------------------------------
 /// Generates sigma vector of singular or eigenvalues, according to distribution.
 ///
@@ -159,9 +544,12 @@ void generate_sigma(
     }
 
     if (rand_sign) {
-        // apply random signs
+        // apply random signs, from iseed so the matrix is
+        // deterministic per seed
+        Vector<real_t> signs( minmn );
+        lapack::larnv( idist_rand, params.iseed, minmn, signs(0) );
         for (int64_t i = 0; i < minmn; ++i) {
-            if (rand() > RAND_MAX/2) {
+            if (signs[i] > 0.5) {
                 sigma[i] = -sigma[i];
             }
         }
@@ -258,7 +646,6 @@ void generate_svd(
     int64_t n = A.n;
     int64_t maxmn = std::max( m, n );
     int64_t minmn = std::min( m, n );
-    int64_t sizeU;
     int64_t info = 0;
     Matrix<scalar_t> U( maxmn, minmn );
     Vector<scalar_t> tau( minmn );
@@ -281,12 +668,8 @@ void generate_svd(
     // random U, m-by-minmn
     // just make each random column into a Householder vector;
     // no need to update subsequent columns (as in geqrf).
-    sizeU = U.size();
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < minmn; ++j) {
-        int64_t mj = m - j;
-        lapack::larfg( mj, U(j,j), U(j+1,j), 1, tau(j) );
-    }
+    larnv_parallel( idist_randn, params.iseed, U.m, U.n, U(0,0), U.ld );
+    householder_columns( m, minmn, U, tau );
 
     // A = U*A
     lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, A.m, A.n, minmn,
@@ -294,11 +677,8 @@ void generate_svd(
     require( info == 0 );
 
     // random V, n-by-minmn (stored column-wise in U)
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < minmn; ++j) {
-        int64_t nj = n - j;
-        lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
-    }
+    larnv_parallel( idist_randn, params.iseed, U.m, U.n, U(0,0), U.ld );
+    householder_columns( n, minmn, U, tau );
 
     // A = A*V^H
     lapack::unmqr( lapack::Side::Right, lapack::Op::ConjTrans, A.m, A.n, minmn,
@@ -325,6 +705,9 @@ void generate_svd(
             }
             printf( " ];\n" );
         }
+        #if defined(_OPENMP)
+        #pragma omp parallel for schedule( static )
+        #endif
         for (int64_t j = 0; j < A.n; ++j) {
             for (int64_t i = 0; i < A.m; ++i) {
                 *A(i,j) *= D[j];
@@ -356,7 +739,6 @@ void generate_heev(
 
     // locals
     int64_t n = A.n;
-    int64_t sizeU;
     int64_t info = 0;
     Matrix<scalar_t> U( n, n );
     Vector<scalar_t> tau( n );
@@ -367,12 +749,8 @@ void generate_heev(
     // random U, n-by-n
     // just make each random column into a Householder vector;
     // no need to update subsequent columns (as in geqrf).
-    sizeU = U.size();
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < n; ++j) {
-        int64_t nj = n - j;
-        lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
-    }
+    larnv_parallel( idist_randn, params.iseed, n, n, U(0,0), U.ld );
+    householder_columns( n, n, U, tau );
 
     // A = U*A
     lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, n, n, n,
@@ -398,6 +776,9 @@ void generate_heev(
         for (int64_t i = 0; i < n; ++i) {
             D[i] = exp( D[i] * range );
         }
+        #if defined(_OPENMP)
+        #pragma omp parallel for schedule( static )
+        #endif
         for (int64_t j = 0; j < n; ++j) {
             for (int64_t i = 0; i < n; ++i) {
                 *A(i,j) *= D[i] * D[j];
@@ -892,6 +1273,49 @@ void generate_matrix(
                  ansi_red, kind.c_str(), ansi_normal );
     }
 
+    // ----- look up cache, then files
+    // User-specified sigma is an input, so isn't cached.
+    // Empty matrices aren't stored in files, since they can't be mapped.
+    bool use_file = ! g_matrix_dir.empty() && dist != Dist::specified
+                    && A.m > 0 && A.n > 0;
+    bool use_cache = (g_matrix_cache.limit() > 0 && dist != Dist::specified)
+                     || use_file;
+    std::string cache_key;
+    int64_t iseed_save[4];
+    if (use_cache) {
+        std::copy( params.iseed, params.iseed + 4, iseed_save );
+        char precision = blas::is_complex< scalar_t >::value
+                       ? (sizeof( real_t ) == 4 ? 'c' : 'z')
+                       : (sizeof( real_t ) == 4 ? 's' : 'd');
+        char buf[ 256 ];
+        snprintf( buf, sizeof( buf ),
+                  "%c %lld %lld sigma %lld cond %.17g %.17g "
+                  "seed %lld %lld %lld %lld call %lld ",
+                  precision, llong( A.m ), llong( A.n ), llong( sigma.n ),
+                  params.cond(), params.condD(),
+                  llong( params.iseed[0] ), llong( params.iseed[1] ),
+                  llong( params.iseed[2] ), llong( params.iseed[3] ),
+                  llong( params.calls ) );
+        params.calls += 1;
+        cache_key = buf + kind;
+
+        auto entry = g_matrix_cache.find( cache_key );
+        if (entry != nullptr) {
+            lapack::lacpy( lapack::MatrixType::General, A.m, A.n,
+                           (scalar_t*) entry->A.data(), std::max( int64_t( 1 ), A.m ),
+                           A(0,0), A.ld );
+            if (sigma.n > 0)
+                std::memcpy( sigma(0), entry->sigma.data(), entry->sigma.size() );
+            return;
+        }
+        if (use_file && read_matrix_file( cache_key, A, sigma ))
+            return;
+
+        // seed for this call number, restored below
+        for (int64_t i = 0; i < params.calls - 1; ++i)
+            next_seed( params.iseed, params.iseed );
+    }
+
     // ----- generate matrix
     switch (type) {
         case TestMatrixType::zero:
@@ -916,11 +1340,10 @@ void generate_matrix(
         case TestMatrixType::randn: {
             //int64_t idist = (int64_t) type;
             int64_t idist = 1;
-            int64_t sizeA = A.ld * A.n;
-            lapack::larnv( idist, params.iseed, sizeA, A(0,0) );
+            larnv_parallel( idist, params.iseed, A.m, A.n, A(0,0), A.ld );
             if (sigma_max != 1) {
-                scalar_t scale = sigma_max;
-                blas::scal( sizeA, scale, A(0,0), 1 );
+                lapack::lascl( lapack::MatrixType::General, 0, 0,
+                               real_t( 1 ), sigma_max, A.m, A.n, A(0,0), A.ld );
             }
             break;
         }
@@ -960,6 +1383,26 @@ void generate_matrix(
         // reset sigma to unknown (nan)
         lapack::laset( lapack::MatrixType::General, sigma.n, 1, nan, nan, sigma(0), sigma.n );
     }
+
+    if (use_cache) {
+        if (g_matrix_cache.limit() > 0) {
+            MatrixCache::Entry entry;
+            entry.key = cache_key;
+            entry.A.resize( A.m * A.n * sizeof( scalar_t ) );
+            lapack::lacpy( lapack::MatrixType::General, A.m, A.n, A(0,0), A.ld,
+                           (scalar_t*) entry.A.data(), std::max( int64_t( 1 ), A.m ) );
+            entry.sigma.resize( sigma.n * sizeof( real_t ) );
+            if (sigma.n > 0)
+                std::memcpy( entry.sigma.data(), sigma(0), entry.sigma.size() );
+            g_matrix_cache.insert( std::move( entry ) );
+        }
+        if (use_file)
+            write_matrix_file( cache_key, A, sigma );
+
+        // same seed next time, to get the same matrix from the cache;
+        // params.calls makes the next call in this test differ
+        std::copy( iseed_save, iseed_save + 4, params.iseed );
+    }
 }
 
 
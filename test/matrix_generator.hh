@@ -7,6 +7,8 @@
 #define MATRIX_GENERATOR_HH
 
 #include <algorithm>  // copy, swap
+#include <cstdio>     // remove
+#include <string>
 
 #include "test.hh"
 #include "matrix_params.hh"
@@ -52,7 +54,17 @@ enum class Dist {
 };
 
 // -----------------------------------------------------------------------------
-/// Simple vector class that can wrap existing memory or allocate its own memory.
+void* map_file( std::string const& filename, size_t bytes, bool huge_pages );
+
+void const* map_file_read( std::string const& filename, size_t bytes );
+
+std::string tmp_file_suffix();
+
+void unmap_file( void const* data, size_t bytes );
+
+// -----------------------------------------------------------------------------
+/// Simple vector class that can wrap existing memory, allocate its own memory,
+/// or map a file into memory.
 //
 // Uses copy-and-swap idiom.
 // https://stackoverflow.com/questions/3279543/what-is-the-copy-and-swap-idiom
@@ -62,27 +74,47 @@ class Vector
 public:
     // constructor allocates new memory (unless n == 0)
     Vector( int64_t in_n=0 ):
-        n    ( in_n ),
-        data_( n > 0 ? new scalar_t[n] : nullptr ),
-        own_ ( true )
+        n      ( in_n ),
+        data_  ( n > 0 ? new scalar_t[n] : nullptr ),
+        own_   ( true ),
+        mapped_( false )
     {
         if (n < 0) { throw std::exception(); }
     }
 
     // constructor wraps existing memory; caller maintains ownership
     Vector( scalar_t* data, int64_t in_n ):
-        n    ( in_n ),
-        data_( data ),
-        own_ ( false )
+        n      ( in_n ),
+        data_  ( data ),
+        own_   ( false ),
+        mapped_( false )
     {
         if (n < 0) { throw std::exception(); }
     }
 
+    // constructor maps file into memory (unless n == 0), creating or
+    // resizing the file to n entries; writes go to the file.
+    // With huge_pages, advises the OS to back it with huge pages.
+    Vector( std::string const& filename, int64_t in_n, bool huge_pages=false ):
+        n      ( in_n ),
+        data_  ( nullptr ),
+        own_   ( true ),
+        mapped_( true )
+    {
+        if (n < 0) { throw std::exception(); }
+        if (n > 0) {
+            data_ = (scalar_t*) map_file( filename, n*sizeof(scalar_t),
+                                          huge_pages );
+        }
+    }
+
     // copy constructor
+    // copy of a mapped vector is in memory, not mapped
     Vector( Vector const &other ):
-        n    ( other.n ),
-        data_( nullptr ),
-        own_ ( other.own_ )
+        n      ( other.n ),
+        data_  ( nullptr ),
+        own_   ( other.own_ ),
+        mapped_( false )
     {
         if (other.own_) {
             if (n > 0) {
@@ -109,12 +141,19 @@ public:
         return *this;
     }
 
-    // destructor deletes memory if constructor allocated it
+    // destructor deletes memory if constructor allocated it,
+    // or unmaps the file if constructor mapped it
     // (i.e., not if wrapping existing memory)
     ~Vector()
     {
         if (own_) {
-            delete[] data_;
+            if (mapped_) {
+                if (data_ != nullptr)
+                    unmap_file( data_, n*sizeof(scalar_t) );
+            }
+            else {
+                delete[] data_;
+            }
             data_ = nullptr;
         }
     }
@@ -125,6 +164,7 @@ public:
         swap( first.n,     second.n     );
         swap( first.data_, second.data_ );
         swap( first.own_,  second.own_  );
+        swap( first.mapped_, second.mapped_ );
     }
 
     // returns pointer to element i, because that's what we normally need to
@@ -139,6 +179,7 @@ public:
 
     int64_t size() const { return n; }
     bool        own()  const { return own_; }
+    bool     mapped()  const { return mapped_; }
 
 public:
     int64_t n;
@@ -146,10 +187,12 @@ public:
 private:
     scalar_t *data_;
     bool own_;
+    bool mapped_;
 };
 
 // -----------------------------------------------------------------------------
-/// Simple matrix class that can wrap existing memory or allocate its own memory.
+/// Simple matrix class that can wrap existing memory, allocate its own memory,
+/// or map a file into memory.
 template< typename scalar_t >
 class Matrix
 {
@@ -180,8 +223,24 @@ public:
         if (ld < m) { throw std::exception(); }
     }
 
+    // constructor maps file into memory, for matrices that don't fit in
+    // memory or that are reused across runs; see Vector.
+    // ld = m by default
+    Matrix( std::string const& filename, int64_t in_m, int64_t in_n,
+            int64_t in_ld=0, bool huge_pages=false ):
+        m( in_m ),
+        n( in_n ),
+        ld( in_ld == 0 ? m : in_ld ),
+        data_( filename, ld*n, huge_pages )
+    {
+        if (m  < 0) { throw std::exception(); }
+        if (n  < 0) { throw std::exception(); }
+        if (ld < m) { throw std::exception(); }
+    }
+
     int64_t size() const { return data_.size(); }
     bool        own()  const { return data_.own(); }
+    bool     mapped()  const { return data_.mapped(); }
 
     // returns pointer to element (i,j), because that's what we normally need to
     // call BLAS / LAPACK, which avoids littering the code with &.
@@ -198,6 +257,26 @@ protected:
     Vector<scalar_t> data_;
 };
 
+// -----------------------------------------------------------------------------
+/// @return m-by-n matrix with leading dimension ld. If dir is not empty,
+/// it is mapped to a temporary file in dir, for sizes near the memory
+/// limit, advising huge pages if huge_pages is true; the file is removed
+/// once mapped, so it goes away with the matrix. Otherwise, the matrix
+/// is in memory. Used for the matrix under test with --mmap-dir.
+template< typename scalar_t >
+Matrix< scalar_t > make_matrix(
+    std::string const& dir, int64_t m, int64_t n, int64_t ld=0,
+    bool huge_pages=false )
+{
+    if (dir.empty())
+        return Matrix< scalar_t >( m, n, ld );
+
+    std::string filename = dir + "/lapackpp_matrix" + tmp_file_suffix();
+    Matrix< scalar_t > A( filename, m, n, ld, huge_pages );
+    std::remove( filename.c_str() );
+    return A;
+}
+
 // -----------------------------------------------------------------------------
 template< typename scalar_t >
 void generate_matrix(
@@ -214,6 +293,10 @@ void generate_matrix(
 
 void generate_matrix_usage();
 
+void set_matrix_cache_limit( int64_t bytes );
+
+void set_matrix_cache_dir( std::string const& dir );
+
 } // namespace lapack
 
 #endif        // #ifndef MATRIX_GENERATOR_HH
@@ -14,6 +14,7 @@ const double inf = std::numeric_limits<double>::infinity();
 MatrixParams::MatrixParams():
     verbose( 0 ),
     iseed {98, 108, 97, 115},
+    calls( 0 ),
 
     //          name,    w, p, type,            default,             min, max, help
     kind      ("matrix", 0,    ParamType::List, "rand",                        "test matrix kind; see 'test --help-matrix'" ),
@@ -34,3 +35,11 @@ void MatrixParams::mark()
     cond();
     condD();
 }
+
+// -----------------------------------------------------------------------------
+/// Resets the call number used in the matrix cache key. Called before
+/// each test, so each test gets the same sequence of cached matrices.
+void MatrixParams::reset_calls()
+{
+    calls = 0;
+}
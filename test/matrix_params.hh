@@ -15,10 +15,15 @@ public:
     MatrixParams();
 
     void mark();
+    void reset_calls();
 
     int64_t verbose;
     int64_t iseed[4];
 
+    // number of cached generate_matrix calls since reset_calls;
+    // part of the cache key and seed, so calls in one test get different matrices
+    int64_t calls;
+
     // ---- test matrix generation parameters
     testsweeper::ParamString kind;
     testsweeper::ParamScientific cond, cond_used;
@@ -19,6 +19,12 @@
 #
 # run getrf, potrf with small, medium sizes
 #     ./run_tests.py -s -m getrf potrf
+#
+# record performance of getrf, syevd to a baseline, e.g., before upgrading
+# the vendor BLAS/LAPACK, then compare a later run against it,
+# flagging cases more than 10% slower
+#     ./run_tests.py --type d --save-baseline base.json getrf heevd
+#     ./run_tests.py --type d --compare-baseline base.json --tolerance 10 getrf heevd
 
 from __future__ import print_function
 
@@ -30,6 +36,10 @@ import subprocess
 import xml.etree.ElementTree as ET
 import io
 import time
+import csv
+import json
+import math
+import tempfile
 
 # ------------------------------------------------------------------------------
 # command line arguments
@@ -44,6 +54,16 @@ group_test.add_argument( '--dry-run', action='store_true', help='print commands,
 group_test.add_argument( '--start',   action='store', help='routine to start with, helpful for restarting', default='' )
 group_test.add_argument( '-x', '--exclude', action='append', help='routines to exclude; repeatable', default=[] )
 
+group_perf = parser.add_argument_group( 'performance baseline (runs lapackpp_bench instead of tester)' )
+group_perf.add_argument( '--bench', action='store',
+    help='benchmark command to run; default "%(default)s"',
+    default='./lapackpp_bench' )
+group_perf.add_argument( '--save-baseline',    action='store', help='record Gflop/s of each case to baseline file' )
+group_perf.add_argument( '--compare-baseline', action='store', help='compare Gflop/s of each case to baseline file; slower cases fail' )
+group_perf.add_argument( '--tolerance',     action='store', type=float, help='allowed slowdown vs. baseline, in percent; default %(default)s', default=10 )
+group_perf.add_argument( '--bench-repeat',  action='store', type=int, help='timed runs of each case; default %(default)s', default=5 )
+group_perf.add_argument( '--bench-warmup',  action='store', type=int, help='untimed runs of each case; default %(default)s', default=1 )
+
 group_size = parser.add_argument_group( 'matrix dimensions (default is medium)' )
 group_size.add_argument( '--quick',  action='store_true', help='run quick "sanity check" of few, small tests' )
 group_size.add_argument( '--xsmall', action='store_true', help='run x-small tests' )
@@ -138,6 +158,7 @@ group_opt.add_argument( '--vu',     action='store', help='default=%(default)s',
 group_opt.add_argument( '--il',     action='store', help='default=%(default)s', default='10' )
 group_opt.add_argument( '--iu',     action='store', help='default=%(default)s', default='-1,100' )
 group_opt.add_argument( '--nb',     action='store', help='default=%(default)s', default='64' )
+group_opt.add_argument( '--batch',  action='store', help='default=%(default)s', default='100' )
 group_opt.add_argument( '--matrixtype', action='store', help='default=%(default)s', default='g,l,u' )
 
 parser.add_argument( 'tests', nargs=argparse.REMAINDER )
@@ -189,6 +210,10 @@ nk_tall  = dim
 nk_wide  = dim
 nk       = dim
 
+# small:: and interleaved kernels target n <= 16; small:: falls back for
+# larger n, so include a few.
+tiny     = dim if (opts.dim) else ' --dim 1:20'
+
 if (not opts.dim):
     if (opts.quick):
         n        = ' --dim 100'
@@ -309,6 +334,7 @@ sense  = ' --sense '  + opts.sense  if (opts.sense)  else ''
 vect   = ' --vect '   + opts.vect   if (opts.vect)   else ''
 l      = ' --l '      + opts.l      if (opts.l)      else ''
 nb     = ' --nb '     + opts.nb     if (opts.nb)     else ''
+batch  = ' --batch '  + opts.batch  if (opts.batch)  else ''
 ka     = ' --ka '     + opts.ka     if (opts.ka)     else ''
 kb     = ' --kb '     + opts.kb     if (opts.kb)     else ''
 kd     = ' --kd '     + opts.kd     if (opts.kd)     else ''
@@ -323,6 +349,9 @@ mtype  = ' --matrixtype ' + opts.matrixtype if (opts.matrixtype) else ''
 # general options for all routines
 gen = check + ref + verbose
 
+# matrix under test mapped to a temporary file, for testers that support it
+mmap = ' --mmap-dir ' + tempfile.gettempdir() + ' --huge-pages y'
+
 # ------------------------------------------------------------------------------
 # filters a comma separated list csv based on items in list values.
 # if no items from csv are in values, returns first item in values.
@@ -353,9 +382,15 @@ cmds = []
 if (opts.lu and opts.host):
     cmds += [
     [ 'gesv',  gen + dtype + align + n ],
+    [ 'gesv_batch', gen + dtype + align + n + batch ],
+    [ 'gesv_mixed', gen + dtype_double + align + n ],
     # todo: equed
     [ 'gesvx', gen + dtype + align + n + factored + trans ],
     [ 'getrf', gen + dtype + align + mn ],
+    [ 'getrf', gen + dtype + align + mn + mmap ],
+    [ 'getrf_batch', gen + dtype + align + mn + batch ],
+    [ 'getrf_small', gen + dtype + align + tiny + batch ],
+    [ 'getrf_interleaved', gen + dtype + tiny + trans + batch ],
     [ 'getrs', gen + dtype + align + n + trans ],
     [ 'getri', gen + dtype + align + n ],
     [ 'gecon', gen + dtype + align + n ],
@@ -394,7 +429,13 @@ if (opts.gt and opts.host):
 if (opts.chol and opts.host):
     cmds += [
     [ 'posv',  gen + dtype + align + n + uplo ],
+    [ 'posv_batch', gen + dtype + align + n + uplo + batch ],
+    [ 'posv_mixed', gen + dtype_double + align + n + uplo ],
     [ 'potrf', gen + dtype + align + n + uplo ],
+    [ 'potrf', gen + dtype + align + n + uplo + mmap ],
+    [ 'potrf_batch', gen + dtype + align + n + uplo + batch ],
+    [ 'potrf_small', gen + dtype + align + tiny + uplo + batch ],
+    [ 'potrf_interleaved', gen + dtype + tiny + uplo + batch ],
     [ 'potrs', gen + dtype + align + n + uplo ],
     [ 'potri', gen + dtype + align + n + uplo ],
     [ 'pocon', gen + dtype + align + n + uplo ],
@@ -430,6 +471,7 @@ if (opts.chol and opts.device):
     # GPU
     cmds += [
     [ 'dev-potrf', gen + dtype + align + n + uplo ],
+    [ 'dev-queue', gen + dtype + align + n + uplo ],
     ]
 
 # symmetric indefinite, Bunch-Kaufman
@@ -521,6 +563,8 @@ if (opts.qr and opts.host):
     cmds += [
     [ 'geqr',  gen + dtype + align + n + wide + tall ],
     [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf', gen + dtype + align + n + wide + tall + mmap ],
+    [ 'geqrf_batch', gen + dtype + align + n + wide + tall + batch ],
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
@@ -593,6 +637,9 @@ if (opts.syev and opts.host):
     [ 'heevd', gen + dtype + align + n + jobz + uplo ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + il + iu ],
+    [ 'sturm_bisect', gen + dtype_real + n ],
+    [ 'sturm_bisect', gen + dtype_real + n + vl + vu ],
+    [ 'sturm_bisect', gen + dtype_real + n + il + iu ],
     [ 'hetrd', gen + dtype + align + n + uplo ],
     [ 'ungtr', gen + dtype + align + n + uplo ],
     [ 'unmtr', gen + dtype_real    + align + mn + uplo + side + trans    ],  # real does trans = N, T, C
@@ -688,10 +735,21 @@ if (opts.svd and opts.host):
 # auxilary
 if (opts.aux and opts.host):
     cmds += [
+    [ 'lacp2', gen + dtype_complex + align + mn + uplo ],
     [ 'lacpy', gen + dtype + align + mn + mtype ],
     [ 'laed4', gen + dtype_real + n ],
+    [ 'lapy2', gen + dtype_real + n ],
+    [ 'lapy3', gen + dtype_real + n ],
+    [ 'larnv_philox', gen + dtype + align + mn ],
+    [ 'lartg', gen + dtype + n ],
+    [ 'lascl', gen + dtype + align + mn + mtype + kl + ku ],
     [ 'laset', gen + dtype + align + mn + mtype ],
+    [ 'lassq', gen + dtype + align + mn ],
     [ 'laswp', gen + dtype + align + mn ],
+    [ 'memory', gen + dtype + mn ],
+    [ 'trace', gen + dtype + align + mn ],
+    [ 'work_size_cache', gen + dtype + align + mn ],
+    [ 'workspace', gen + dtype + align + mn ],
     ]
 
 # auxilary - householder
@@ -783,6 +841,100 @@ def run_test( cmd ):
     return (err, output)
 # end
 
+# ------------------------------------------------------------------------------
+# Performance baseline.
+# Baseline file is JSON: { "cases": { key: gflops, ... } }, where key
+# identifies a case by routine, type, dimensions, and options, e.g.,
+# "getrf d m=100 n=100 k=100 nrhs= batch= options=".
+
+def case_keys( rows ):
+    keys = []
+    seen = {}
+    for row in rows:
+        key = '%s %s m=%s n=%s k=%s nrhs=%s batch=%s options=%s' % (
+              row['routine'], row['type'], row['m'], row['n'], row['k'],
+              row['nrhs'], row['batch'], row['options'] )
+        # cases that differ only in parameters the bench doesn't report
+        # (e.g., incx) get an ordinal to keep keys unique
+        seen[ key ] = seen.get( key, 0 ) + 1
+        if (seen[ key ] > 1):
+            key += ' #' + str( seen[ key ] )
+        keys.append( key )
+    return keys
+# end
+
+def row_gflops( row ):
+    try:
+        gflops = float( row['gflops'] )
+        return gflops if (math.isfinite( gflops )) else None
+    except ValueError:
+        return None
+# end
+
+# ------------------------------------------------------------------------------
+# cmd is a pair of strings: (function, args)
+# Runs cmd with lapackpp_bench, rather than tester.
+# Returns (err, output, results), where results is a list of (key, gflops).
+
+def run_bench( cmd ):
+    (fd, csv_file) = tempfile.mkstemp( suffix='.csv' )
+    os.close( fd )
+    cmd = opts.bench \
+        + ' --warmup ' + str( opts.bench_warmup ) \
+        + ' --repeat ' + str( opts.bench_repeat ) \
+        + ' --format csv --output ' + csv_file \
+        + ' ' + cmd[1] + ' ' + cmd[0]
+    print_tee( cmd )
+    if (opts.dry_run):
+        os.remove( csv_file )
+        return (None, None, [])
+
+    p = subprocess.Popen( cmd.split(), stdout=subprocess.PIPE,
+                                       stderr=subprocess.STDOUT )
+    p_out = p.stdout
+    if (sys.version_info.major >= 3):
+        p_out = io.TextIOWrapper(p.stdout, encoding='utf-8')
+    output = ''
+    for line in iter(p_out.readline, ''):
+        print( line, end='' )
+        output += line
+    err = p.wait()
+
+    with open( csv_file ) as f:
+        rows = list( csv.DictReader( f ) )
+    os.remove( csv_file )
+    results = list( zip( case_keys( rows ), map( row_gflops, rows ) ) )
+    if (err != 0):
+        print_tee( 'FAILED: exit code', err )
+    return (err, output, results)
+# end
+
+# ------------------------------------------------------------------------------
+# Compares results to baseline.
+# Returns list of regressed cases as (key, baseline gflops, gflops).
+
+def compare_baseline( results, baseline ):
+    regressions = []
+    tol = opts.tolerance / 100.
+    for (key, gflops) in results:
+        base = baseline.get( key )
+        if (base is None or gflops is None):
+            status = 'new' if (key not in baseline) else 'no data'
+        elif (gflops < base * (1 - tol)):
+            status = 'REGRESSION'
+            regressions.append( (key, base, gflops) )
+        elif (gflops > base * (1 + tol)):
+            status = 'faster'
+        else:
+            status = 'ok'
+        ratio = ('%6.2f' % (gflops / base)) if (base and gflops) else '    --'
+        print( '%-70s  %s  %s' % (key, ratio, status) )
+    for (key, base, gflops) in regressions:
+        print_tee( 'regression: %s: %.3g Gflop/s, baseline %.3g Gflop/s (%.0f%%)'
+                   % (key, gflops, base, 100 * (gflops / base - 1)) )
+    return regressions
+# end
+
 # ------------------------------------------------------------------------------
 # Utility to pretty print XML.
 # See https://stackoverflow.com/a/33956544/1655607
@@ -814,6 +966,13 @@ passed_tests = []
 ntests = len(opts.tests)
 run_all = (ntests == 0)
 
+bench_mode = bool( opts.save_baseline or opts.compare_baseline )
+baseline = {}
+if (opts.compare_baseline):
+    with open( opts.compare_baseline ) as f:
+        baseline = json.load( f )['cases']
+saved = {}
+
 seen = set()
 for cmd in cmds:
     if ((run_all or cmd[0] in opts.tests) and cmd[0] not in opts.exclude):
@@ -823,12 +982,32 @@ for cmd in cmds:
         start_routine = None
 
         seen.add( cmd[0] )
-        (err, output) = run_test( cmd )
+        if (bench_mode):
+            (err, output, results) = run_bench( cmd )
+            saved.update( results )
+            if (opts.compare_baseline and not err):
+                regressions = compare_baseline( results, baseline )
+                if (regressions):
+                    # report as failure with regressed cases as output
+                    output = '\n'.join(
+                        [ '%s: %.3g Gflop/s, baseline %.3g Gflop/s' % (key, gflops, base)
+                          for (key, base, gflops) in regressions ] )
+                    err = len( regressions )
+            if (not err and not opts.dry_run):
+                print_tee( 'pass' )
+        else:
+            (err, output) = run_test( cmd )
         if (err):
             failed_tests.append( (cmd[0], err, output) )
         else:
             passed_tests.append( cmd[0] )
 
+if (opts.save_baseline and not opts.dry_run):
+    print_tee( 'writing baseline', opts.save_baseline )
+    with open( opts.save_baseline, 'w' ) as f:
+        json.dump( { 'cases': saved }, f, indent=2, sort_keys=True )
+        f.write( '\n' )
+
 not_seen = list( filter( lambda x: x not in seen, opts.tests ) )
 if (not_seen):
     print_tee( 'Warning: unknown routines:', ' '.join( not_seen ))
@@ -74,6 +74,10 @@ const char* section_names[] = {
    "GPU device functions",
 };
 
+// check that all sections have names
+static_assert( sizeof(section_names)/sizeof(*section_names) == Section::num_sections,
+               "each section needs a name in section_names" );
+
 // { "", nullptr, Section::newline } entries force newline in help
 std::vector< testsweeper::routines_t > routines = {
     // -----
@@ -93,6 +97,13 @@ std::vector< testsweeper::routines_t > routines = {
     { "gttrf",              test_gttrf,     Section::gesv },
     { "",                   nullptr,        Section::newline },
 
+    { "gesv_batch",         test_gesv_batch, Section::gesv },
+    { "gesv_mixed",         test_gesv_mixed, Section::gesv },
+    { "getrf_batch",        test_getrf_batch, Section::gesv },
+    { "getrf_small",        test_getrf_small, Section::gesv },
+    { "getrf_interleaved",  test_getrf_interleaved, Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
     { "getrs",              test_getrs,     Section::gesv },
     { "gbtrs",              test_gbtrs,     Section::gesv },
     { "gttrs",              test_gttrs,     Section::gesv },
@@ -129,6 +140,13 @@ std::vector< testsweeper::routines_t > routines = {
     { "pttrf",              test_pttrf,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "posv_batch",         test_posv_batch, Section::posv },
+    { "posv_mixed",         test_posv_mixed, Section::posv },
+    { "potrf_batch",        test_potrf_batch, Section::posv },
+    { "potrf_small",        test_potrf_small, Section::posv },
+    { "potrf_interleaved",  test_potrf_interleaved, Section::posv },
+    { "",                   nullptr,        Section::newline },
+
     { "potrs",              test_potrs,     Section::posv },
     { "pptrs",              test_pptrs,     Section::posv },
     { "pbtrs",              test_pbtrs,     Section::posv },
@@ -254,6 +272,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "gemqrt",             test_gemqrt,    Section::qr }, // tested via LAPACKE
     { "",                   nullptr,        Section::newline },
 
+    { "geqrf_batch",        test_geqrf_batch, Section::qr },
+    { "",                   nullptr,        Section::newline },
+
     { "ggqrf",              test_ggqrf,     Section::qr }, // tested via LAPACKE using gcc/MKL, TODO for now use p=param.k
     //{ "gglqf",              test_gglqf,     Section::qr }, // TODO No automagic generation.  No src
     { "",                   nullptr,        Section::qr }, // space for gglqf
@@ -299,6 +320,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "hpev",               test_hpev,      Section::heev }, // tested via LAPACKE
     { "hbev",               test_hbev,      Section::heev }, // tested via LAPACKE
     { "sturm",              test_sturm,     Section::heev },
+    { "sturm_bisect",       test_sturm_bisect, Section::heev },
     { "",                   nullptr,        Section::newline },
 
     { "heevx",              test_heevx,     Section::heev }, // tested via LAPACKE
@@ -400,10 +422,21 @@ std::vector< testsweeper::routines_t > routines = {
 
     // -----
     // auxiliary
+    { "lacp2",              test_lacp2,     Section::aux },
     { "lacpy",              test_lacpy,     Section::aux },
     { "laed4",              test_laed4,     Section::aux },
+    { "lapy2",              test_lapy2,     Section::aux },
+    { "lapy3",              test_lapy3,     Section::aux },
+    { "larnv_philox",       test_larnv_philox, Section::aux },
+    { "lartg",              test_lartg,     Section::aux },
+    { "lascl",              test_lascl,     Section::aux },
     { "laset",              test_laset,     Section::aux },
+    { "lassq",              test_lassq,     Section::aux },
     { "laswp",              test_laswp,     Section::aux },
+    { "memory",             test_memory,    Section::aux },
+    { "trace",              test_trace,     Section::aux },
+    { "work_size_cache",    test_work_size_cache, Section::aux },
+    { "workspace",          test_workspace, Section::aux },
     { "",                   nullptr,        Section::newline },
 
     // auxiliary: Householder
@@ -461,6 +494,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "dev-potrf",          test_potrf_device,  Section::gpu },
     { "dev-getrf",          test_getrf_device,  Section::gpu },
     { "dev-geqrf",          test_geqrf_device,  Section::gpu },
+    { "dev-queue",          test_queue_device,  Section::gpu },
     { "",                   nullptr,            Section::newline },
 };
 
@@ -487,6 +521,10 @@ Params::Params():
     repeat    ( "repeat",  0,    ParamType::Value,   1,   1, 1000, "number of times to repeat each test" ),
     verbose   ( "verbose", 0,    ParamType::Value,   0,   0,   10, "verbose level" ),
     cache     ( "cache",   0,    ParamType::Value,  20,   1, 1024, "total cache size, in MiB" ),
+    gen_cache ( "gen-cache", 0,  ParamType::Value,   0,   0, 1000000, "cache for generated test matrices, in MiB; reuses the same matrix for the same kind, cond, size, and call in a test; 0 disables" ),
+    gen_dir   ( "gen-dir", 0,    ParamType::Value,  "",             "directory to store generated test matrices in, to reuse across runs via mmap; empty disables" ),
+    mmap_dir  ( "mmap-dir", 0,   ParamType::Value,  "",             "directory for a file mapping the matrix under test, for sizes near the memory limit (getrf, potrf, geqrf); empty keeps it in memory" ),
+    huge_pages( "huge-pages", 0, ParamType::Value, 'n', "ny",  "advise huge pages for --mmap-dir mappings" ),
 
     // ----- routine parameters
     //          name,      w,    type,            def,                    char2enum,         enum2char,         enum2str,         help
@@ -529,6 +567,7 @@ Params::Params():
     ku        ( "ku",      6,    ParamType::List, 100,     0, 1000000, "upper bandwidth" ),
     nrhs      ( "nrhs",    6,    ParamType::List,  10,     0, 1000000, "number of right hand sides" ),
     nb        ( "nb",      4,    ParamType::List,  64,     0, 1000000, "block size" ),
+    batch     ( "batch",   6,    ParamType::List, 100,     0, 1000000, "number of matrices in batch" ),
     vl        ( "vl",      7, 2, ParamType::List, -inf, -inf,     inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",      7, 2, ParamType::List,  inf, -inf,     inf, "upper bound of eigen/singular values to find" ),
 
@@ -548,6 +587,9 @@ Params::Params():
     align     ( "align",   0,    ParamType::List,   1,     1,    1024, "column alignment (sets lda, ldb, etc. to multiple of align)" ),
     device    ( "device",  6,    ParamType::List,   0,     0,     100, "device id" ),
 
+    // output threads set by tester's --threads sweep; see tester.cc
+    threads   ( "threads", 7,    ParamType::Output, 0,     0,  100000, "number of threads" ),
+
     // ----- output parameters
     // min, max are ignored
     //          name,            w, p, type,      default, min, max, help
@@ -566,6 +608,7 @@ Params::Params():
     time      ( "time (s)",      9, 3, PT_Output, no_data, 0, 0, "time to solution" ),
     gflops    ( "gflop/s",      12, 3, PT_Output, no_data, 0, 0, "Gflop/s rate" ),
     gbytes    ( "gbyte/s",      12, 3, PT_Output, no_data, 0, 0, "Gbyte/s rate" ),
+    efficiency( "eff.",          6, 2, PT_Output, no_data, 0, 0, "strong-scaling efficiency vs. first thread count" ),
     iters     ( "iters",         5,    PT_Output, 0,       0, 0, "iterations to solution" ),
 
     time2     ( "time (s)",      9, 3, PT_Output, no_data, 0, 0, "time to solution (2)" ),
@@ -607,6 +650,10 @@ Params::Params():
     repeat();
     verbose();
     cache();
+    gen_cache();
+    gen_dir();
+    mmap_dir();
+    huge_pages();
 
     // routine's parameters are marked by the test routine; see main
 }
@@ -663,165 +710,3 @@ void Params::get_range(
     *vl_arg = float(dvl);
     *vu_arg = float(dvu);
 }
-
-// -----------------------------------------------------------------------------
-// Compare a == b, bitwise. Returns true if a and b are both the same NaN value,
-// unlike (a == b) which is false for NaNs.
-bool same( double a, double b );
-
-bool same( double a, double b )
-{
-    return (memcmp( &a, &b, sizeof(double) ) == 0);
-}
-
-// -----------------------------------------------------------------------------
-// Prints line describing matrix kind and cond, if kind or cond changed.
-// Updates kind and cond to current values.
-void print_matrix_header(
-    MatrixParams& params, const char* caption,
-    std::string* matrix, double* cond, double* condD );
-
-void print_matrix_header(
-    MatrixParams& params, const char* caption,
-    std::string* matrix, double* cond, double* condD )
-{
-    if (params.kind.used() &&
-        (*matrix != params.kind() ||
-         ! same( *cond,  params.cond_used() ) ||
-         ! same( *condD, params.condD() )))
-    {
-        *matrix = params.kind();
-        *cond   = params.cond_used();
-        *condD  = params.condD();
-        printf( "%s: %s, cond(S) = ", caption, matrix->c_str() );
-        if (std::isnan( *cond ))
-            printf( "NA" );
-        else
-            printf( "%.2e", *cond );
-        if (! std::isnan(*condD))
-            printf( ", cond(D) = %.2e", *condD );
-        printf( "\n" );
-    }
-}
-
-// -----------------------------------------------------------------------------
-int main( int argc, char** argv )
-{
-    using testsweeper::QuitException;
-
-    // check that all sections have names
-    require( sizeof(section_names)/sizeof(*section_names) == Section::num_sections );
-
-    int status = 0;
-    try {
-        int version = lapack::lapackpp_version();
-        printf( "LAPACK++ version %d.%02d.%02d, id %s\n",
-                version / 10000, (version % 10000) / 100, version % 100,
-                lapack::lapackpp_id() );
-
-        // print input so running `test [input] > out.txt` documents input
-        printf( "input: %s", argv[0] );
-        for (int i = 1; i < argc; ++i) {
-            // quote arg if necessary
-            std::string arg( argv[i] );
-            const char* wordchars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-=";
-            if (arg.find_first_not_of( wordchars ) != std::string::npos)
-                printf( " '%s'", argv[i] );
-            else
-                printf( " %s", argv[i] );
-        }
-        printf( "\n" );
-
-        // Usage: test [params] routine
-        if (argc < 2
-            || strcmp( argv[argc-1], "-h" ) == 0
-            || strcmp( argv[argc-1], "--help" ) == 0)
-        {
-            usage( argc, argv, routines, section_names );
-            throw QuitException();
-        }
-
-        if (strcmp( argv[argc-1], "--help-matrix" ) == 0) {
-            lapack::generate_matrix_usage();
-            throw QuitException();
-        }
-
-        // find routine to test
-        const char* routine = argv[ argc-1 ];
-        testsweeper::test_func_ptr test_routine = find_tester( routine, routines );
-        if (test_routine == nullptr) {
-            usage( argc, argv, routines, section_names );
-            throw std::runtime_error(
-                std::string("routine ") + routine + " not found" );
-        }
-
-        // mark fields that are used (run=false)
-        Params params;
-        test_routine( params, false );
-
-        // Parse parameters up to routine name.
-        try {
-            params.parse( routine, argc-2, argv+1 );
-        }
-        catch (const std::exception& ex) {
-            params.help( routine );
-            throw;
-        }
-
-        // show align column if it has non-default values
-        if (params.align.size() != 1 || params.align() != 1) {
-            params.align.width( 5 );
-        }
-
-        // run tests
-        int repeat = params.repeat();
-        testsweeper::DataType last = params.datatype();
-        std::string matrix, matrixB;
-        double cond = 0, condD = 0, condB = 0, condD_B = 0;
-        params.header();
-        do {
-            if (params.datatype() != last) {
-                last = params.datatype();
-                printf( "\n" );
-            }
-            for (int iter = 0; iter < repeat; ++iter) {
-                try {
-                    test_routine( params, true );
-                }
-                catch (const std::exception& ex) {
-                    fprintf( stderr, "%s%sError: %s%s\n",
-                             ansi_bold, ansi_red, ex.what(), ansi_normal );
-                    params.okay() = false;
-                }
-                if (iter == 0) {
-                    print_matrix_header( params.matrix,  "test matrix A", &matrix,  &cond,  &condD   );
-                    print_matrix_header( params.matrixB, "test matrix B", &matrixB, &condB, &condD_B );
-                }
-                params.print();
-                fflush( stdout );
-                status += ! params.okay();
-                params.reset_output();
-            }
-            if (repeat > 1) {
-                printf( "\n" );
-            }
-        } while(params.next());
-
-        if (status) {
-            printf( "%d tests FAILED for %s.\n", status, routine );
-        }
-        else {
-            printf( "All tests passed for %s.\n", routine );
-        }
-    }
-    catch (const QuitException& ex) {
-        // pass: no error to print
-    }
-    catch (const std::exception& ex) {
-        fprintf( stderr, "\n%s%sError: %s%s\n",
-                 ansi_bold, ansi_red, ex.what(), ansi_normal );
-        status = -1;
-    }
-
-    return status;
-}
@@ -50,6 +50,10 @@ public:
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
     testsweeper::ParamInt    cache;
+    testsweeper::ParamInt    gen_cache;
+    testsweeper::ParamString gen_dir;
+    testsweeper::ParamString mmap_dir;
+    testsweeper::ParamChar   huge_pages;
 
     // ----- routine parameters
     testsweeper::ParamEnum< testsweeper::DataType > datatype;
@@ -85,6 +89,7 @@ public:
     testsweeper::ParamInt    ku;
     testsweeper::ParamInt    nrhs;
     testsweeper::ParamInt    nb;
+    testsweeper::ParamInt    batch;
     testsweeper::ParamDouble vl;
     testsweeper::ParamDouble vu;
     testsweeper::ParamInt    il;
@@ -99,6 +104,7 @@ public:
     testsweeper::ParamInt    incy;
     testsweeper::ParamInt    align;
     testsweeper::ParamInt    device;
+    testsweeper::ParamInt    threads;
 
     // ----- output parameters
     testsweeper::ParamScientific error;
@@ -113,6 +119,7 @@ public:
     testsweeper::ParamDouble     time;
     testsweeper::ParamDouble     gflops;
     testsweeper::ParamDouble     gbytes;
+    testsweeper::ParamDouble     efficiency;
     testsweeper::ParamInt        iters;
 
     testsweeper::ParamDouble     time2;
@@ -176,8 +183,13 @@ void require_( bool cond, const char* condstr, const char* file, int line )
 // LAPACK
 // LU, general
 void test_gesv  ( Params& params, bool run );
+void test_gesv_batch ( Params& params, bool run );
+void test_gesv_mixed ( Params& params, bool run );
 void test_gesvx ( Params& params, bool run );
 void test_getrf ( Params& params, bool run );
+void test_getrf_batch ( Params& params, bool run );
+void test_getrf_small ( Params& params, bool run );
+void test_getrf_interleaved ( Params& params, bool run );
 void test_getri ( Params& params, bool run );
 void test_getrs ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
@@ -204,8 +216,13 @@ void test_gtequ ( Params& params, bool run );
 
 // Cholesky
 void test_posv  ( Params& params, bool run );
+void test_posv_batch ( Params& params, bool run );
+void test_posv_mixed ( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_batch ( Params& params, bool run );
+void test_potrf_small ( Params& params, bool run );
+void test_potrf_interleaved ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
@@ -304,6 +321,7 @@ void test_ggglm ( Params& params, bool run );
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_geqrf_batch ( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
@@ -346,6 +364,7 @@ void test_heevd ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
 void test_sturm ( Params& params, bool run );
+void test_sturm_bisect ( Params& params, bool run );
 void test_ungtr ( Params& params, bool run );
 void test_unmtr ( Params& params, bool run );
 
@@ -417,10 +436,21 @@ void test_gejsv ( Params& params, bool run );
 void test_gesvj ( Params& params, bool run );
 
 // auxiliary
+void test_lacp2 ( Params& params, bool run );
 void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
+void test_lapy2 ( Params& params, bool run );
+void test_lapy3 ( Params& params, bool run );
+void test_larnv_philox( Params& params, bool run );
+void test_lartg ( Params& params, bool run );
+void test_lascl ( Params& params, bool run );
 void test_laset ( Params& params, bool run );
+void test_lassq ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
+void test_memory( Params& params, bool run );
+void test_trace ( Params& params, bool run );
+void test_work_size_cache( Params& params, bool run );
+void test_workspace( Params& params, bool run );
 
 // auxiliary - Householder
 void test_larfg ( Params& params, bool run );
@@ -469,5 +499,12 @@ void test_symv  ( Params& params, bool run );
 void test_potrf_device ( Params& params, bool run );
 void test_getrf_device ( Params& params, bool run );
 void test_geqrf_device ( Params& params, bool run );
+void test_queue_device ( Params& params, bool run );
+
+//----------------------------------------
+// routine table and section names, defined in test.cc,
+// shared by the tester and benchmark mains
+extern std::vector< testsweeper::routines_t > routines;
+extern const char* section_names[];
 
 #endif  //  #ifndef TEST_HH
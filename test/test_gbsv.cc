@@ -32,8 +32,8 @@ void test_gbsv_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
 
     if (! run)
         return;
@@ -83,8 +83,8 @@ void test_gbsv_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::gbsv( n, kl, ku, nrhs );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gbsv( n, kl, ku, nrhs );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( kd, n, &AB_tst[0], ldab );
@@ -126,7 +126,7 @@ void test_gbsv_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
     }
 }
 
@@ -27,8 +27,8 @@ void test_gbtrf_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
 
     if (! run)
         return;
@@ -58,11 +58,16 @@ void test_gbtrf_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::gbtrf( m, n, kl, ku );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gbtrf( m, n, kl, ku );
+    params.gflops() = gflop / time;
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
+        // ---------- run int32_t pivot overload, which must match
+        std::vector< scalar_t > AB_32 = AB_ref;
+        std::vector< int32_t > ipiv_32( size_ipiv );
+        int64_t info_32 = lapack::gbtrf( m, n, kl, ku, &AB_32[0], ldab, &ipiv_32[0] );
+
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
         int64_t info_ref = LAPACKE_gbtrf( m, n, kl, ku, &AB_ref[0], ldab, &ipiv_ref[0] );
@@ -72,15 +77,17 @@ void test_gbtrf_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
-        if (info_tst != info_ref) {
+        if (info_tst != info_ref || info_tst != info_32) {
             error = 1;
         }
         error += abs_error( AB_tst, AB_ref );
         error += abs_error( ipiv_tst, ipiv_ref );
+        error += abs_error( AB_32, AB_tst );
+        error += abs_error( ipiv_32, ipiv_tst );
         params.error() = error;
         params.okay() = (error == 0);  // expect lapackpp == lapacke
     }
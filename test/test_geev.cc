@@ -45,8 +45,8 @@ void test_geev_work( Params& params, bool run )
     params.error4();
     params.error5();
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
 
     params.error .name( "A' Vl - Vl W'" );
     params.error2.name( "Vl(j) norm" );
@@ -95,6 +95,28 @@ void test_geev_work( Params& params, bool run )
         printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
     }
 
+    // test error exits
+    if (params.error_exit() == 'y') {
+        // work (real) or rwork (complex) too short for the wrapper
+        lapack::WorkSizes sizes = lapack::geev_work_query(
+            jobvl, jobvr, n, &A_tst[0], lda, &W_tst[0],
+            &VL_tst[0], ldvl, &VR_tst[0], ldvr );
+        std::vector< scalar_t > work( sizes.lwork );
+        std::vector< real_t > rwork( sizes.lrwork );
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            assert_throw( lapack::geev_work(
+                jobvl, jobvr, n, &A_tst[0], lda, &W_tst[0],
+                &VL_tst[0], ldvl, &VR_tst[0], ldvr,
+                work.data(), sizes.lwork, rwork.data(), 2*n - 1 ), lapack::Error );
+        }
+        else {
+            assert_throw( lapack::geev_work(
+                jobvl, jobvr, n, &A_tst[0], lda, &W_tst[0],
+                &VL_tst[0], ldvl, &VR_tst[0], ldvr,
+                work.data(), 2*blas::max( 1, n ) - 1 ), lapack::Error );
+        }
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -107,8 +129,8 @@ void test_geev_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::geev( jobvl, jobvr, n );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::geev( jobvl, jobvr, n );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "W = " ); print_vector( n, &W_tst[0], 1 );
@@ -146,6 +168,40 @@ void test_geev_work( Params& params, bool run )
             params.error3() = results[2];
             params.error4() = results[3];
         }
+
+        // ---------- check _work overload gives the same results
+        // With arrays sized by _work_query, the real WR and WI fit at
+        // the end of work. work starts as NaN, so results can't depend
+        // on its contents.
+        std::vector< scalar_t > A_work = A_ref;
+        std::vector< std::complex<real_t> > W_work( size_W );
+        std::vector< scalar_t > VL_work( size_VL );
+        std::vector< scalar_t > VR_work( size_VR );
+        lapack::WorkSizes sizes = lapack::geev_work_query(
+            jobvl, jobvr, n, &A_work[0], lda, &W_work[0],
+            &VL_work[0], ldvl, &VR_work[0], ldvr );
+        std::vector< scalar_t > work(
+            sizes.lwork, std::numeric_limits< real_t >::quiet_NaN() );
+        std::vector< real_t > rwork( sizes.lrwork );
+        int64_t info_work;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            info_work = lapack::geev_work(
+                jobvl, jobvr, n, &A_work[0], lda, &W_work[0],
+                &VL_work[0], ldvl, &VR_work[0], ldvr,
+                work.data(), sizes.lwork, rwork.data(), sizes.lrwork );
+        }
+        else {
+            info_work = lapack::geev_work(
+                jobvl, jobvr, n, &A_work[0], lda, &W_work[0],
+                &VL_work[0], ldvl, &VR_work[0], ldvr,
+                work.data(), sizes.lwork );
+        }
+        real_t error_work = abs_error( A_work, A_tst )
+                          + abs_error( W_work, W_tst )
+                          + abs_error( VL_work, VL_tst )
+                          + abs_error( VR_work, VR_tst )
+                          + (info_work != info_tst);
+        okay = (okay && error_work == 0);
     }
 
     if (params.ref() == 'y') {
@@ -161,7 +217,7 @@ void test_geev_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         if (verbose >= 2) {
             printf( "// note: may be sorted differently than results above\n" );
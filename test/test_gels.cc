@@ -32,7 +32,8 @@ void test_gels_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -67,8 +68,8 @@ void test_gels_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::gels( trans, m, n, nrhs );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gels( m, n, nrhs );
+    params.gflops() = gflop / time;
 
     if (params.check() == 'y') {
         // ---------- check error
@@ -94,7 +95,7 @@ void test_gels_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
     }
 }
 
@@ -31,8 +31,8 @@ void test_gelsd_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -73,8 +73,8 @@ void test_gelsd_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::gelsd( m, n, nrhs );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gelsd( m, n, nrhs );
+    params.gflops() = gflop / time;
 
     if (params.check() == 'y') {
         // ---------- check error
@@ -100,7 +100,7 @@ void test_gelsd_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
     }
 }
 
@@ -31,6 +31,7 @@ void test_geqrf_work( Params& params, bool run )
     //params.ref_time();
     //params.ref_gflops();
     params.gflops();
+    params.gbytes();
     params.ortho();
 
     if (! run)
@@ -42,18 +43,22 @@ void test_geqrf_work( Params& params, bool run )
     size_t size_tau = (size_t)( blas::min( m, n ) );
     int64_t minmn = blas::min( m, n );
 
-    std::vector< scalar_t > A_tst( size_A );
-    std::vector< scalar_t > A_ref( size_A );
+    // A_tst is mapped to a file with --mmap-dir. A_ref is needed only to
+    // check or run the reference, so large runs without them fit in memory.
+    lapack::Matrix< scalar_t > A_tst = lapack::make_matrix< scalar_t >(
+        params.mmap_dir(), m, n, lda, params.huge_pages() == 'y' );
+    std::vector< scalar_t > A_ref;
     std::vector< scalar_t > tau_tst( size_tau );
     std::vector< scalar_t > tau_ref( size_tau );
 
-    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
-    A_ref = A_tst;
+    lapack::generate_matrix( params.matrix, m, n, A_tst(0,0), lda );
+    if (params.check() == 'y' || params.ref() == 'y')
+        A_ref.assign( A_tst(0,0), A_tst(0,0) + size_A );
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::geqrf( m, n, &A_tst[0], lda, &tau_tst[0] );
+    int64_t info_tst = lapack::geqrf( m, n, A_tst(0,0), lda, &tau_tst[0] );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_tst ) );
@@ -62,6 +67,8 @@ void test_geqrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::geqrf( m, n );
+    params.gbytes() = gbyte / time;
 
     if (params.check() == 'y') {
         // ---------- check error
@@ -75,7 +82,7 @@ void test_geqrf_work( Params& params, bool run )
         // Copy details of Q
         real_t rogue = -10000000000; // -1D+10
         lapack::laset( lapack::MatrixType::General, m, minmn, rogue, rogue, &Q[0], ldq );
-        lapack::lacpy( lapack::MatrixType::Lower, m, minmn, &A_tst[0], lda, &Q[0], ldq );
+        lapack::lacpy( lapack::MatrixType::Lower, m, minmn, A_tst(0,0), lda, &Q[0], ldq );
 
         // Generate the m-by-m matrix Q
         int64_t info_ungqr = lapack::ungqr( m, minmn, minmn, &Q[0], ldq, &tau_tst[0] );
@@ -85,7 +92,7 @@ void test_geqrf_work( Params& params, bool run )
 
         // Copy R
         lapack::laset( lapack::MatrixType::Lower, minmn, n, 0.0, 0.0, &R[0], ldr );
-        lapack::lacpy( lapack::MatrixType::Upper, minmn, n, &A_tst[0], lda, &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, minmn, n, A_tst(0,0), lda, &R[0], ldr );
 
         // Compute R - Q'*A
         blas::gemm( blas::Layout::ColMajor,
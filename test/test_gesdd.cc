@@ -24,6 +24,7 @@ void test_gesdd_work( Params& params, bool run )
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
     int64_t align = params.align();
+    int64_t verbose = params.verbose();
     params.matrix.mark();
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
@@ -31,8 +32,8 @@ void test_gesdd_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.ortho_U();
     params.ortho_V();
     params.error2();
@@ -63,6 +64,32 @@ void test_gesdd_work( Params& params, bool run )
     lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
     A_ref = A_tst;
 
+    // test error exits
+    if (params.error_exit() == 'y') {
+        // iwork shorter than 8 min( m, n ), which LAPACK requires
+        lapack::WorkSizes sizes = lapack::gesdd_work_query(
+            jobu, m, n, &A_tst[0], lda, &S_tst[0],
+            &U_tst[0], ldu, &VT_tst[0], ldvt );
+        std::vector< scalar_t > work( sizes.lwork );
+        std::vector< real_t > rwork( sizes.lrwork );
+        std::vector< lapack_int > iwork( sizes.liwork );
+        int64_t liwork = 8*blas::min( m, n ) - 1;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            assert_throw( lapack::gesdd_work(
+                jobu, m, n, &A_tst[0], lda, &S_tst[0],
+                &U_tst[0], ldu, &VT_tst[0], ldvt,
+                work.data(), sizes.lwork, rwork.data(), sizes.lrwork,
+                iwork.data(), liwork ), lapack::Error );
+        }
+        else {
+            assert_throw( lapack::gesdd_work(
+                jobu, m, n, &A_tst[0], lda, &S_tst[0],
+                &U_tst[0], ldu, &VT_tst[0], ldvt,
+                work.data(), sizes.lwork,
+                iwork.data(), liwork ), lapack::Error );
+        }
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -73,8 +100,8 @@ void test_gesdd_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::gesdd( jobu, m, n );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gesdd( jobu, m, n );
+    params.gflops() = gflop / time;
 
     // ---------- check numerical error
     // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
@@ -104,6 +131,39 @@ void test_gesdd_work( Params& params, bool run )
         }
         check_svd( jobu, jobu, m, n, &A_ref[0], lda,
                    &S_tst[0], U2, ldu2, VT2, ldvt2, errors );
+
+        // ---------- check _work overload gives the same results,
+        // with arrays sized by _work_query
+        std::vector< scalar_t > A_work = A_ref;
+        std::vector< real_t > S_work( size_S );
+        std::vector< scalar_t > U_work( size_U );
+        std::vector< scalar_t > VT_work( size_VT );
+        lapack::WorkSizes sizes = lapack::gesdd_work_query(
+            jobu, m, n, &A_work[0], lda, &S_work[0],
+            &U_work[0], ldu, &VT_work[0], ldvt );
+        std::vector< scalar_t > work( sizes.lwork );
+        std::vector< real_t > rwork( sizes.lrwork );
+        std::vector< lapack_int > iwork( sizes.liwork );
+        int64_t info_work;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            info_work = lapack::gesdd_work(
+                jobu, m, n, &A_work[0], lda, &S_work[0],
+                &U_work[0], ldu, &VT_work[0], ldvt,
+                work.data(), sizes.lwork, rwork.data(), sizes.lrwork,
+                iwork.data(), sizes.liwork );
+        }
+        else {
+            info_work = lapack::gesdd_work(
+                jobu, m, n, &A_work[0], lda, &S_work[0],
+                &U_work[0], ldu, &VT_work[0], ldvt,
+                work.data(), sizes.lwork,
+                iwork.data(), sizes.liwork );
+        }
+        if (abs_error( A_work, A_tst ) + abs_error( S_work, S_tst )
+            + abs_error( U_work, U_tst ) + abs_error( VT_work, VT_tst ) != 0
+            || info_work != info_tst) {
+            errors[3] = 1;
+        }
     }
 
     if (params.ref() == 'y') {
@@ -117,7 +177,7 @@ void test_gesdd_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         if (info_tst != info_ref) {
@@ -103,6 +103,17 @@ void test_gesv_work( Params& params, bool run )
     }
 
     if (params.check() == 'y') {
+        // ---------- check int32_t pivot overload gives the same solution
+        std::vector< scalar_t > A_32 = A_ref;
+        std::vector< scalar_t > B_32 = B_ref;
+        std::vector< int32_t > ipiv_32( size_ipiv );
+        int64_t info_32 = lapack::gesv( n, nrhs, &A_32[0], lda, &ipiv_32[0],
+                                        &B_32[0], ldb );
+        real_t error_32 = abs_error( A_32, A_tst )
+                        + abs_error( B_32, B_tst )
+                        + abs_error( ipiv_32, ipiv_tst )
+                        + (info_32 != info_tst);
+
         // ---------- check error
         // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
         blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
@@ -120,7 +131,7 @@ void test_gesv_work( Params& params, bool run )
         real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
         error /= (n * Anorm * Xnorm);
         params.error() = error;
-        params.okay() = (error < tol);
+        params.okay() = (error < tol && error_32 == 0);
     }
 
     if (params.ref() == 'y') {
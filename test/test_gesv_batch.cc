@@ -0,0 +1,210 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests gesv_batch_strided, and getrf_batch_strided + getrs_batch_strided.
+template< typename scalar_t >
+void test_gesv_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // Matrices are stored contiguously, stride_A or stride_B apart.
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t stride_A = lda * n;
+    int64_t stride_B = ldb * nrhs;
+    int64_t stride_ipiv = n;
+    size_t size_A = (size_t) stride_A * batch;
+    size_t size_B = (size_t) stride_B * batch;
+    size_t size_ipiv = (size_t) stride_ipiv * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_tst2( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_tst2( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_tst2( size_ipiv );
+    std::vector< int64_t > info_tst, info_tst2;
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*stride_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_tst2 = A_tst;
+    A_ref  = A_tst;
+    B_tst2 = B_tst;
+    B_ref  = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ), llong( batch ) );
+    }
+    if (verbose >= 2 && batch > 0) {
+        printf( "A[0] = " );
+        print_matrix( n, n, &A_tst[0], lda );
+        printf( "B[0] = " );
+        print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > info;
+        assert_throw( lapack::gesv_batch_strided( -1, nrhs, &A_tst[0], lda, stride_A, &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, stride_B, batch, info ), lapack::Error );
+        assert_throw( lapack::gesv_batch_strided(  n,   -1, &A_tst[0], lda, stride_A, &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, stride_B, batch, info ), lapack::Error );
+        assert_throw( lapack::gesv_batch_strided(  n, nrhs, &A_tst[0], n-1, stride_A, &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, stride_B, batch, info ), lapack::Error );
+        assert_throw( lapack::gesv_batch_strided(  n, nrhs, &A_tst[0], lda, stride_A, &ipiv_tst[0], stride_ipiv, &B_tst[0], n-1, stride_B, batch, info ), lapack::Error );
+        assert_throw( lapack::getrs_batch_strided( lapack::Op(0), n, nrhs, &A_tst[0], lda, stride_A, &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, stride_B, batch, info ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gesv_batch_strided( n, nrhs, &A_tst[0], lda, stride_A,
+                                &ipiv_tst[0], stride_ipiv,
+                                &B_tst[0], ldb, stride_B, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    // ---------- run factor and solve separately
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::getrf_batch_strided( n, n, &A_tst2[0], lda, stride_A,
+                                 &ipiv_tst2[0], stride_ipiv, batch, info_tst2 );
+    lapack::getrs_batch_strided( lapack::Op::NoTrans, n, nrhs,
+                                 &A_tst2[0], lda, stride_A,
+                                 &ipiv_tst2[0], stride_ipiv,
+                                 &B_tst2[0], ldb, stride_B, batch, info_tst2 );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    if (verbose >= 2 && batch > 0) {
+        printf( "A_factor[0] = " );
+        print_matrix( n, n, &A_tst[0], lda );
+        printf( "X[0] = " );
+        print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||),
+        // maximized over the batch and both solutions.
+        real_t error = 0;
+        std::vector< scalar_t > R( stride_B );
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*stride_A ];
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n, Ai, lda );
+            for (auto* X : { &B_tst, &B_tst2 }) {
+                scalar_t* Xi = &(*X)[ i*stride_B ];
+                std::copy( &B_ref[ i*stride_B ], &B_ref[ i*stride_B ] + stride_B,
+                           R.begin() );
+                blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                            n, nrhs, n,
+                            -one, Ai, lda,
+                                  Xi, ldb,
+                            one,  &R[0], ldb );
+                real_t err   = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+                real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+                err /= (n * Anorm * Xnorm);
+                error = blas::max( error, err );
+            }
+        }
+        bool info_okay = true;
+        for (int64_t i = 0; i < batch; ++i) {
+            info_okay = info_okay && info_tst[ i ] == 0 && info_tst2[ i ] == 0;
+        }
+        params.error() = error;
+        params.okay() = (error < tol) && info_okay;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: a loop of non-batched calls
+        std::vector< int64_t > ipiv_ref( size_ipiv );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = lapack::gesv( n, nrhs, &A_ref[ i*stride_A ], lda,
+                                             &ipiv_ref[ i*stride_ipiv ],
+                                             &B_ref[ i*stride_B ], ldb );
+            if (info_ref != 0) {
+                fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_ref ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gesv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
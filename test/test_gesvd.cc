@@ -33,8 +33,8 @@ void test_gesvd_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.ortho_U();
     params.ortho_V();
     params.error2();
@@ -98,8 +98,8 @@ void test_gesvd_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::gesvd( jobu, jobvt, m, n );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gesvd( jobu, jobvt, m, n );
+    params.gflops() = gflop / time;
 
     // ---------- check numerical error
     // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
@@ -145,7 +145,7 @@ void test_gesvd_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         if (info_tst != info_ref) {
@@ -37,8 +37,8 @@ void test_gesvdx_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.msg();
 
     if (! run)
@@ -84,8 +84,8 @@ void test_gesvdx_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::gesvdx( jobu, jobvt, range, m, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gesvdx( jobu, jobvt, m, n, ns_tst );
+    params.gflops() = gflop / time;
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
@@ -98,7 +98,7 @@ void test_gesvdx_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
@@ -32,6 +32,7 @@ void test_getrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.gbytes();
 
     if (! run)
         return;
@@ -41,13 +42,17 @@ void test_getrf_work( Params& params, bool run )
     size_t size_A = (size_t) lda * n;
     size_t size_ipiv = (size_t) (blas::min(m,n));
 
-    std::vector< scalar_t > A_tst( size_A );
-    std::vector< scalar_t > A_ref( size_A );
+    // A_tst is mapped to a file with --mmap-dir. A_ref is needed only to
+    // check or run the reference, so large runs without them fit in memory.
+    lapack::Matrix< scalar_t > A_tst = lapack::make_matrix< scalar_t >(
+        params.mmap_dir(), m, n, lda, params.huge_pages() == 'y' );
+    std::vector< scalar_t > A_ref;
     std::vector< int64_t > ipiv_tst( size_ipiv );
     std::vector< lapack_int > ipiv_ref( size_ipiv );
 
-    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
-    A_ref = A_tst;
+    lapack::generate_matrix( params.matrix, m, n, A_tst(0,0), lda );
+    if (params.check() == 'y' || params.ref() == 'y')
+        A_ref.assign( A_tst(0,0), A_tst(0,0) + size_A );
 
     if (verbose >= 1) {
         printf( "\n"
@@ -55,20 +60,20 @@ void test_getrf_work( Params& params, bool run )
                 llong( m ), llong( n ), llong( lda ) );
     }
     if (verbose >= 2) {
-        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "A = " ); print_matrix( m, n, A_tst(0,0), lda );
     }
 
     // test error exits
     if (params.error_exit() == 'y') {
-        assert_throw( lapack::getrf( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
-        assert_throw( lapack::getrf(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
-        assert_throw( lapack::getrf(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf( -1,  n, A_tst(0,0), lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf(  m, -1, A_tst(0,0), lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf(  m,  n, A_tst(0,0), m-1, &ipiv_tst[0] ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0] );
+    int64_t info_tst = lapack::getrf( m, n, A_tst(0,0), lda, &ipiv_tst[0] );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_tst ) );
@@ -77,12 +82,23 @@ void test_getrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::getrf( m, n );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::getrf( m, n );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 2) {
-        printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "A_factor = " ); print_matrix( m, n, A_tst(0,0), lda );
     }
 
     if (params.check() == 'y' && m == n) {
+        // ---------- check int32_t pivot overload gives the same factors
+        std::vector< scalar_t > A_32 = A_ref;
+        std::vector< int32_t > ipiv_32( size_ipiv );
+        int64_t info_32 = lapack::getrf( m, n, &A_32[0], lda, &ipiv_32[0] );
+        std::vector< scalar_t > A_fac( A_tst(0,0), A_tst(0,0) + size_A );
+        real_t error_32 = abs_error( A_32, A_fac )
+                        + abs_error( ipiv_32, ipiv_tst )
+                        + (info_32 != info_tst);
+
         // ---------- check error
         // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
         // For m != n, could check PA - LU.
@@ -97,7 +113,7 @@ void test_getrf_work( Params& params, bool run )
         B_ref = B_tst;
 
         info_tst = lapack::getrs(
-            lapack::Op::NoTrans, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb );
+            lapack::Op::NoTrans, n, nrhs, A_tst(0,0), lda, &ipiv_tst[0], &B_tst[0], ldb );
         if (info_tst != 0) {
             fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info_tst ) );
         }
@@ -116,7 +132,7 @@ void test_getrf_work( Params& params, bool run )
         real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
         error /= (n * Anorm * Xnorm);
         params.error() = error;
-        params.okay() = (error < tol);
+        params.okay() = (error < tol && error_32 == 0);
     }
 
     if (params.ref() == 'y') {
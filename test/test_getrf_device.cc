@@ -9,6 +9,7 @@
 #include "lapack/flops.hh"
 #include "print_matrix.hh"
 #include "error.hh"
+#include "device_memory.hh"
 #include "lapacke_wrappers.hh"
 
 #include <vector>
@@ -40,7 +41,7 @@ void test_getrf_device_work( Params& params, bool run )
     if (! run)
         return;
 
-    if (blas::get_device_count() == 0) {
+    if (! test_device_available()) {
         params.msg() = "skipping: no GPU devices or no GPU support";
         return;
     }
@@ -61,10 +62,10 @@ void test_getrf_device_work( Params& params, bool run )
 
     // Allocate and copy to GPU.
     lapack::Queue queue( device );
-    scalar_t*         dA_tst = blas::device_malloc< scalar_t >( size_A, queue );
-    device_pivot_int* d_ipiv = blas::device_malloc< device_pivot_int >( size_ipiv, queue );
-    device_info_int*  d_info = blas::device_malloc< device_info_int >( 1, queue );
-    blas::device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
+    scalar_t*         dA_tst = test_device_malloc< scalar_t >( size_A, queue );
+    device_pivot_int* d_ipiv = test_device_malloc< device_pivot_int >( size_ipiv, queue );
+    device_info_int*  d_info = test_device_malloc< device_info_int >( 1, queue );
+    test_device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
 
     if (verbose >= 1) {
         printf( "\n"
@@ -78,7 +79,7 @@ void test_getrf_device_work( Params& params, bool run )
     // Allocate workspace
     size_t d_size, h_size;
     lapack::getrf_work_size_bytes( m, n, dA_tst, lda, &d_size, &h_size, queue );
-    char* d_work = blas::device_malloc< char >( d_size, queue );
+    char* d_work = test_device_malloc< char >( d_size, queue );
     std::vector<char> h_work_vector( h_size );
     char* h_work = h_work_vector.data();
 
@@ -106,9 +107,9 @@ void test_getrf_device_work( Params& params, bool run )
 
     // Copy result back to CPU.
     device_info_int info_tst;
-    blas::device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
-    blas::device_memcpy( &info_tst, d_info, 1, queue );
-    blas::device_memcpy( &ipiv_tst[0], d_ipiv, size_ipiv, queue );
+    test_device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
+    test_device_memcpy( &info_tst, d_info, 1, queue );
+    test_device_memcpy( &ipiv_tst[0], d_ipiv, size_ipiv, queue );
     queue.sync();
 
     if (info_tst != 0) {
@@ -116,10 +117,10 @@ void test_getrf_device_work( Params& params, bool run )
     }
 
     // Cleanup GPU memory.
-    blas::device_free( dA_tst, queue );
-    blas::device_free( d_ipiv, queue );
-    blas::device_free( d_info, queue );
-    blas::device_free( d_work, queue );
+    test_device_free( dA_tst, queue );
+    test_device_free( d_ipiv, queue );
+    test_device_free( d_info, queue );
+    test_device_free( d_work, queue );
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
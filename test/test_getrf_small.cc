@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/small.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests small::getrf and small::getri on a batch of n-by-n matrices,
+// since a single tiny matrix is too fast to time.
+template< typename scalar_t >
+void test_getrf_small_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // Matrices are stored contiguously, stride_A apart.
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t stride_A = lda * n;
+    size_t size_A = (size_t) stride_A * batch;
+    size_t size_ipiv = (size_t) n * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_ref( size_ipiv );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*stride_A ], lda );
+    }
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2 && batch > 0) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::small::getrf( -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::small::getrf(  n, &A_tst[0], n-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::small::getri( -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::small::getri(  n, &A_tst[0], n-1, &ipiv_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    int64_t info_tst = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info = lapack::small::getrf( n, &A_tst[ i*stride_A ], lda,
+                                             &ipiv_tst[ i*n ] );
+        info_tst = blas::max( info_tst, info );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::small::getrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( n, n );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2 && batch > 0) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // ---------- run inverse
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info = lapack::small::getri( n, &A_tst[ i*stride_A ], lda,
+                                             &ipiv_tst[ i*n ] );
+        info_tst = blas::max( info_tst, info );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::small::getri returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time2() = time;
+    double gflop2 = batch * lapack::Gflop< scalar_t >::getri( n );
+    params.gflops2() = gflop2 / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // error = ||I - A A^{-1}|| / (n ||A|| ||A^{-1}||),
+        // maximized over the batch.
+        real_t error = 0;
+        std::vector< scalar_t > R( stride_A );
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai    = &A_ref[ i*stride_A ];
+            scalar_t* Ainvi = &A_tst[ i*stride_A ];
+            lapack::laset( lapack::MatrixType::General, n, n,
+                           zero, one, &R[0], lda );
+            blas::gemm( blas::Layout::ColMajor,
+                        blas::Op::NoTrans, blas::Op::NoTrans, n, n, n,
+                        -one, Ai, lda,
+                              Ainvi, lda,
+                        one,  &R[0], lda );
+            real_t Rnorm     = lapack::lange( lapack::Norm::Fro, n, n, &R[0], lda );
+            real_t Anorm     = lapack::lange( lapack::Norm::Fro, n, n, Ai,    lda );
+            real_t Ainv_norm = lapack::lange( lapack::Norm::Fro, n, n, Ainvi, lda );
+            error = blas::max( error, Rnorm / (n * Anorm * Ainv_norm) );
+        }
+        params.error() = error;
+        params.okay() = (error < tol) && (info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: the regular wrappers
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = lapack::getrf( n, n, &A_ref[ i*stride_A ], lda,
+                                              &ipiv_ref[ i*n ] );
+            if (info_ref != 0) {
+                fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_ref ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_small( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_small_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_small_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_small_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_small_work< std::complex<double> >( params, run );
+            break;
+    }
+}
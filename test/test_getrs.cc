@@ -52,6 +52,7 @@ void test_getrs_work( Params& params, bool run )
     int64_t iseed[4] = { 0, 1, 2, 3 };
     lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
     B_ref = B_tst;
+    std::vector< scalar_t > B_32 = B_tst;
 
     if (verbose >= 1) {
         printf( "\n"
@@ -113,12 +114,17 @@ void test_getrs_work( Params& params, bool run )
             printf( "B2ref = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
         }
 
+        // ---------- run int32_t pivot overload, which must match
+        std::vector< int32_t > ipiv_32( ipiv_tst.begin(), ipiv_tst.end() );
+        int64_t info_32 = lapack::getrs( trans, n, nrhs, &A[0], lda, &ipiv_32[0], &B_32[0], ldb );
+
         // ---------- check error compared to reference
         real_t error = 0;
-        if (info_tst != info_ref) {
+        if (info_tst != info_ref || info_tst != info_32) {
             error = 1;
         }
         error += abs_error( B_tst, B_ref );
+        error += abs_error( B_32, B_tst );
         params.error() = error;
         params.okay() = (error == 0);  // expect lapackpp == lapacke
     }
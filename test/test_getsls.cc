@@ -34,8 +34,8 @@ void test_getsls_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -70,8 +70,8 @@ void test_getsls_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::getsls( trans, m, n, nrhs );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::getsls( m, n, nrhs );
+    params.gflops() = gflop / time;
 
     if (params.check() == 'y') {
         // ---------- check error
@@ -97,7 +97,7 @@ void test_getsls_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
     }
 }
 
@@ -35,8 +35,8 @@ void test_hbev_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -79,8 +79,8 @@ void test_hbev_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::hbev( jobz, n, kd );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::hbev( jobz, n, kd );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "Lambda = " );
@@ -138,7 +138,7 @@ void test_hbev_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         if (verbose >= 2) {
             printf( "Lambda_ref" );
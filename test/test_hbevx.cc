@@ -42,8 +42,8 @@ void test_hbevx_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -96,8 +96,8 @@ void test_hbevx_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::hbevx( jobz, range, n, kd );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::hbevx( jobz, n, kd, nfound );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "nfound = %lld\n", llong( nfound ) );
@@ -159,7 +159,7 @@ void test_hbevx_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         if (verbose >= 2) {
             printf( "Lambda_ref" );
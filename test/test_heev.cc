@@ -34,8 +34,8 @@ void test_heev_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -74,8 +74,8 @@ void test_heev_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::heev( jobz, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::heev( jobz, n );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "Z = " ); print_matrix( n, n, &Z[0], ldz );
@@ -125,7 +125,7 @@ void test_heev_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = rel_error( Lambda_tst, Lambda_ref );
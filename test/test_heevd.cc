@@ -33,8 +33,8 @@ void test_heevd_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -73,8 +73,8 @@ void test_heevd_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::heevd( jobz, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::heevd( jobz, n );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "Z = " ); print_matrix( n, n, &Z[0], ldz );
@@ -111,6 +111,38 @@ void test_heevd_work( Params& params, bool run )
         params.okay() = (error < tol);
     }
 
+    if (params.check() == 'y') {
+        // ---------- check _work overload gives the same results,
+        // with arrays sized by _work_query (syevd_work for real)
+        std::vector< scalar_t > Z_work = A;
+        std::vector< real_t > Lambda_work( n );
+        int64_t info_work;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            lapack::WorkSizes sizes = lapack::heevd_work_query(
+                jobz, uplo, n, &Z_work[0], lda, &Lambda_work[0] );
+            std::vector< scalar_t > work( sizes.lwork );
+            std::vector< real_t > rwork( sizes.lrwork );
+            std::vector< lapack_int > iwork( sizes.liwork );
+            info_work = lapack::heevd_work(
+                jobz, uplo, n, &Z_work[0], lda, &Lambda_work[0],
+                work.data(), sizes.lwork, rwork.data(), sizes.lrwork,
+                iwork.data(), sizes.liwork );
+        }
+        else {
+            lapack::WorkSizes sizes = lapack::syevd_work_query(
+                jobz, uplo, n, &Z_work[0], lda, &Lambda_work[0] );
+            std::vector< scalar_t > work( sizes.lwork );
+            std::vector< lapack_int > iwork( sizes.liwork );
+            info_work = lapack::syevd_work(
+                jobz, uplo, n, &Z_work[0], lda, &Lambda_work[0],
+                work.data(), sizes.lwork, iwork.data(), sizes.liwork );
+        }
+        real_t error_work = abs_error( Z_work, Z )
+                          + abs_error( Lambda_work, Lambda_tst )
+                          + (info_work != info_tst);
+        params.okay() = params.okay() && (error_work == 0);
+    }
+
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
@@ -124,7 +156,7 @@ void test_heevd_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
@@ -40,8 +40,8 @@ void test_heevr_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -85,6 +85,33 @@ void test_heevr_work( Params& params, bool run )
         print_matrix( n, n, &A_tst[0], lda );
     }
 
+    // test error exits
+    #ifndef LAPACK_ILP64
+    if (params.error_exit() == 'y') {
+        // iwork without room for the 32-bit copy of isuppz at its end
+        int64_t liwork = 2*blas::max( 1, n ) - 1;
+        std::vector< scalar_t > work( 1 );
+        std::vector< real_t > rwork( 1 );
+        std::vector< lapack_int > iwork( liwork );
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            assert_throw( lapack::heevr_work(
+                jobz, range, uplo, n, &A_tst[0], lda,
+                vl, vu, il, iu, abstol, &nfound,
+                &Lambda_tst[0], &Z[0], ldz, &isuppz_tst[0],
+                work.data(), 1, rwork.data(), 1,
+                iwork.data(), liwork ), lapack::Error );
+        }
+        else {
+            assert_throw( lapack::syevr_work(
+                jobz, range, uplo, n, &A_tst[0], lda,
+                vl, vu, il, iu, abstol, &nfound,
+                &Lambda_tst[0], &Z[0], ldz, &isuppz_tst[0],
+                work.data(), 1,
+                iwork.data(), liwork ), lapack::Error );
+        }
+    }
+    #endif
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -98,8 +125,8 @@ void test_heevr_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::heevr( jobz, range, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::heevr( jobz, n, nfound );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "nfound = %lld\n", llong( nfound ) );
@@ -142,6 +169,60 @@ void test_heevr_work( Params& params, bool run )
         params.okay() = (error < tol);
     }
 
+    if (params.check() == 'y') {
+        // ---------- check _work overload gives the same results,
+        // with arrays sized by _work_query (syevr_work for real). In LP64
+        // builds, the 32-bit copy of isuppz is at the end of iwork.
+        std::vector< scalar_t > A_work = A_ref;
+        std::vector< scalar_t > Z_work( size_Z );
+        std::vector< real_t > Lambda_work( n );
+        std::vector< int64_t > isuppz_work( size_isuppz );
+        int64_t nfound_work;
+        int64_t info_work;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            lapack::WorkSizes sizes = lapack::heevr_work_query(
+                jobz, range, uplo, n, &A_work[0], lda,
+                vl, vu, il, iu, abstol, &nfound_work,
+                &Lambda_work[0], &Z_work[0], ldz, &isuppz_work[0] );
+            std::vector< scalar_t > work( sizes.lwork );
+            std::vector< real_t > rwork( sizes.lrwork );
+            std::vector< lapack_int > iwork( sizes.liwork );
+            info_work = lapack::heevr_work(
+                jobz, range, uplo, n, &A_work[0], lda,
+                vl, vu, il, iu, abstol, &nfound_work,
+                &Lambda_work[0], &Z_work[0], ldz, &isuppz_work[0],
+                work.data(), sizes.lwork, rwork.data(), sizes.lrwork,
+                iwork.data(), sizes.liwork );
+        }
+        else {
+            lapack::WorkSizes sizes = lapack::syevr_work_query(
+                jobz, range, uplo, n, &A_work[0], lda,
+                vl, vu, il, iu, abstol, &nfound_work,
+                &Lambda_work[0], &Z_work[0], ldz, &isuppz_work[0] );
+            std::vector< scalar_t > work( sizes.lwork );
+            std::vector< lapack_int > iwork( sizes.liwork );
+            info_work = lapack::syevr_work(
+                jobz, range, uplo, n, &A_work[0], lda,
+                vl, vu, il, iu, abstol, &nfound_work,
+                &Lambda_work[0], &Z_work[0], ldz, &isuppz_work[0],
+                work.data(), sizes.lwork,
+                iwork.data(), sizes.liwork );
+        }
+        real_t error_work = abs_error( A_work, A_tst )
+                          + abs_error( Lambda_work, Lambda_tst )
+                          + (info_work != info_tst)
+                          + (nfound_work != nfound);
+        if (jobz == lapack::Job::Vec) {
+            error_work += abs_error( Z_work, Z );
+            // isuppz is set for all eigenvectors
+            if (range == lapack::Range::All) {
+                for (int64_t i = 0; i < 2*nfound; ++i)
+                    error_work += (isuppz_work[ i ] != isuppz_tst[ i ]);
+            }
+        }
+        params.okay() = params.okay() && (error_work == 0);
+    }
+
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
@@ -157,7 +238,7 @@ void test_heevr_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
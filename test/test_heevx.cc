@@ -41,8 +41,8 @@ void test_heevx_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -93,8 +93,8 @@ void test_heevx_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::heevx( jobz, range, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::heevx( jobz, n, nfound );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "nfound = %lld\n", llong( nfound ) );
@@ -154,7 +154,7 @@ void test_heevx_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         if (verbose >= 2) {
             printf( "Lambda_ref" );
@@ -34,8 +34,8 @@ void test_hpev_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    // params.ref_gflops();
-    // params.gflops();
+    params.ref_gflops();
+    params.gflops();
     params.error2();
 
     if (! run)
@@ -71,8 +71,8 @@ void test_hpev_work( Params& params, bool run )
     }
 
     params.time() = time;
-    // double gflop = lapack::Gflop< scalar_t >::hpev( jobz, n );
-    // params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::hpev( jobz, n );
+    params.gflops() = gflop / time;
 
     if (verbose >= 2) {
         printf( "Z = " );
@@ -125,7 +125,7 @@ void test_hpev_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        // params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = rel_error( Lambda_tst, Lambda_ref );
@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Copies real A to complex B, so real_t is A's type.
+template< typename real_t >
+void test_lacp2_work( Params& params, bool run )
+{
+    using scalar_t = std::complex< real_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * n;
+
+    std::vector< real_t > A( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0],     lda );
+    lapack::generate_matrix( params.matrix, m, n, &B_tst[0], ldb );
+    B_ref = B_tst;
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::lacp2( uplo, m, n, &A[0], lda, &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "B = " ); print_matrix( m, n, &B_tst[0], ldb );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_lacp2( uplo2char(uplo), m, n, &A[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_lacp2 returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        error += abs_error( B_tst, B_ref );
+        params.error() = error;
+        params.okay() = (error == 0);  // expect lapackpp == lapacke
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lacp2( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+        case testsweeper::DataType::Double:
+            // mark params even though real B isn't supported,
+            // since the default type is used to mark params
+            test_lacp2_work< float >( params, false );
+            if (run)
+                params.msg() = "skipping: only complex B; use type c or z";
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lacp2_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lacp2_work< double >( params, run );
+            break;
+    }
+}
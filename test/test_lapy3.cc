@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename real_t >
+void test_lapy3_work( Params& params, bool run )
+{
+    // Constants
+    const real_t eps    = std::numeric_limits< real_t >::epsilon();
+    const real_t safmin = std::numeric_limits< real_t >::min();
+    const real_t big    = std::numeric_limits< real_t >::max() / 4;
+    const real_t rtmin  = std::sqrt( safmin );
+    const real_t rtmax  = std::sqrt( big );
+    const real_t inf    = std::numeric_limits< real_t >::infinity();
+    const real_t nan    = std::numeric_limits< real_t >::quiet_NaN();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // n triples (x, y, z), stored as columns of an n-by-3 matrix
+    int64_t lda = blas::max( 1, n );
+    size_t size_XYZ = (size_t) lda * 3;
+
+    std::vector< real_t > XYZ( size_XYZ );
+    std::vector< real_t > w_tst( n ), w_ref( n );
+
+    lapack::generate_matrix( params.matrix, n, 3, &XYZ[0], lda );
+    real_t* x = &XYZ[ 0 ];
+    real_t* y = &XYZ[ lda ];
+    real_t* z = &XYZ[ 2*lda ];
+
+    // cycle through values near underflow and overflow, zero, Inf, and NaN
+    for (int64_t i = 0; i < n; ++i) {
+        switch (i % 12) {
+            case  0: break;
+            case  1: x[ i ] *= safmin; break;
+            case  2: y[ i ] *= safmin; z[ i ] *= safmin; break;
+            case  3: x[ i ] *= big; break;
+            case  4: x[ i ] *= big; y[ i ] *= big; z[ i ] *= big; break;
+            case  5: x[ i ] *= safmin; y[ i ] *= big; break;
+            case  6: x[ i ] *= rtmin; y[ i ] *= rtmax; z[ i ] *= rtmin; break;
+            case  7: x[ i ] = 0; y[ i ] = 0; break;
+            case  8: x[ i ] = 0; y[ i ] = 0; z[ i ] = 0; break;
+            case  9: y[ i ] = inf; break;
+            case 10: z[ i ] = nan; break;
+            case 11: x[ i ] = inf; z[ i ] = nan; break;
+        }
+    }
+
+    if (verbose >= 2) {
+        printf( "x = " ); print_vector( n, x, 1 );
+        printf( "y = " ); print_vector( n, y, 1 );
+        printf( "z = " ); print_vector( n, z, 1 );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < n; ++i) {
+        w_tst[ i ] = lapack::lapy3( x[ i ], y[ i ], z[ i ] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "w = " ); print_vector( n, &w_tst[0], 1 );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < n; ++i) {
+            w_ref[ i ] = LAPACKE_lapy3( x[ i ], y[ i ], z[ i ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        if (verbose >= 2) {
+            printf( "wref = " ); print_vector( n, &w_ref[0], 1 );
+        }
+
+        // ---------- check error compared to reference
+        real_t error = max_rel_error( w_tst, w_ref );
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lapy3( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_lapy3_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lapy3_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+        case testsweeper::DataType::DoubleComplex:
+            params.msg() = "skipping: no complex version";
+            break;
+    }
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "threads.hh"
+#include "lapack.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the values of distribution idist are in range.
+// @return number of values out of range.
+template< typename scalar_t >
+int64_t larnv_philox_range( int64_t idist, std::vector< scalar_t > const& X )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    int64_t bad = 0;
+    for (auto const& x : X) {
+        real_t xr = std::real( x );
+        real_t xi = std::imag( x );
+        switch (idist) {
+            case 1:
+                bad += ! (0 < xr && xr < 1 && (xi == 0 || (0 < xi && xi < 1)));
+                break;
+            case 2:
+                bad += ! (-1 < xr && xr < 1 && -1 < xi && xi < 1);
+                break;
+            case 3:
+                bad += ! (std::isfinite( xr ) && std::isfinite( xi ));
+                break;
+            case 4:
+                bad += ! (std::abs( x ) < 1 + eps);
+                break;
+            case 5:
+                bad += ! (std::abs( std::abs( x ) - 1 ) < 4*eps);
+                break;
+        }
+    }
+    return bad;
+}
+
+// -----------------------------------------------------------------------------
+// @return |mean - mu| / (sigma / sqrt( N )) for the real and imaginary
+// parts of X, which is O(1) for N samples of distribution idist.
+template< typename scalar_t >
+double larnv_philox_zscore( int64_t idist, std::vector< scalar_t > const& X )
+{
+    // mean and variance of each of the real and imaginary parts
+    //                     idist: 1      2      3   4     5
+    const double mu[]  = { 0,     0.5,   0,     0,  0,    0   };
+    const double var[] = { 0,     1./12, 1./3,  1,  0.25, 0.5 };
+
+    double sum_r = 0, sum_i = 0;
+    for (auto const& x : X) {
+        sum_r += std::real( x );
+        sum_i += std::imag( x );
+    }
+    double N = X.size();
+    double z = std::abs( sum_r / N - mu[ idist ] ) / std::sqrt( var[ idist ] / N );
+    if (blas::is_complex< scalar_t >::value) {
+        z = std::max( z, std::abs( sum_i / N - mu[ idist ] )
+                         / std::sqrt( var[ idist ] / N ) );
+    }
+    return z;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_larnv_philox_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t idist_max = blas::is_complex< scalar_t >::value ? 5 : 3;
+    uint64_t seed = 1234;
+    uint64_t offset = 17;
+    size_t size_A = (size_t) lda * n;
+    size_t size_X = (size_t) m * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > X_tst( size_X ), X_ref( size_X );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::larnv_philox( 3, seed, offset, m, n, &A_tst[0], lda );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference, larnv's sequential generator
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t j = 0; j < n; ++j)
+            lapack::larnv( 3, iseed, m, &A_tst[ j*lda ] );
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        // ---------- check each distribution
+        // Values must not depend on the number of threads, and matrix and
+        // split vector fills must match one vector fill of the stream.
+        // Means must be within a few standard deviations.
+        int64_t nthreads = get_num_threads();
+        int64_t mismatch = 0;
+        double zscore = 0;
+        for (int64_t idist = 1; idist <= idist_max; ++idist) {
+            set_num_threads( 1 );
+            lapack::larnv_philox( idist, seed, offset, m*n, &X_ref[0] );
+            set_num_threads( nthreads );
+
+            lapack::larnv_philox( idist, seed, offset, m*n, &X_tst[0] );
+            mismatch += (X_tst != X_ref);
+
+            int64_t k = (m*n) / 3;
+            lapack::larnv_philox( idist, seed, offset, k, &X_tst[0] );
+            lapack::larnv_philox( idist, seed, offset + k, m*n - k, &X_tst[ k ] );
+            mismatch += (X_tst != X_ref);
+
+            lapack::larnv_philox( idist, seed, offset, m, n, &A_tst[0], lda );
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    mismatch += (A_tst[ i + j*lda ] != X_ref[ i + j*m ]);
+                }
+            }
+
+            mismatch += larnv_philox_range( idist, X_ref );
+            if (m*n > 0)
+                zscore = std::max( zscore, larnv_philox_zscore( idist, X_ref ) );
+
+            if (verbose >= 2) {
+                printf( "idist %lld: mismatch %lld, zscore %.2f\n",
+                        llong( idist ), llong( mismatch ), zscore );
+            }
+        }
+
+        // a z-score above 6 has probability about 2e-9
+        params.error() = zscore;
+        params.okay() = (mismatch == 0 && zscore < 6);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_larnv_philox( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_larnv_philox_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_larnv_philox_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_larnv_philox_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_larnv_philox_work< std::complex<double> >( params, run );
+            break;
+    }
+}
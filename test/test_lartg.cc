@@ -0,0 +1,156 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/safe_scaling.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_lartg_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps    = std::numeric_limits< real_t >::epsilon();
+    const real_t safmin = std::numeric_limits< real_t >::min();
+    const real_t big    = std::numeric_limits< real_t >::max() / 4;
+    const real_t rtmin  = std::sqrt( safmin );
+    const real_t rtmax  = std::sqrt( big );
+    const real_t inf    = std::numeric_limits< real_t >::infinity();
+    const real_t nan    = std::numeric_limits< real_t >::quiet_NaN();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // n pairs (f, g), stored as columns of an n-by-2 matrix
+    int64_t lda = blas::max( 1, n );
+    size_t size_FG = (size_t) lda * 2;
+
+    std::vector< scalar_t > FG( size_FG );
+    std::vector< real_t > c_tst( n ), c_ref( n ), c_batch( n );
+    std::vector< scalar_t > s_tst( n ), s_ref( n ), s_batch( n );
+    std::vector< scalar_t > r_tst( n ), r_ref( n ), r_batch( n );
+
+    lapack::generate_matrix( params.matrix, n, 2, &FG[0], lda );
+    scalar_t* f = &FG[ 0 ];
+    scalar_t* g = &FG[ lda ];
+
+    // cycle through values near underflow and overflow, zero, Inf, and NaN
+    for (int64_t i = 0; i < n; ++i) {
+        switch (i % 12) {
+            case  0: break;
+            case  1: f[ i ] *= safmin; break;
+            case  2: g[ i ] *= safmin; break;
+            case  3: f[ i ] *= big; break;
+            case  4: g[ i ] *= big; break;
+            case  5: f[ i ] *= safmin; g[ i ] *= big; break;
+            case  6: f[ i ] *= big; g[ i ] *= safmin; break;
+            case  7: f[ i ] *= rtmin; g[ i ] *= rtmax; break;
+            case  8: f[ i ] = 0; break;
+            case  9: g[ i ] = 0; break;
+            case 10: f[ i ] = inf; break;
+            case 11: g[ i ] = nan; break;
+        }
+    }
+
+    if (verbose >= 2) {
+        printf( "f = " ); print_vector( n, f, 1 );
+        printf( "g = " ); print_vector( n, g, 1 );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < n; ++i) {
+        lapack::lartg( f[ i ], g[ i ], &c_tst[ i ], &s_tst[ i ], &r_tst[ i ] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "c = " ); print_vector( n, &c_tst[0], 1 );
+        printf( "s = " ); print_vector( n, &s_tst[0], 1 );
+        printf( "r = " ); print_vector( n, &r_tst[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check batch version agrees with scalar version
+        lapack::safe::lartg_batch( n, f, g, &c_batch[0], &s_batch[0], &r_batch[0] );
+
+        real_t error2 = max_rel_error( c_batch, c_tst )
+                      + max_rel_error( s_batch, s_tst )
+                      + max_rel_error( r_batch, r_tst );
+        params.error2() = error2;
+        params.okay() = (error2 < tol);
+    }
+
+    // LAPACK 3.10 changed the signs of c, s, and r; older versions differ.
+    #if LAPACK_VERSION >= 31000
+        if (params.ref() == 'y' || params.check() == 'y') {
+            // ---------- run reference
+            testsweeper::flush_cache( params.cache() );
+            time = testsweeper::get_wtime();
+            for (int64_t i = 0; i < n; ++i) {
+                LAPACKE_lartg( f[ i ], g[ i ], &c_ref[ i ], &s_ref[ i ], &r_ref[ i ] );
+            }
+            time = testsweeper::get_wtime() - time;
+
+            params.ref_time() = time;
+
+            // ---------- check error compared to reference
+            real_t error = max_rel_error( c_tst, c_ref )
+                         + max_rel_error( s_tst, s_ref )
+                         + max_rel_error( r_tst, r_ref );
+            params.error() = error;
+            params.okay() = params.okay() && (error < tol);
+        }
+    #else
+        params.msg() = "skipping reference: needs LAPACK >= 3.10";
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+void test_lartg( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_lartg_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lartg_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lartg_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lartg_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_lascl_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::MatrixType;
+
+    // Constants
+    const real_t safmin = std::numeric_limits< real_t >::min();
+    const real_t huge   = std::numeric_limits< real_t >::max();
+    const real_t denorm = std::numeric_limits< real_t >::denorm_min();
+    const real_t inf    = std::numeric_limits< real_t >::infinity();
+    const real_t nan    = std::numeric_limits< real_t >::quiet_NaN();
+
+    // get & mark input values
+    lapack::MatrixType matrixtype = params.matrixtype();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t kl = params.kl();
+    int64_t ku = params.ku();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    bool sym_band = (matrixtype == MatrixType::LowerBand
+                     || matrixtype == MatrixType::UpperBand);
+    bool band = sym_band || matrixtype == MatrixType::Band;
+    if (sym_band && m != n) {
+        params.msg() = "skipping: symmetric band requires m == n";
+        return;
+    }
+
+    // ---------- setup
+    // bandwidths are limited by the matrix size; symmetric band uses kl = ku
+    kl = std::min( kl, blas::max( m - 1, 0 ) );
+    ku = std::min( ku, blas::max( n - 1, 0 ) );
+    if (sym_band)
+        kl = ku = std::min( kl, ku );
+    int64_t rows = (matrixtype == MatrixType::LowerBand ? kl + 1
+                 :  matrixtype == MatrixType::UpperBand ? ku + 1
+                 :  matrixtype == MatrixType::Band      ? 2*kl + ku + 1
+                 :  m);
+    int64_t lda = roundup( blas::max( 1, rows ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+
+    // fill all of A, so entries outside the band or triangle
+    // that must not change are checked, too
+    lapack::generate_matrix( params.matrix, lda, n, &A[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n" );
+        printf( "A m=%5lld, n=%5lld, kl=%5lld, ku=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( kl ), llong( ku ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( lda, n, &A[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::lascl( matrixtype, kl, ku,   0, 1, m, n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::lascl( matrixtype, kl, ku, nan, 1, m, n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::lascl( matrixtype, kl, ku, 1, nan, m, n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::lascl( matrixtype, kl, ku, 1, 2, -1,  n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::lascl( matrixtype, kl, ku, 1, 2,  m, -1, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::lascl( matrixtype, kl, ku, 1, 2,  m,  n, &A_tst[0], rows - 1 ), lapack::Error );
+        if (band) {
+            assert_throw( lapack::lascl( matrixtype, -1, ku, 1, 2, m, n, &A_tst[0], lda ), lapack::Error );
+            assert_throw( lapack::lascl( matrixtype, kl, -1, 1, 2, m, n, &A_tst[0], lda ), lapack::Error );
+            assert_throw( lapack::lascl( matrixtype, blas::max( m, 1 ), ku, 1, 2, m, n, &A_tst[0], lda ), lapack::Error );
+        }
+        if (sym_band) {
+            assert_throw( lapack::lascl( matrixtype, kl, ku, 1, 2, m, n+1, &A_tst[0], lda ), lapack::Error );
+            if (kl > 0) {
+                assert_throw( lapack::lascl( matrixtype, kl - 1, ku, 1, 2, m, n, &A_tst[0], lda ), lapack::Error );
+            }
+        }
+    }
+
+    // (cfrom, cto) pairs: no scaling; one multiplier; extreme values that
+    // need several multipliers; cto = 0; and Inf. As lascl requires,
+    // cto / cfrom doesn't overflow for |A(i,j)| <= 1.
+    std::vector< std::pair< real_t, real_t > > cfrom_cto = {
+        { 1, 1 }, { 2, 3 }, { 3, -0.5 },
+        { safmin, 1 }, { 1, safmin }, { huge, safmin }, { -huge, denorm },
+        { denorm, 2 * denorm / safmin }, { 1, 0 }, { -2, 0 },
+    #if LAPACK_VERSION >= 30700
+        { inf, 1 }, { -inf, 2 }, { 1, inf }, { inf, inf },
+    #endif
+    };
+
+    // ---------- run test
+    double time = 0;
+    double ref_time = 0;
+    real_t error = 0;
+    for (auto const& pair : cfrom_cto) {
+        real_t cfrom = pair.first;
+        real_t cto = pair.second;
+
+        A_tst = A;
+        testsweeper::flush_cache( params.cache() );
+        double t = testsweeper::get_wtime();
+        int64_t info_tst = lapack::lascl(
+            matrixtype, kl, ku, cfrom, cto, m, n, &A_tst[0], lda );
+        time += testsweeper::get_wtime() - t;
+        if (info_tst != 0) {
+            fprintf( stderr, "lapack::lascl returned error %lld\n", llong( info_tst ) );
+        }
+
+        if (params.ref() == 'y' || params.check() == 'y') {
+            // ---------- run reference
+            A_ref = A;
+            testsweeper::flush_cache( params.cache() );
+            t = testsweeper::get_wtime();
+            int64_t info_ref = LAPACKE_lascl(
+                matrixtype2char( matrixtype ), kl, ku, cfrom, cto, m, n,
+                &A_ref[0], lda );
+            ref_time += testsweeper::get_wtime() - t;
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_lascl returned error %lld\n", llong( info_ref ) );
+            }
+
+            // ---------- check error compared to reference
+            real_t error_pair = max_rel_error( A_tst, A_ref );
+            if (verbose >= 1) {
+                printf( "cfrom %.4e, cto %.4e, error %.2e\n",
+                        cfrom, cto, error_pair );
+            }
+            error = std::max( error, error_pair );
+        }
+    }
+
+    params.time() = time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        params.ref_time() = ref_time;
+        params.error() = error;
+        params.okay() = (error == 0);  // expect lapackpp == lapacke
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lascl( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_lascl_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lascl_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lascl_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lascl_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,209 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/safe_scaling.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns relative error of the sums of squares scale^2 sumsq, without
+// forming them, since implementations may choose different scale factors.
+// Sums that are both NaN, or both Inf, have no error.
+template< typename real_t >
+real_t lassq_error(
+    std::vector< real_t >& scale,     std::vector< real_t >& sumsq,
+    std::vector< real_t >& scale_ref, std::vector< real_t >& sumsq_ref )
+{
+    real_t error = 0;
+    for (size_t i = 0; i < scale.size(); ++i) {
+        real_t s = scale[ i ], s_ref = scale_ref[ i ];
+        real_t q = sumsq[ i ], q_ref = sumsq_ref[ i ];
+        bool nan     = std::isnan( s )     || std::isnan( q );
+        bool nan_ref = std::isnan( s_ref ) || std::isnan( q_ref );
+        bool inf     = std::isinf( s )     || std::isinf( q );
+        bool inf_ref = std::isinf( s_ref ) || std::isinf( q_ref );
+        real_t tmp;
+        if (nan || nan_ref)
+            tmp = (nan && nan_ref ? 0 : INFINITY);
+        else if (inf || inf_ref)
+            tmp = (inf && inf_ref ? 0 : INFINITY);
+        else if (q == 0 || q_ref == 0)
+            tmp = (q == q_ref ? 0 : 1);
+        else
+            tmp = std::abs( (s / s_ref) * std::sqrt( q / q_ref ) - 1 );
+        error = std::max( error, tmp );
+    }
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_lassq_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps    = std::numeric_limits< real_t >::epsilon();
+    const real_t safmin = std::numeric_limits< real_t >::min();
+    const real_t big    = std::numeric_limits< real_t >::max() / 4;
+    const real_t rtmin  = std::sqrt( safmin );
+    const real_t rtmax  = std::sqrt( big );
+    const real_t inf    = std::numeric_limits< real_t >::infinity();
+    const real_t nan    = std::numeric_limits< real_t >::quiet_NaN();
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    // sums of columns (incx = 1), then of rows (incx = lda)
+    std::vector< real_t > scale_tst( n + m ), sumsq_tst( n + m );
+    std::vector< real_t > scale_ref( n + m ), sumsq_ref( n + m );
+    std::vector< real_t > scale_batch( n ), sumsq_batch( n );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+
+    // cycle columns through values near underflow and overflow,
+    // a mix of small and large values, Inf, and NaN
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Aj = &A[ j*lda ];
+        for (int64_t i = 0; i < m; ++i) {
+            switch (j % 8) {
+                case 0: break;
+                case 1: Aj[ i ] *= safmin; break;
+                case 2: Aj[ i ] *= big; break;
+                case 3: Aj[ i ] *= rtmin; break;
+                case 4: Aj[ i ] *= rtmax; break;
+                case 5: Aj[ i ] *= (i % 2 == 0 ? safmin : big); break;
+                case 6: if (i == 0) Aj[ i ] = inf; break;
+                case 7: if (i == 0) Aj[ i ] = nan; break;
+            }
+        }
+    }
+
+    // cycle through initial sums: empty, moderate, and tiny
+    for (int64_t k = 0; k < n + m; ++k) {
+        switch (k % 3) {
+            case 0: scale_tst[ k ] = 1;      sumsq_tst[ k ] = 0; break;
+            case 1: scale_tst[ k ] = 2;      sumsq_tst[ k ] = 3; break;
+            case 2: scale_tst[ k ] = safmin; sumsq_tst[ k ] = 1; break;
+        }
+    }
+    scale_ref = scale_tst;
+    sumsq_ref = sumsq_tst;
+    std::copy( &scale_tst[0], &scale_tst[0] + n, &scale_batch[0] );
+    std::copy( &sumsq_tst[0], &sumsq_tst[0] + n, &sumsq_batch[0] );
+
+    if (verbose >= 1) {
+        printf( "\n" );
+        printf( "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t j = 0; j < n; ++j) {
+        lapack::lassq( m, &A[ j*lda ], 1, &scale_tst[ j ], &sumsq_tst[ j ] );
+    }
+    for (int64_t i = 0; i < m; ++i) {
+        lapack::lassq( n, &A[ i ], lda, &scale_tst[ n + i ], &sumsq_tst[ n + i ] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "scale = " ); print_vector( n + m, &scale_tst[0], 1 );
+        printf( "sumsq = " ); print_vector( n + m, &sumsq_tst[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check batch version agrees with scalar version
+        lapack::safe::lassq_batch( m, n, &A[0], lda,
+                                   &scale_batch[0], &sumsq_batch[0] );
+
+        std::vector< real_t > scale_col( &scale_tst[0], &scale_tst[0] + n );
+        std::vector< real_t > sumsq_col( &sumsq_tst[0], &sumsq_tst[0] + n );
+        real_t error2 = max_rel_error( scale_batch, scale_col )
+                      + max_rel_error( sumsq_batch, sumsq_col );
+        params.error2() = error2;
+        params.okay() = (error2 < tol);
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t j = 0; j < n; ++j) {
+            LAPACKE_lassq( m, &A[ j*lda ], 1, &scale_ref[ j ], &sumsq_ref[ j ] );
+        }
+        for (int64_t i = 0; i < m; ++i) {
+            LAPACKE_lassq( n, &A[ i ], lda, &scale_ref[ n + i ], &sumsq_ref[ n + i ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        if (verbose >= 2) {
+            printf( "scale_ref = " ); print_vector( n + m, &scale_ref[0], 1 );
+            printf( "sumsq_ref = " ); print_vector( n + m, &sumsq_ref[0], 1 );
+        }
+
+        // ---------- check error compared to reference
+        real_t error = lassq_error( scale_tst, sumsq_tst, scale_ref, sumsq_ref );
+        params.error() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lassq( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_lassq_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lassq_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lassq_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lassq_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -54,6 +54,7 @@ void test_laswp_work( Params& params, bool run )
         fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info ) );
     }
     A_ref = A_tst;
+    std::vector< scalar_t > A_orig = A_tst;
     std::copy( ipiv_tst.begin(), ipiv_tst.end(), ipiv_ref.begin() );
 
     // ---------- run test
@@ -82,6 +83,15 @@ void test_laswp_work( Params& params, bool run )
         // ---------- check error compared to reference
         real_t error = 0;
         error += abs_error( A_tst, A_ref );
+
+        // the Auto method above picks one of these; check both
+        for (auto method : { lapack::LaswpMethod::Swap,
+                             lapack::LaswpMethod::Permute }) {
+            A_tst = A_orig;
+            lapack::laswp( n, &A_tst[0], lda, k1, k2, &ipiv_tst[0], incx,
+                           method );
+            error += abs_error( A_tst, A_ref );
+        }
         params.error() = error;
         params.okay() = (error == 0);  // expect lapackpp == lapacke
     }
@@ -0,0 +1,224 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/memory.hh"
+#include "lapack/workspace.hh"
+#include "count_allocator.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <vector>
+
+#if ! defined( _WIN32 ) && ! defined( _WIN64 )
+    #include <errno.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// @return true if ptr is aligned to alignment bytes.
+inline bool is_aligned( void const* ptr, size_t alignment )
+{
+    return reinterpret_cast< uintptr_t >( ptr ) % alignment == 0;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_memory_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, m );
+    int64_t size_tau = blas::max( 1, blas::min( m, n ) );
+    const size_t batch = 4;
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A * batch ), A_save( size_A * batch );
+    std::vector< scalar_t > tau( size_tau );
+    std::vector< int64_t > ipiv( size_tau * batch );
+    std::vector< int64_t > info;
+
+    lapack::generate_matrix( params.matrix, m, n * batch, &A_save[0], lda );
+
+    int64_t error = 0;
+    double time = testsweeper::get_wtime();
+
+    // ---------- allocations go to the allocator of the innermost scope.
+    CountAllocator count1, count2;
+    {
+        lapack::AllocatorScope scope1( &count1 );
+        {
+            lapack::AllocatorScope scope2( &count2 );
+            error += (lapack::get_allocator() != &count2);
+        }
+        error += (lapack::get_allocator() != &count1);
+
+        A = A_save;
+        lapack::geqrf( m, n, &A[0], lda, &tau[0] );
+    }
+    error += (count1.allocs == 0) + (count2.allocs != 0);
+    error += (count1.deallocs != count1.allocs) + (count1.used != 0);
+
+    // Batch workers use the caller's allocator. getrf allocates only to
+    // copy ipiv to 32-bit integers.
+    #ifndef LAPACK_ILP64
+    {
+        CountAllocator count;
+        lapack::AllocatorScope scope( &count );
+        A = A_save;
+        lapack::getrf_batch_strided( m, n, &A[0], lda, size_A,
+                                     &ipiv[0], size_tau, batch, info );
+        error += (count.allocs < int64_t( batch ));
+        error += (count.deallocs != count.allocs);
+    }
+    #endif
+
+    // ---------- memory goes back to the allocator that allocated it,
+    // even after the scope changes.
+    CountAllocator count3, count4;
+    {
+        lapack::Workspace* workspace;
+        {
+            lapack::AllocatorScope scope( &count3 );
+            workspace = new lapack::Workspace( 1000 );
+        }
+        {
+            lapack::AllocatorScope scope( &count4 );
+            workspace->reset();
+            workspace->take< char >( 2000 );  // overflow block
+            workspace->reset();               // consolidate
+            delete workspace;
+        }
+    }
+    error += (count3.allocs != 3) + (count3.deallocs != 3) + (count3.used != 0);
+    error += (count4.allocs != 0) + (count4.deallocs != 0);
+
+    // ---------- LimitAllocator throws at its limit and tracks peak.
+    {
+        const size_t limit = 4096;
+        lapack::LimitAllocator limiter( limit );
+        lapack::AllocatorScope scope( &limiter );
+        lapack::Workspace workspace( limit / 2 );
+        workspace.take< char >( limit / 2 );
+        workspace.take< char >( limit / 4 );  // overflow block, fits
+        bool thrown = false;
+        try {
+            workspace.take< char >( limit / 2 );  // exceeds limit
+        }
+        catch (std::bad_alloc const&) {
+            thrown = true;
+        }
+        error += (! thrown);
+        error += (limiter.used() != limit / 2 + limit / 4);
+        workspace.release();
+        error += (limiter.used() != 0);
+        error += (limiter.peak() != limit / 2 + limit / 4);
+        error += (limiter.limit() != limit);
+    }
+
+    // ---------- alignment from the policy is honored,
+    // by the default allocator and passed to user allocators.
+    {
+        const size_t alignment = 4096;
+        lapack::AllocPolicy policy = lapack::get_alloc_policy();
+        policy.alignment = alignment;
+        lapack::AllocPolicyScope policy_scope( policy );
+        error += (lapack::get_alloc_policy().alignment != alignment);
+
+        lapack::Workspace workspace( 100 );
+        error += ! is_aligned( workspace.take< char >( 100 ), alignment );
+
+        CountAllocator count;
+        lapack::AllocatorScope scope( &count );
+        lapack::Workspace workspace2( 100 );
+        error += ! is_aligned( workspace2.take< char >( 100 ), alignment );
+        error += (count.last_alignment != alignment);
+    }
+    // Workspace arrays are aligned regardless of policy.
+    {
+        lapack::Workspace workspace;
+        for (int64_t i = 1; i < 10; ++i) {
+            error += ! is_aligned( workspace.take< char >( i ),
+                                   lapack::Workspace::alignment );
+        }
+    }
+
+    // ---------- arrays above huge_threshold are mapped,
+    // aligned to the huge page size, and unmapped when freed.
+    #if ! defined( _WIN32 ) && ! defined( _WIN64 )
+    {
+        const size_t huge_page_size = size_t( 2 ) << 20;
+        lapack::AllocPolicy policy = lapack::get_alloc_policy();
+        policy.huge_pages = lapack::HugePages::Transparent;
+        policy.huge_threshold = 1 << 16;
+
+        size_t page = size_t( sysconf( _SC_PAGESIZE ) );
+        size_t bytes = policy.huge_threshold + 1;
+        char* ptr = (char*) lapack::internal::allocate( bytes, policy );
+        error += ! is_aligned( ptr, huge_page_size );
+        std::fill( ptr, ptr + bytes, 1 );
+        lapack::internal::deallocate( ptr, bytes );
+        // msync fails with ENOMEM on an unmapped page.
+        error += (msync( ptr, page, MS_ASYNC ) == 0 || errno != ENOMEM);
+
+        // Through a Workspace, with the policy in a scope.
+        lapack::AllocPolicyScope policy_scope( policy );
+        lapack::Workspace workspace( bytes );
+        ptr = workspace.take< char >( bytes );
+        error += ! is_aligned( ptr, huge_page_size );
+        workspace.release();
+        error += (msync( ptr, page, MS_ASYNC ) == 0 || errno != ENOMEM);
+    }
+    #endif
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (verbose >= 1) {
+        printf( "allocs %lld, deallocs %lld\n",
+                llong( count1.allocs ), llong( count1.deallocs ) );
+    }
+
+    params.error() = error;
+    params.okay() = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_memory( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_memory_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_memory_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_memory_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_memory_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -32,6 +32,7 @@ void test_potrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.gbytes();
 
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
@@ -42,11 +43,15 @@ void test_potrf_work( Params& params, bool run )
     int64_t lda = roundup( blas::max( 1, n ), align );
     size_t size_A = (size_t) lda * n;
 
-    std::vector< scalar_t > A_tst( size_A );
-    std::vector< scalar_t > A_ref( size_A );
+    // A_tst is mapped to a file with --mmap-dir. A_ref is needed only to
+    // check or run the reference, so large runs without them fit in memory.
+    lapack::Matrix< scalar_t > A_tst = lapack::make_matrix< scalar_t >(
+        params.mmap_dir(), n, n, lda, params.huge_pages() == 'y' );
+    std::vector< scalar_t > A_ref;
 
-    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
-    A_ref = A_tst;
+    lapack::generate_matrix( params.matrix, n, n, A_tst(0,0), lda );
+    if (params.check() == 'y' || params.ref() == 'y')
+        A_ref.assign( A_tst(0,0), A_tst(0,0) + size_A );
 
     if (verbose >= 1) {
         printf( "\n"
@@ -54,21 +59,21 @@ void test_potrf_work( Params& params, bool run )
                 llong( n ), llong( lda ) );
     }
     if (verbose >= 2) {
-        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "A = " ); print_matrix( n, n, A_tst(0,0), lda );
     }
 
     // test error exits
     if (params.error_exit() == 'y') {
         using lapack::Uplo;
-        assert_throw( lapack::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
-        assert_throw( lapack::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
-        assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf( Uplo(0),  n, A_tst(0,0), lda ), lapack::Error );
+        assert_throw( lapack::potrf( uplo,    -1, A_tst(0,0), lda ), lapack::Error );
+        assert_throw( lapack::potrf( uplo,     n, A_tst(0,0), n-1 ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda );
+    int64_t info_tst = lapack::potrf( uplo, n, A_tst(0,0), lda );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
@@ -77,9 +82,11 @@ void test_potrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::potrf( n );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::potrf( n );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 2) {
-        printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "A_factor = " ); print_matrix( n, n, A_tst(0,0), lda );
     }
 
     if (params.check() == 'y') {
@@ -96,7 +103,7 @@ void test_potrf_work( Params& params, bool run )
         B_ref = B_tst;
 
         info_tst = lapack::potrs(
-            uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
+            uplo, n, nrhs, A_tst(0,0), lda, &B_tst[0], ldb );
         if (info_tst != 0) {
             fprintf( stderr, "lapack::potrs returned error %lld\n", llong( info_tst ) );
         }
@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    // Matrices are stored contiguously, stride_A apart.
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t stride_A = lda * n;
+    size_t size_A = (size_t) stride_A * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_tst2( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< int64_t > info_tst, info_tst2;
+
+    std::vector< scalar_t* > Aarray( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*stride_A ], lda );
+        Aarray[ i ] = &A_tst[ i*stride_A ];
+    }
+    A_tst2 = A_tst;
+    A_ref  = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2 && batch > 0) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > info;
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_batch( {Uplo(0)}, {n}, Aarray, {lda}, batch, info ), lapack::Error );
+        assert_throw( lapack::potrf_batch( {uplo}, {-1}, Aarray, {lda}, batch, info ), lapack::Error );
+        assert_throw( lapack::potrf_batch( {uplo}, {n}, Aarray, {n-1}, batch, info ), lapack::Error );
+        assert_throw( lapack::potrf_batch_strided( uplo, n, &A_tst[0], lda, stride_A-1, batch, info ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::potrf_batch( {uplo}, {n}, Aarray, {lda}, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::potrf_batch_strided( uplo, n, &A_tst2[0], lda, stride_A,
+                                 batch, info_tst2 );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    if (verbose >= 2 && batch > 0) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: a loop of non-batched calls
+        std::vector< int64_t > info_ref( batch );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::potrf( uplo, n, &A_ref[ i*stride_A ], lda );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        // ---------- check error
+        // Each matrix should match the non-batched result.
+        real_t error = 0;
+        bool okay = (info_tst == info_ref && info_tst2 == info_ref);
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai_ref = &A_ref[ i*stride_A ];
+            real_t Anorm = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                          n, n, Ai_ref, lda );
+            for (auto* A : { &A_tst, &A_tst2 }) {
+                scalar_t* Ai = &(*A)[ i*stride_A ];
+                blas::axpy( stride_A, -1.0, Ai_ref, 1, Ai, 1 );
+                real_t err = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                            n, n, Ai, lda );
+                if (Anorm != 0)
+                    err /= Anorm;
+                error = blas::max( error, err );
+            }
+        }
+        params.error() = error;
+        params.okay() = okay && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
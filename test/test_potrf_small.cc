@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/small.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests small::potrf and small::potrs on a batch of n-by-n matrices,
+// since a single tiny matrix is too fast to time.
+template< typename scalar_t >
+void test_potrf_small_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    // Matrices are stored contiguously, stride_A or stride_B apart.
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t stride_A = lda * n;
+    int64_t stride_B = ldb * nrhs;
+    size_t size_A = (size_t) stride_A * batch;
+    size_t size_B = (size_t) stride_B * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*stride_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ), llong( batch ) );
+    }
+    if (verbose >= 2 && batch > 0) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B[0] = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::small::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::small::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::small::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::small::potrs( Uplo(0),  n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::small::potrs( uplo,    -1, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::small::potrs( uplo,     n,   -1, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::small::potrs( uplo,     n, nrhs, &A_tst[0], n-1, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::small::potrs( uplo,     n, nrhs, &A_tst[0], lda, &B_tst[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    int64_t info_tst = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info = lapack::small::potrf( uplo, n, &A_tst[ i*stride_A ], lda );
+        info_tst = blas::max( info_tst, info );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::small::potrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+
+    // ---------- run solve
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::small::potrs( uplo, n, nrhs, &A_tst[ i*stride_A ], lda,
+                              &B_tst[ i*stride_B ], ldb );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    double gflop2 = batch * lapack::Gflop< scalar_t >::potrs( n, nrhs );
+    params.gflops2() = gflop2 / time;
+
+    if (verbose >= 2 && batch > 0) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "X[0] = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||),
+        // maximized over the batch.
+        real_t error = 0;
+        std::vector< scalar_t > R( stride_B );
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*stride_A ];
+            scalar_t* Xi = &B_tst[ i*stride_B ];
+            std::copy( &B_ref[ i*stride_B ], &B_ref[ i*stride_B ] + stride_B,
+                       R.begin() );
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -one, Ai, lda,
+                              Xi, ldb,
+                        one,  &R[0], ldb );
+            real_t err   = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            error = blas::max( error, err / (n * Anorm * Xnorm) );
+        }
+        params.error() = error;
+        params.okay() = (error < tol) && (info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: the regular wrappers
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = lapack::potrf( uplo, n, &A_ref[ i*stride_A ], lda );
+            if (info_ref != 0) {
+                fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_ref ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_small( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_small_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_small_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_small_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_small_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "device_memory.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks that device routines on one queue run in order, and that
+// syncing via a blas::Queue reference waits for them. Runs potrf, then
+// getrf on its output, which depends on potrf having finished, and
+// compares with running the host routines in sequence.
+template< typename scalar_t >
+void test_queue_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using lapack::device_pivot_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (! test_device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< device_pivot_int > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_ref( size_ipiv );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n",
+                llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    lapack::Queue queue( device );
+    scalar_t*         dA     = test_device_malloc< scalar_t >( size_A, queue );
+    device_pivot_int* d_ipiv = test_device_malloc< device_pivot_int >( size_ipiv, queue );
+    device_info_int*  d_info = test_device_malloc< device_info_int >( 2, queue );
+    test_device_copy_matrix( n, n, A_tst.data(), lda, dA, lda, queue );
+
+    size_t d_size, h_size;
+    lapack::getrf_work_size_bytes( n, n, dA, lda, &d_size, &h_size, queue );
+    char* d_work = test_device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // ---------- run test
+    // Code holding only the base class must be able to wait on the queue.
+    blas::Queue& base = queue;
+    base.sync();
+    double time = testsweeper::get_wtime();
+
+    lapack::potrf( uplo, n, dA, lda, &d_info[ 0 ], queue );
+    lapack::getrf( n, n, dA, lda, d_ipiv,
+                   d_work, d_size, h_work, h_size, &d_info[ 1 ], queue );
+
+    base.sync();
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst[ 2 ];
+    test_device_copy_matrix( n, n, dA, lda, A_tst.data(), lda, queue );
+    test_device_memcpy( info_tst, d_info, 2, queue );
+    test_device_memcpy( &ipiv_tst[0], d_ipiv, size_ipiv, queue );
+    base.sync();
+
+    test_device_free( dA, queue );
+    test_device_free( d_ipiv, queue );
+    test_device_free( d_info, queue );
+    test_device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Same routines in sequence on the host. When device routines
+        // run on the host, these match exactly; GPU libraries may round differently.
+        int64_t info_ref[ 2 ];
+        info_ref[ 0 ] = lapack::potrf( uplo, n, &A_ref[0], lda );
+        info_ref[ 1 ] = lapack::getrf( n, n, &A_ref[0], lda, &ipiv_ref[0] );
+
+        if (verbose >= 2) {
+            printf( "Aref_factor = " ); print_matrix( n, n, &A_ref[0], lda );
+        }
+
+        real_t error = abs_error( A_tst, A_ref );
+        real_t Anorm = lapack::lange( lapack::Norm::Fro, n, n, &A_ref[0], lda );
+        if (Anorm != 0)
+            error /= Anorm;
+        if (info_tst[ 0 ] != info_ref[ 0 ] || info_tst[ 1 ] != info_ref[ 1 ])
+            error = 1;
+
+        #if defined(LAPACK_DEVICE_ROUTINES_ON_HOST)
+            // Wrong order or an early return from sync changes the pivots.
+            if (abs_error( ipiv_tst, ipiv_ref ) != 0)
+                error = 1;
+            params.error() = error;
+            params.okay() = (error == 0);
+        #else
+            real_t eps = std::numeric_limits< real_t >::epsilon();
+            real_t tol = params.tol() * eps;
+            params.error() = error;
+            params.okay() = (error < tol);
+        #endif
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_queue_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_queue_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_queue_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_queue_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_queue_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
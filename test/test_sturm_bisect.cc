@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests sturm_bisect against sterf in double precision, and the
+// multi-shift sturm and sturm_slice against the single-shift sturm.
+template< typename scalar_t >
+void test_sturm_bisect_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+
+    real_t  vl;  // = params.vl();
+    real_t  vu;  // = params.vu();
+    int64_t il;  // = params.il();
+    int64_t iu;  // = params.iu();
+    lapack::Range range;  // derived from vl,vu,il,iu
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
+    // mark non-standard output values
+    params.time2();
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // Random tridiagonal T, entries uniform on (-1, 1).
+    std::vector< real_t > diag( n );
+    std::vector< real_t > offd( blas::max( 1, n-1 ) );
+    int64_t idist = 2;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, n, &diag[0] );
+    lapack::larnv( idist, iseed, n-1, &offd[0] );
+
+    if (range == lapack::Range::Value) {
+        // eigenvalues in [vl, vu)
+        il = lapack::sturm( n, &diag[0], &offd[0], vl ) + 1;
+        iu = lapack::sturm( n, &diag[0], &offd[0], vu );
+    }
+    int64_t m = blas::max( 0, iu - il + 1 );
+    std::vector< real_t > W( blas::max( 1, m ) );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "T n=%5lld, il=%5lld, iu=%5lld\n",
+                llong( n ), llong( il ), llong( iu ) );
+    }
+    if (verbose >= 2) {
+        printf( "diag = " ); print_vector( n, &diag[0], 1 );
+        printf( "offd = " ); print_vector( n-1, &offd[0], 1 );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > cnt( 1 );
+        assert_throw( lapack::sturm( -1, &diag[0], &offd[0], 1, &W[0], &cnt[0] ), lapack::Error );
+        assert_throw( lapack::sturm(  n, &diag[0], &offd[0], -1, &W[0], &cnt[0] ), lapack::Error );
+        assert_throw( lapack::sturm_slice( n, &diag[0], &offd[0], real_t( 1 ), real_t( 0 ), 1, &cnt[0] ), lapack::Error );
+        assert_throw( lapack::sturm_slice( n, &diag[0], &offd[0], real_t( 0 ), real_t( 1 ), 0, &cnt[0] ), lapack::Error );
+        assert_throw( lapack::sturm_bisect( n, &diag[0], &offd[0], 0, iu, real_t( 0 ), &W[0] ), lapack::Error );
+        assert_throw( lapack::sturm_bisect( n, &diag[0], &offd[0], il, n+1, real_t( 0 ), &W[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::sturm_bisect( n, &diag[0], &offd[0], il, iu, real_t( 0 ), &W[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "W = " ); print_vector( m, &W[0], 1 );
+    }
+
+    // ---------- run multi-shift counts, at the computed eigenvalues
+    std::vector< int64_t > count( blas::max( 1, m ) );
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::sturm( n, &diag[0], &offd[0], m, &W[0], &count[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Eigenvalues from sterf in double precision.
+        std::vector< double > D( diag.begin(), diag.end() );
+        std::vector< double > E( offd.begin(), offd.end() );
+        int64_t info = lapack::sterf( n, &D[0], &E[0] );
+        if (info != 0) {
+            fprintf( stderr, "lapack::sterf returned error %lld\n", llong( info ) );
+        }
+        // error = max_i |W_i - lambda_i| / ||T||
+        real_t Tnorm = lapack::lanst( lapack::Norm::One, n, &diag[0], &offd[0] );
+        real_t error = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            error = blas::max( error, real_t( std::abs( W[ i ] - D[ il-1 + i ] ) ) );
+        }
+        if (Tnorm != 0)
+            error /= Tnorm;
+        params.error() = error;
+
+        // error2 = number of counts that differ from the single-shift sturm,
+        // plus 1 if slices over a Gershgorin interval don't cover all of T.
+        int64_t count_errors = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            if (count[ i ] != lapack::sturm( n, &diag[0], &offd[0], W[ i ] ))
+                ++count_errors;
+        }
+        if (n > 0) {
+            int64_t nslices = 10;
+            std::vector< int64_t > slices( nslices );
+            real_t bound = 2*Tnorm + 1;
+            lapack::sturm_slice( n, &diag[0], &offd[0], -bound, bound,
+                                 nslices, &slices[0] );
+            int64_t total = 0;
+            for (int64_t k = 0; k < nslices; ++k)
+                total += slices[ k ];
+            if (total != n)
+                ++count_errors;
+        }
+        params.error2() = count_errors;
+        params.okay() = (error < tol) && (count_errors == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: single-shift sturm for each shift
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < m; ++i) {
+            count[ i ] = lapack::sturm( n, &diag[0], &offd[0], W[ i ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_sturm_bisect( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_sturm_bisect_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_sturm_bisect_work< double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unsupported datatype" );
+            break;
+    }
+}
@@ -60,6 +60,11 @@ void test_sytrf_work( Params& params, bool run )
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
+        // ---------- run int32_t pivot overload, which must match
+        std::vector< scalar_t > A_32 = A_ref;
+        std::vector< int32_t > ipiv_32( size_ipiv );
+        int64_t info_32 = lapack::sytrf( uplo, n, &A_32[0], lda, &ipiv_32[0] );
+
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
         int64_t info_ref = LAPACKE_sytrf( uplo2char(uplo), n, &A_ref[0], lda, &ipiv_ref[0] );
@@ -73,11 +78,13 @@ void test_sytrf_work( Params& params, bool run )
 
         // ---------- check error compared to reference
         real_t error = 0;
-        if (info_tst != info_ref) {
+        if (info_tst != info_ref || info_tst != info_32) {
             error = 1;
         }
         error += abs_error( A_tst, A_ref );
         error += abs_error( ipiv_tst, ipiv_ref );
+        error += abs_error( A_32, A_tst );
+        error += abs_error( ipiv_32, ipiv_tst );
         params.error() = error;
         params.okay() = (error == 0);  // expect lapackpp == lapacke
     }
@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "lapack/trace.hh"
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// @return number of fields of event that differ from those given.
+inline int64_t trace_check_event(
+    lapack::trace::Event const& event,
+    char const* routine, char precision,
+    int64_t m, int64_t n, int64_t k, double gflop, size_t work_bytes )
+{
+    return (strcmp( event.routine, routine ) != 0)
+         + (event.precision  != precision)
+         + (event.m != m) + (event.n != n) + (event.k != k)
+         + (! (event.time >= 0))
+         + (event.gflop      != gflop)
+         + (event.work_bytes != work_bytes);
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_trace_work( Params& params, bool run )
+{
+    using lapack::Gflop;
+    using lapack::trace::Event;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    if (! run)
+        return;
+
+    if (! lapack::trace::built_with_trace()) {
+        params.msg() = "skipping: built without use_trace";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * n;
+    size_t size_tau = (size_t) blas::max( 1, blas::min( m, n ) );
+
+    std::vector< scalar_t > A( size_A + 1 ), A_save( size_A + 1 );
+    std::vector< scalar_t > B( size_B + 1 );
+    std::vector< scalar_t > tau( size_tau );
+    std::vector< int64_t > ipiv( size_tau );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_save[0], lda );
+    // B = n I is Hermitian positive definite.
+    lapack::laset( lapack::MatrixType::General, n, n, 0, n, &B[0], ldb );
+
+    auto sizes = lapack::geqrf_work_query( m, n, &A[0], lda, &tau[0] );
+    std::vector< scalar_t > work( blas::max( 1, sizes.lwork ) );
+
+    // ---------- run test
+    // Record events in a vector, and in a ring buffer too small to hold
+    // them all, so it drops the oldest.
+    const size_t ring_capacity = 2;
+    lapack::trace::RingBuffer ring( ring_capacity );
+    std::mutex events_mutex;
+    std::vector< Event > events;
+    lapack::trace::set_sink( [&]( Event const& event ) {
+        std::lock_guard< std::mutex > lock( events_mutex );
+        events.push_back( event );
+        ring.push( event );
+    });
+    bool on = lapack::trace::is_on();
+
+    double time = testsweeper::get_wtime();
+
+    A = A_save;
+    lapack::getrf( m, n, &A[0], lda, &ipiv[0] );
+    lapack::potrf( lapack::Uplo::Lower, n, &B[0], ldb );
+    A = A_save;
+    lapack::geqrf_work( m, n, &A[0], lda, &tau[0], &work[0], sizes.lwork );
+    lapack::lange( lapack::Norm::One, m, n, &A_save[0], lda );
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    // Calls after turning tracing off aren't recorded.
+    lapack::trace::set_sink( nullptr );
+    bool off = ! lapack::trace::is_on();
+    A = A_save;
+    lapack::getrf( m, n, &A[0], lda, &ipiv[0] );
+
+    if (verbose >= 1) {
+        for (auto const& event : events) {
+            printf( "%c%-8s m %5lld, n %5lld, k %5lld, time %.2e, "
+                    "gflop %.2e, work %lld bytes\n",
+                    event.precision, event.routine,
+                    llong( event.m ), llong( event.n ), llong( event.k ),
+                    event.time, event.gflop, llong( event.work_bytes ) );
+        }
+    }
+
+    // ---------- check error
+    const char p = lapack::trace::internal::precision< scalar_t >();
+    int64_t error = (! on) + (! off);
+    if (events.size() != 4) {
+        error += 1;
+    }
+    else {
+        error += trace_check_event(
+            events[ 0 ], "getrf", p, m, n, 0,
+            Gflop< scalar_t >::getrf( m, n ), 0 );
+        error += trace_check_event(
+            events[ 1 ], "potrf", p, n, n, 0,
+            Gflop< scalar_t >::potrf( n ), 0 );
+        error += trace_check_event(
+            events[ 2 ], "geqrf", p, m, n, 0,
+            Gflop< scalar_t >::geqrf( m, n ),
+            sizes.lwork * sizeof(scalar_t) );
+        error += trace_check_event(
+            events[ 3 ], "lange", p, m, n, 0,
+            Gflop< scalar_t >::lange( lapack::Norm::One, m, n ), 0 );
+    }
+
+    // Ring buffer holds the newest events, oldest first, and drains.
+    std::vector< Event > ring_events = ring.drain();
+    if (ring_events.size() != ring_capacity
+        || ring.dropped() != events.size() - ring_capacity
+        || ring.drain().size() != 0) {
+        error += 1;
+    }
+    else {
+        for (size_t i = 0; i < ring_capacity; ++i) {
+            Event const& ref = events[ events.size() - ring_capacity + i ];
+            error += trace_check_event(
+                ring_events[ i ], ref.routine, ref.precision,
+                ref.m, ref.n, ref.k, ref.gflop, ref.work_bytes );
+        }
+    }
+
+    // Push from many threads: each event is kept or dropped exactly once.
+    const int64_t npush = 1000;
+    const size_t capacity = 64;
+    lapack::trace::RingBuffer ring2( capacity );
+    #if defined(_OPENMP)
+    #pragma omp parallel for
+    #endif
+    for (int64_t i = 0; i < npush; ++i) {
+        ring2.push( Event{ "push", p, i, 0, 0, 0, 0, 0 } );
+    }
+    ring_events = ring2.drain();
+    std::vector< int64_t > seen( npush, 0 );
+    for (auto const& event : ring_events) {
+        if (0 <= event.m && event.m < npush)
+            seen[ event.m ] += 1;
+    }
+    if (ring_events.size() != capacity
+        || ring2.dropped() != npush - capacity) {
+        error += 1;
+    }
+    for (int64_t i = 0; i < npush; ++i) {
+        error += (seen[ i ] > 1);
+    }
+
+    params.error() = error;
+    params.okay() = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_trace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_trace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/workspace.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// @return number of cache statistics that differ from those given.
+inline int64_t work_size_cache_check(
+    int64_t hits, int64_t misses, int64_t evictions, int64_t size )
+{
+    lapack::WorkSizeCacheStats stats = lapack::work_size_cache_stats();
+    return (stats.hits      != hits)
+         + (stats.misses    != misses)
+         + (stats.evictions != evictions)
+         + (stats.size      != size);
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_work_size_cache_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // Three shapes: m-by-n, (m+1)-by-n, and (m+2)-by-n.
+    int64_t lda = roundup( m + 2, align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_tau = (size_t) blas::max( 1, blas::min( m + 2, n ) );
+
+    std::vector< scalar_t > A_tst( size_A ), A_ref( size_A ), A_save( size_A );
+    std::vector< scalar_t > tau_tst( size_tau ), tau_ref( size_tau );
+
+    lapack::generate_matrix( params.matrix, m + 2, n, &A_save[0], lda );
+
+    lapack::Workspace workspace;
+    auto geqrf = [&]( int64_t mi ) {
+        A_tst = A_save;
+        tau_tst.assign( size_tau, 0 );
+        lapack::geqrf( mi, n, &A_tst[0], lda, &tau_tst[0], workspace );
+    };
+
+    // Results with the cache disabled.
+    int64_t capacity_save = lapack::work_size_cache_stats().capacity;
+    lapack::work_size_cache_set_capacity( 0 );
+    lapack::work_size_cache_clear();
+    geqrf( m );
+    A_ref = A_tst;
+    tau_ref = tau_tst;
+
+    int64_t error = work_size_cache_check( 0, 1, 0, 0 );
+    error += (lapack::work_size_cache_stats().capacity != 0);
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+
+    // Capacity 0 disables the cache: nothing is kept, so every call misses.
+    geqrf( m );
+    error += work_size_cache_check( 0, 2, 0, 0 );
+
+    // clear resets the counts.
+    lapack::work_size_cache_clear();
+    error += work_size_cache_check( 0, 0, 0, 0 );
+
+    // First call misses, then hits with the same result.
+    lapack::work_size_cache_set_capacity( 2 );
+    geqrf( m );
+    error += work_size_cache_check( 0, 1, 0, 1 );
+    geqrf( m );
+    error += work_size_cache_check( 1, 1, 0, 1 );
+    error += (abs_error( A_tst, A_ref ) != 0)
+           + (abs_error( tau_tst, tau_ref ) != 0);
+
+    // At capacity, the least recently used shape, m, is evicted.
+    geqrf( m + 1 );
+    error += work_size_cache_check( 1, 2, 0, 2 );
+    geqrf( m + 2 );
+    error += work_size_cache_check( 1, 3, 1, 2 );
+    geqrf( m + 1 );
+    error += work_size_cache_check( 2, 3, 1, 2 );
+    geqrf( m );
+    error += work_size_cache_check( 2, 4, 2, 2 );
+
+    // Shrinking the capacity evicts.
+    lapack::work_size_cache_set_capacity( 1 );
+    error += work_size_cache_check( 2, 4, 3, 1 );
+    geqrf( m );
+    error += work_size_cache_check( 3, 4, 3, 1 );
+    error += (abs_error( A_tst, A_ref ) != 0)
+           + (abs_error( tau_tst, tau_ref ) != 0);
+
+    if (verbose >= 1) {
+        lapack::WorkSizeCacheStats stats = lapack::work_size_cache_stats();
+        printf( "hits %lld, misses %lld, evictions %lld, size %lld, "
+                "capacity %lld\n",
+                llong( stats.hits ), llong( stats.misses ),
+                llong( stats.evictions ), llong( stats.size ),
+                llong( stats.capacity ) );
+    }
+
+    // clear empties the cache.
+    lapack::work_size_cache_clear();
+    error += work_size_cache_check( 0, 0, 0, 0 );
+    error += (lapack::work_size_cache_stats().capacity != 1);
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    lapack::work_size_cache_set_capacity( capacity_save );
+
+    params.error() = error;
+    params.okay() = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_work_size_cache( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_work_size_cache_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_work_size_cache_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_work_size_cache_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_work_size_cache_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
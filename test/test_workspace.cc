@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/workspace.hh"
+#include "error.hh"
+#include "count_allocator.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// @return number of arrays [ptr[i], ptr[i] + bytes[i]) that aren't aligned
+// to Workspace::alignment, or that overlap another array.
+inline int64_t workspace_check_arrays(
+    std::vector< char* > const& ptr, std::vector< size_t > const& bytes )
+{
+    int64_t error = 0;
+    for (size_t i = 0; i < ptr.size(); ++i) {
+        error += (uintptr_t( ptr[ i ] ) % lapack::Workspace::alignment != 0);
+        for (size_t j = i + 1; j < ptr.size(); ++j) {
+            error += (ptr[ i ] < ptr[ j ] + bytes[ j ]
+                      && ptr[ j ] < ptr[ i ] + bytes[ i ]);
+        }
+    }
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_workspace_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_tau = (size_t) blas::max( 1, blas::min( m, n ) );
+
+    std::vector< scalar_t > A_tst( size_A ), A_ref( size_A ), A_save( size_A );
+    std::vector< scalar_t > tau_tst( size_tau ), tau_ref( size_tau );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_save[0], lda );
+
+    A_ref = A_save;
+    lapack::geqrf( m, n, &A_ref[0], lda, &tau_ref[0] );
+
+    int64_t error = 0;
+    CountAllocator count;
+    lapack::AllocatorScope scope( &count );
+
+    // ---------- run test
+    // The first call allocates its arrays, and the second consolidates
+    // them into the arena. After that, calls of the same size reuse it
+    // without allocating or growing, and give the same result.
+    lapack::Workspace workspace;
+    const int64_t warmup = 2, calls = 5;
+    int64_t allocs = 0;
+    size_t capacity = 0, peak = 0;
+
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < warmup + calls; ++i) {
+        if (i == warmup) {
+            allocs   = count.allocs;
+            capacity = workspace.capacity();
+            peak     = workspace.peak();
+        }
+        A_tst = A_save;
+        lapack::geqrf( m, n, &A_tst[0], lda, &tau_tst[0], workspace );
+        if (i >= warmup) {
+            error += (abs_error( A_tst, A_ref ) != 0)
+                   + (abs_error( tau_tst, tau_ref ) != 0);
+        }
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    error += (count.allocs != allocs)
+           + (workspace.capacity() != capacity)
+           + (workspace.peak() != peak)
+           + (capacity < peak);
+
+    if (verbose >= 1) {
+        printf( "capacity %lld, peak %lld, allocs %lld\n",
+                llong( capacity ), llong( peak ), llong( count.allocs ) );
+    }
+
+    // ---------- arrays that don't fit in the arena go in overflow blocks;
+    // arrays already taken stay valid, and all are aligned.
+    lapack::Workspace workspace2( 100 );
+    error += (workspace2.capacity() != lapack::Workspace::round_up( 100 ));
+
+    std::vector< size_t > sizes = { 1, 100, 3, 65, 1000 };
+    std::vector< char* > ptr;
+    std::vector< size_t > bytes;
+    size_t total = 0;
+    int64_t allocs2 = count.allocs;
+    workspace2.reset();
+    for (size_t size : sizes) {
+        char* p = workspace2.take< char >( size );
+        std::fill( p, p + size, char( ptr.size() ) );
+        ptr.push_back( p );
+        bytes.push_back( size );
+        total += lapack::Workspace::round_up( size );
+    }
+    error += workspace_check_arrays( ptr, bytes );
+    for (size_t i = 0; i < ptr.size(); ++i) {
+        for (size_t k = 0; k < bytes[ i ]; ++k)
+            error += (ptr[ i ][ k ] != char( i ));
+    }
+    error += (count.allocs == allocs2)  // overflowed
+           + (workspace2.used() != total)
+           + (workspace2.peak() != total)
+           + (workspace2.capacity() != lapack::Workspace::round_up( 100 ));
+
+    // ---------- reset consolidates overflow blocks into one arena
+    // that holds the peak, so the same pass then fits without allocating.
+    int64_t deallocs2 = count.deallocs;
+    workspace2.reset();
+    error += (workspace2.capacity() != total)
+           + (workspace2.used() != 0)
+           + (count.deallocs <= deallocs2);  // freed overflow blocks
+
+    allocs2 = count.allocs;
+    ptr.clear();
+    for (size_t size : sizes) {
+        ptr.push_back( workspace2.take< char >( size ) );
+    }
+    error += workspace_check_arrays( ptr, bytes );
+    error += (count.allocs != allocs2)
+           + (workspace2.used() != total);
+
+    // ---------- release frees everything.
+    workspace.release();
+    workspace2.release();
+    error += (count.used != 0)
+           + (count.allocs != count.deallocs)
+           + (workspace2.capacity() != 0);
+
+    params.error() = error;
+    params.okay() = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_workspace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_workspace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_workspace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_workspace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_workspace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,265 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.hh"
+#include "threads.hh"
+
+// -----------------------------------------------------------------------------
+using testsweeper::ansi_bold;
+using testsweeper::ansi_red;
+using testsweeper::ansi_normal;
+
+// -----------------------------------------------------------------------------
+// Compare a == b, bitwise. Returns true if a and b are both the same NaN value,
+// unlike (a == b) which is false for NaNs.
+bool same( double a, double b );
+
+bool same( double a, double b )
+{
+    return (memcmp( &a, &b, sizeof(double) ) == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Prints line describing matrix kind and cond, if kind or cond changed.
+// Updates kind and cond to current values.
+void print_matrix_header(
+    MatrixParams& params, const char* caption,
+    std::string* matrix, double* cond, double* condD );
+
+void print_matrix_header(
+    MatrixParams& params, const char* caption,
+    std::string* matrix, double* cond, double* condD )
+{
+    if (params.kind.used() &&
+        (*matrix != params.kind() ||
+         ! same( *cond,  params.cond_used() ) ||
+         ! same( *condD, params.condD() )))
+    {
+        *matrix = params.kind();
+        *cond   = params.cond_used();
+        *condD  = params.condD();
+        printf( "%s: %s, cond(S) = ", caption, matrix->c_str() );
+        if (std::isnan( *cond ))
+            printf( "NA" );
+        else
+            printf( "%.2e", *cond );
+        if (! std::isnan(*condD))
+            printf( ", cond(D) = %.2e", *condD );
+        printf( "\n" );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Parses thread counts for --threads, as comma-separated list of
+// counts or start:end:step ranges, e.g., "1,2,4,8" or "4:32:4".
+std::vector< int64_t > parse_threads( const char* str )
+{
+    std::vector< int64_t > list;
+    std::string s( str );
+    size_t start = 0;
+    while (start < s.size()) {
+        size_t end = s.find( ',', start );
+        if (end == std::string::npos)
+            end = s.size();
+        std::string item = s.substr( start, end - start );
+        long long first, last, step;
+        int cnt = sscanf( item.c_str(), "%lld:%lld:%lld", &first, &last, &step );
+        if (cnt == 1) {
+            last = first;
+            step = 1;
+        }
+        else if (cnt == 2) {
+            step = 1;
+        }
+        if (cnt < 1 || first < 1 || last < first || step < 1) {
+            throw std::runtime_error(
+                "invalid --threads '" + item + "'; counts must be >= 1" );
+        }
+        for (long long t = first; t <= last; t += step)
+            list.push_back( t );
+        start = end + 1;
+    }
+    return list;
+}
+
+// -----------------------------------------------------------------------------
+int main( int argc, char** argv )
+{
+    using testsweeper::QuitException;
+
+    int status = 0;
+    try {
+        int version = lapack::lapackpp_version();
+        printf( "LAPACK++ version %d.%02d.%02d, id %s\n",
+                version / 10000, (version % 10000) / 100, version % 100,
+                lapack::lapackpp_id() );
+
+        // print input so running `test [input] > out.txt` documents input
+        printf( "input: %s", argv[0] );
+        for (int i = 1; i < argc; ++i) {
+            // quote arg if necessary
+            std::string arg( argv[i] );
+            const char* wordchars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-=";
+            if (arg.find_first_not_of( wordchars ) != std::string::npos)
+                printf( " '%s'", argv[i] );
+            else
+                printf( " %s", argv[i] );
+        }
+        printf( "\n" );
+
+        // Remove --threads list, which the tester handles itself
+        // by running each test for each thread count.
+        std::vector< int64_t > thread_list;
+        std::vector< char* > args( argv, argv + argc );
+        for (size_t i = 1; i + 1 < args.size(); ++i) {
+            if (strcmp( args[ i ], "--threads" ) == 0) {
+                thread_list = parse_threads( args[ i+1 ] );
+                args.erase( args.begin() + i, args.begin() + i + 2 );
+                --i;
+            }
+        }
+        argc = int( args.size() );
+        argv = args.data();
+
+        // Usage: test [params] routine
+        if (argc < 2
+            || strcmp( argv[argc-1], "-h" ) == 0
+            || strcmp( argv[argc-1], "--help" ) == 0)
+        {
+            usage( argc, argv, routines, section_names );
+            throw QuitException();
+        }
+
+        if (strcmp( argv[argc-1], "--help-matrix" ) == 0) {
+            lapack::generate_matrix_usage();
+            throw QuitException();
+        }
+
+        // find routine to test
+        const char* routine = argv[ argc-1 ];
+        testsweeper::test_func_ptr test_routine = find_tester( routine, routines );
+        if (test_routine == nullptr) {
+            usage( argc, argv, routines, section_names );
+            throw std::runtime_error(
+                std::string("routine ") + routine + " not found" );
+        }
+
+        // mark fields that are used (run=false)
+        Params params;
+        test_routine( params, false );
+
+        // Parse parameters up to routine name.
+        try {
+            params.parse( routine, argc-2, argv+1 );
+        }
+        catch (const std::exception& ex) {
+            params.help( routine );
+            throw;
+        }
+
+        lapack::set_matrix_cache_limit( params.gen_cache() * 1024 * 1024 );
+        lapack::set_matrix_cache_dir( params.gen_dir() );
+
+        // show align column if it has non-default values
+        if (params.align.size() != 1 || params.align() != 1) {
+            params.align.width( 5 );
+        }
+
+        // With --threads, show thread count and strong-scaling efficiency,
+        // relative to the first thread count.
+        int64_t threads_orig = get_num_threads();
+        if (! thread_list.empty()) {
+            if (strcmp( threads_api(), "none" ) == 0) {
+                throw std::runtime_error(
+                    "--threads requires MKL, OpenBLAS, or OpenMP" );
+            }
+            printf( "setting threads via %s\n", threads_api() );
+            params.threads();
+            params.efficiency();
+        }
+        else {
+            thread_list.push_back( 0 );  // 0: leave threads as is
+        }
+
+        // run tests
+        int repeat = params.repeat();
+        testsweeper::DataType last = params.datatype();
+        std::string matrix, matrixB;
+        double cond = 0, condD = 0, condB = 0, condD_B = 0;
+        params.header();
+        do {
+            if (params.datatype() != last) {
+                last = params.datatype();
+                printf( "\n" );
+            }
+            double base_time = 0;  // best time with first thread count
+            for (size_t it = 0; it < thread_list.size(); ++it) {
+                int64_t nthreads = thread_list[ it ];
+                if (nthreads > 0)
+                    set_num_threads( nthreads );
+                for (int iter = 0; iter < repeat; ++iter) {
+                    try {
+                        params.matrix.reset_calls();
+                        params.matrixB.reset_calls();
+                        test_routine( params, true );
+                    }
+                    catch (const std::exception& ex) {
+                        fprintf( stderr, "%s%sError: %s%s\n",
+                                 ansi_bold, ansi_red, ex.what(), ansi_normal );
+                        params.okay() = false;
+                    }
+                    if (iter == 0 && it == 0) {
+                        print_matrix_header( params.matrix,  "test matrix A", &matrix,  &cond,  &condD   );
+                        print_matrix_header( params.matrixB, "test matrix B", &matrixB, &condB, &condD_B );
+                    }
+                    if (nthreads > 0) {
+                        // efficiency = (t_1 p_1) / (t_p p), for p threads
+                        params.threads() = nthreads;
+                        double time = params.time();
+                        if (time > 0) {
+                            if (it == 0 && (base_time == 0 || time < base_time))
+                                base_time = time;
+                            params.efficiency() = (base_time * thread_list[ 0 ])
+                                                / (time * nthreads);
+                        }
+                    }
+                    params.print();
+                    fflush( stdout );
+                    status += ! params.okay();
+                    params.reset_output();
+                }
+            }
+            if (repeat > 1 || thread_list.size() > 1) {
+                printf( "\n" );
+            }
+        } while(params.next());
+        if (thread_list[ 0 ] > 0)
+            set_num_threads( threads_orig );
+
+        if (status) {
+            printf( "%d tests FAILED for %s.\n", status, routine );
+        }
+        else {
+            printf( "All tests passed for %s.\n", routine );
+        }
+    }
+    catch (const QuitException& ex) {
+        // pass: no error to print
+    }
+    catch (const std::exception& ex) {
+        fprintf( stderr, "\n%s%sError: %s%s\n",
+                 ansi_bold, ansi_red, ex.what(), ansi_normal );
+        status = -1;
+    }
+
+    return status;
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "threads.hh"
+#include "lapack/config.h"
+
+#if defined(LAPACK_HAVE_MKL) || defined(BLAS_HAVE_MKL)
+    #define LAPACK_THREADS_MKL
+    #include <mkl.h>
+#elif defined(LAPACK_HAVE_OPENBLAS) || defined(BLAS_HAVE_OPENBLAS)
+    #define LAPACK_THREADS_OPENBLAS
+    // Declared here rather than via OpenBLAS's cblas.h,
+    // which may conflict with other CBLAS headers.
+    extern "C" {
+    void openblas_set_num_threads( int num_threads );
+    int  openblas_get_num_threads();
+    }
+#endif
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+const char* threads_api()
+{
+    #if defined(LAPACK_THREADS_MKL)
+        return "MKL";
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        return "OpenBLAS";
+    #elif defined(_OPENMP)
+        return "OpenMP";
+    #else
+        return "none";
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+int64_t get_num_threads()
+{
+    #if defined(LAPACK_THREADS_MKL)
+        return mkl_get_max_threads();
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        return openblas_get_num_threads();
+    #elif defined(_OPENMP)
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+void set_num_threads( int64_t nthreads )
+{
+    #if defined(LAPACK_THREADS_MKL)
+        mkl_set_num_threads( int( nthreads ) );
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        openblas_set_num_threads( int( nthreads ) );
+    #endif
+
+    // Also limit OpenMP regions, e.g., in batched routines,
+    // and OpenMP-threaded BLAS that lack their own API.
+    #ifdef _OPENMP
+        omp_set_num_threads( int( nthreads ) );
+    #endif
+}
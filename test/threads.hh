@@ -0,0 +1,26 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef THREADS_HH
+#define THREADS_HH
+
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// Controls the number of threads used by the BLAS/LAPACK library, via
+// MKL or OpenBLAS if found at configure time (LAPACK_HAVE_MKL,
+// LAPACK_HAVE_OPENBLAS), and by OpenMP regions in LAPACK++ and the tester.
+
+/// @return name of the API used to set threads: "MKL", "OpenBLAS",
+/// "OpenMP", or "none" if the number of threads can't be set.
+const char* threads_api();
+
+/// @return current max number of threads.
+int64_t get_num_threads();
+
+/// Sets max number of threads; nthreads >= 1.
+void set_num_threads( int64_t nthreads );
+
+#endif  // #ifndef THREADS_HH